@@ -16,6 +16,7 @@
 
 #include "PartitionRead.h"
 #include "PartitionExport.h"
+#include "PartitionAuto.h"
 #include "HelperPath.h"
 
 #include <foder/FileLoader.h>
@@ -33,6 +34,7 @@
 #include <arser/arser.h>
 #include <vconone/vconone.h>
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -41,6 +43,11 @@ namespace
 
 const char *opt_bks = "--backends";
 const char *opt_def = "--default";
+const char *opt_auto = "--auto_stages";
+const char *opt_auto_time = "--auto_exec_time";
+const char *opt_auto_bk = "--auto_backend";
+const char *opt_auto_bw = "--auto_bytes_weight";
+const char *opt_auto_runs = "--auto_profile_runs";
 const char *opt_part = "partition";
 const char *opt_input = "input";
 const char *opt_work = "work";
@@ -72,6 +79,41 @@ void build_arser(arser::Arser &arser)
     .required(false)
     .help("Default backend to assign");
 
+  arser.add_argument(opt_auto)
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .required(false)
+    .help("Partition automatically to given number of pipeline stages by cost. "
+          "'partition' file is written with the result instead of being read");
+
+  arser.add_argument(opt_auto_time)
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .help("onert exec_time.json file for costs of auto partition. "
+          "luci-interpreter profiling is used if not given");
+
+  arser.add_argument(opt_auto_bk)
+    .nargs(1)
+    .type(arser::DataType::STR)
+    .required(false)
+    .default_value("cpu")
+    .help("Backend of measurements in exec_time.json to use (default: cpu)");
+
+  arser.add_argument(opt_auto_bw)
+    .nargs(1)
+    .type(arser::DataType::FLOAT)
+    .required(false)
+    .default_value(0.0001f)
+    .help("Cost in microseconds to pass one byte between stages (default: 0.0001)");
+
+  arser.add_argument(opt_auto_runs)
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .required(false)
+    .default_value(3)
+    .help("Number of luci-interpreter runs to profile costs (default: 3)");
+
   arser.add_argument(opt_part)
     .nargs(1)
     .type(arser::DataType::STR)
@@ -160,12 +202,54 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  // Read partition information
-  INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
-  auto partition = partee::read(partition_path);
+  luci::PartitionTable partition;
+  partee::AutoPartition autopart;
+  bool auto_mode = arser[opt_auto];
+  if (auto_mode)
+  {
+    INFO(l) << "--- Auto PartitionConfig-----------------------" << std::endl;
+    try
+    {
+      partee::NodeCosts costs;
+      if (arser[opt_auto_time])
+      {
+        auto exec_time_path = arser.get<std::string>(opt_auto_time);
+        auto backend = arser.get<std::string>(opt_auto_bk);
+        costs = partee::read_exec_time(module->graph(), exec_time_path, backend);
+      }
+      else
+      {
+        auto runs = arser.get<int32_t>(opt_auto_runs);
+        costs = partee::profile_interpreter(module.get(), static_cast<uint32_t>(runs));
+      }
+
+      partee::AutoOptions options;
+      options.stages = static_cast<uint32_t>(std::max(arser.get<int32_t>(opt_auto), 1));
+      options.bytes_weight = arser.get<float>(opt_auto_bw);
+      autopart = partee::auto_partition(module->graph(), costs, options);
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "ERROR: Failed to partition automatically: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+    partition = autopart.table;
+
+    if (!partee::export_part_ini(partition_path, partition))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  else
+  {
+    // Read partition information
+    INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
+    partition = partee::read(partition_path);
+  }
   INFO(l) << partition << std::endl;
 
   // override with command line arguments
+  if (!auto_mode)
   {
     if (arser[opt_bks])
     {
@@ -238,6 +322,14 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  if (auto_mode)
+  {
+    if (!partee::export_partition_map(work_folder, autopart))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   INFO(l) << "--- Partition done-----------------------------" << std::endl << std::endl;
 
   return EXIT_SUCCESS;
@@ -0,0 +1,642 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionAuto.h"
+
+#include <crew/PConfigIni.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeID.h>
+#include <luci/Log.h>
+#include <luci_interpreter/Interpreter.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+bool is_virtual(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+#define CIRCLE_NODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return false;
+#define CIRCLE_VNODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE:  \
+    return true;
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+    default:
+      break;
+  }
+  return false;
+}
+
+std::string opcode_string(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+#define CIRCLE_NODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return #OPCODE;
+#define CIRCLE_VNODE CIRCLE_NODE
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+    default:
+      break;
+  }
+  return "";
+}
+
+/**
+ * @brief Returns producer of tensor 'node' that is placed in a partition,
+ *        nullptr if the tensor does not come from an operator like CircleInput or CircleConst
+ */
+const luci::CircleNode *producer(const luci::CircleNode *node)
+{
+  if (!is_virtual(node))
+    return node;
+
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLECONST:
+    case luci::CircleOpcode::CIRCLEINPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::CIRCLEOUTPUTDUMMY:
+    case luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE:
+    case luci::CircleOpcode::CIRCLEVARIABLE:
+      return nullptr;
+    default:
+      break;
+  }
+  // Circle*Out virtual nodes have the multiple output operator as the first argument
+  assert(node->arity() > 0);
+  return loco::must_cast<const luci::CircleNode *>(node->arg(0));
+}
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = loco::size(node->dtype());
+  for (uint32_t r = 0; r < node->rank(); ++r)
+  {
+    // NOTE unknown dimension is treated as 1, as like batch of dynamic shape
+    if (node->dim(r).known())
+      bytes *= node->dim(r).value();
+  }
+  return bytes;
+}
+
+bool is_quant(const luci::CircleNode *node)
+{
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto input = loco::must_cast<const luci::CircleNode *>(node->arg(i));
+    if (input->dtype() == loco::DataType::U8)
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns flattened input/output bytes of node, as onert HEScheduler does
+ */
+uint64_t io_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = 0;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto input = loco::must_cast<const luci::CircleNode *>(node->arg(i));
+    bytes += tensor_bytes(input);
+  }
+  auto succs = loco::succs(node);
+  bool has_vout = false;
+  for (auto succ : succs)
+  {
+    auto succ_node = loco::must_cast<const luci::CircleNode *>(succ);
+    if (is_virtual(succ_node) && producer(succ_node) == node)
+    {
+      bytes += tensor_bytes(succ_node);
+      has_vout = true;
+    }
+  }
+  if (!has_vout)
+    bytes += tensor_bytes(node);
+  return bytes;
+}
+
+/**
+ * @brief Makes name of luci opcode and onert operation comparable
+ *        ex) "DEPTHWISE_CONV_2D" and "DepthwiseConv2D" to "depthwiseconv2d"
+ */
+std::string normalize(const std::string &name)
+{
+  std::string norm;
+  for (auto c : name)
+  {
+    if (c != '_')
+      norm.push_back(static_cast<char>(std::tolower(c)));
+  }
+  return norm;
+}
+
+// circle opcodes that onert names differently
+const std::map<std::string, std::string> opcode_alias = {
+  {"AVERAGE_POOL_2D", "AvgPool2D"}, {"CONCATENATION", "Concat"}, {"MEAN", "ReduceMean"},
+  {"SUM", "ReduceSUM"},             {"MAXIMUM", "Max"},          {"MINIMUM", "Min"},
+};
+
+/**
+ * @brief Minimal JSON reader for onert exec_time.json
+ *
+ * @note  Format is like below, where "0" or "1" is quantized flag and
+ *        each item of array is [ flattened input/output size, time in us ]
+ *        { "cpu": { "Conv2D": { "0": [[1024, 30], [4096, 100]] } } }
+ */
+class ExecTimeReader
+{
+public:
+  using SizeTime = std::map<uint64_t, double>;
+  // operation(normalized) -> quant -> size -> time
+  using OpTimes = std::map<std::string, std::map<bool, SizeTime>>;
+
+public:
+  ExecTimeReader(const std::string &text) : _text(text) {}
+
+public:
+  OpTimes read(const std::string &backend)
+  {
+    OpTimes optimes;
+
+    expect('{');
+    while (!consume('}'))
+    {
+      auto bkname = string();
+      expect(':');
+      expect('{');
+      while (!consume('}'))
+      {
+        auto opname = normalize(string());
+        expect(':');
+        expect('{');
+        while (!consume('}'))
+        {
+          bool quant = (string() == "1");
+          expect(':');
+          expect('[');
+          while (!consume(']'))
+          {
+            expect('[');
+            auto size = number();
+            expect(',');
+            auto time = number();
+            expect(']');
+            if (bkname == backend)
+              optimes[opname][quant][static_cast<uint64_t>(size)] = time;
+            consume(',');
+          }
+          consume(',');
+        }
+        consume(',');
+      }
+      consume(',');
+    }
+    return optimes;
+  }
+
+private:
+  void skip_ws(void)
+  {
+    while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos])))
+      _pos++;
+  }
+
+  bool consume(char c)
+  {
+    skip_ws();
+    if (_pos < _text.size() && _text[_pos] == c)
+    {
+      _pos++;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char c)
+  {
+    if (!consume(c))
+      throw std::runtime_error(std::string("Invalid exec_time format: expect '") + c + "' at " +
+                               std::to_string(_pos));
+  }
+
+  std::string string(void)
+  {
+    expect('"');
+    auto end = _text.find('"', _pos);
+    if (end == std::string::npos)
+      throw std::runtime_error("Invalid exec_time format: unterminated string");
+    auto str = _text.substr(_pos, end - _pos);
+    _pos = end + 1;
+    return str;
+  }
+
+  double number(void)
+  {
+    skip_ws();
+    size_t used = 0;
+    auto value = std::stod(_text.substr(_pos, 32), &used);
+    _pos += used;
+    return value;
+  }
+
+private:
+  const std::string &_text;
+  size_t _pos = 0;
+};
+
+/**
+ * @brief Returns time for size from measured size-time table,
+ *        scaled linearly from nearest measurement
+ */
+double lookup_time(const ExecTimeReader::SizeTime &sizetime, uint64_t size)
+{
+  assert(!sizetime.empty());
+  auto it = sizetime.lower_bound(size);
+  if (it == sizetime.end())
+    it = std::prev(it);
+  else if (it->first != size && it != sizetime.begin())
+  {
+    auto prev = std::prev(it);
+    // linear interpolation between two measurements
+    double ratio = static_cast<double>(size - prev->first) / (it->first - prev->first);
+    return prev->second + (it->second - prev->second) * ratio;
+  }
+  if (it->first == 0)
+    return it->second;
+  return it->second * static_cast<double>(size) / it->first;
+}
+
+class ProfileObserver final : public luci_interpreter::ExecutionObserver
+{
+public:
+  ProfileObserver(partee::NodeCosts &costs) : _costs(costs) {}
+
+public:
+  void preOperatorExecute(const luci::CircleNode *) override
+  {
+    _begin = std::chrono::steady_clock::now();
+  }
+
+  void postOperatorExecute(const luci::CircleNode *node) override
+  {
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::micro> elapsed = end - _begin;
+    _costs[node] += elapsed.count();
+  }
+
+private:
+  partee::NodeCosts &_costs;
+  std::chrono::steady_clock::time_point _begin;
+};
+
+/**
+ * @brief Returns partitionable nodes of graph in topological order
+ */
+std::vector<const luci::CircleNode *> ordered_nodes(loco::Graph *graph)
+{
+  std::vector<const luci::CircleNode *> nodes;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+    if (!is_virtual(circle_node))
+      nodes.push_back(circle_node);
+  }
+  return nodes;
+}
+
+// Cost of stages to minimize: slowest stage first and then total bytes between stages
+struct StageCost
+{
+  double slowest = std::numeric_limits<double>::max();
+  uint64_t bytes = 0;
+
+  bool operator<(const StageCost &rhs) const
+  {
+    if (slowest != rhs.slowest)
+      return slowest < rhs.slowest;
+    return bytes < rhs.bytes;
+  }
+};
+
+} // namespace
+
+namespace partee
+{
+
+NodeCosts read_exec_time(loco::Graph *graph, const std::string &path, const std::string &backend)
+{
+  LOGGER(l);
+
+  std::ifstream fs(path);
+  if (!fs.good())
+    throw std::runtime_error("Failed to open exec_time file: " + path);
+  std::stringstream ss;
+  ss << fs.rdbuf();
+  auto text = ss.str();
+
+  ExecTimeReader reader(text);
+  auto optimes = reader.read(backend);
+  if (optimes.empty())
+    throw std::runtime_error("No measurement of backend '" + backend + "' in " + path);
+
+  NodeCosts costs;
+  std::vector<const luci::CircleNode *> unknowns;
+  double measured_time = 0;
+  double measured_bytes = 0;
+  for (auto node : ordered_nodes(graph))
+  {
+    auto opcode = opcode_string(node);
+    auto alias = opcode_alias.find(opcode);
+    auto opname = normalize(alias != opcode_alias.end() ? alias->second : opcode);
+    auto quant = is_quant(node);
+    auto bytes = io_bytes(node);
+
+    auto it = optimes.find(opname);
+    if (it == optimes.end() || it->second.find(quant) == it->second.end())
+    {
+      unknowns.push_back(node);
+      continue;
+    }
+    auto time = lookup_time(it->second.at(quant), bytes);
+    costs[node] = time;
+    measured_time += time;
+    measured_bytes += bytes;
+  }
+
+  // Use average time per byte for nodes without measurement
+  double time_per_byte = measured_bytes > 0 ? measured_time / measured_bytes : 1.0;
+  for (auto node : unknowns)
+  {
+    INFO(l) << "No measurement for " << node->name() << "(" << opcode_string(node) << ")"
+            << std::endl;
+    costs[node] = time_per_byte * io_bytes(node);
+  }
+
+  return costs;
+}
+
+NodeCosts profile_interpreter(const luci::Module *module, uint32_t runs)
+{
+  NodeCosts costs;
+  ProfileObserver observer(costs);
+
+  luci_interpreter::Interpreter interpreter(module);
+
+  // NOTE zero filled inputs are used as values does not matter much for time
+  //      and zero is a safe value for inputs like indices
+  const auto input_nodes = loco::input_nodes(module->graph());
+  for (auto node : input_nodes)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(node);
+    std::vector<char> input_data(tensor_bytes(input_node), 0);
+    interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
+  }
+
+  // first run is for warming up
+  interpreter.interpret();
+
+  interpreter.attachObserver(&observer);
+  runs = std::max(runs, 1u);
+  for (uint32_t r = 0; r < runs; ++r)
+    interpreter.interpret();
+
+  for (auto &cost : costs)
+    cost.second /= runs;
+
+  return costs;
+}
+
+AutoPartition auto_partition(loco::Graph *graph, const NodeCosts &costs,
+                             const AutoOptions &options)
+{
+  LOGGER(l);
+
+  auto nodes = ordered_nodes(graph);
+  // partitionable nodes, CircleConst are duplicated in each partition that uses it
+  nodes.erase(std::remove_if(nodes.begin(), nodes.end(),
+                             [](const luci::CircleNode *node) {
+                               return dynamic_cast<const luci::CircleConst *>(node) != nullptr;
+                             }),
+              nodes.end());
+
+  const uint32_t N = static_cast<uint32_t>(nodes.size());
+  if (N == 0)
+    throw std::runtime_error("No node to partition");
+  const uint32_t K = std::max(1u, std::min(options.stages, N));
+
+  std::unordered_map<const luci::CircleNode *, uint32_t> position;
+  for (uint32_t i = 0; i < N; ++i)
+    position[nodes[i]] = i;
+
+  // prefix sum of node costs
+  std::vector<double> prefix(N + 1, 0.0);
+  for (uint32_t i = 0; i < N; ++i)
+  {
+    auto it = costs.find(nodes[i]);
+    prefix[i + 1] = prefix[i] + (it != costs.end() ? it->second : 0.0);
+  }
+
+  // cut_bytes[c] is bytes of tensors that cross cut c, between nodes[c - 1] and nodes[c]
+  std::vector<int64_t> cut_diff(N + 1, 0);
+  {
+    // tensor -> (position of producer, last position of consumers)
+    std::unordered_map<const luci::CircleNode *, std::pair<uint32_t, uint32_t>> lifetimes;
+    for (uint32_t i = 0; i < N; ++i)
+    {
+      for (uint32_t a = 0; a < nodes[i]->arity(); ++a)
+      {
+        auto tensor = loco::must_cast<const luci::CircleNode *>(nodes[i]->arg(a));
+        auto prod = producer(tensor);
+        if (prod == nullptr || position.find(prod) == position.end())
+          continue;
+        auto it = lifetimes.find(tensor);
+        if (it == lifetimes.end())
+          lifetimes[tensor] = std::make_pair(position.at(prod), i);
+        else
+          it->second.second = std::max(it->second.second, i);
+      }
+    }
+    for (auto &lifetime : lifetimes)
+    {
+      auto bytes = static_cast<int64_t>(tensor_bytes(lifetime.first));
+      cut_diff[lifetime.second.first + 1] += bytes;
+      cut_diff[lifetime.second.second + 1] -= bytes;
+    }
+  }
+  std::vector<uint64_t> cut_bytes(N + 1, 0);
+  {
+    int64_t running = 0;
+    for (uint32_t c = 0; c <= N; ++c)
+    {
+      running += cut_diff[c];
+      cut_bytes[c] = static_cast<uint64_t>(running);
+    }
+  }
+
+  // stage [j, i) costs its nodes and receiving tensors crossing cut j
+  auto stage_time = [&](uint32_t j, uint32_t i) {
+    return prefix[i] - prefix[j] + options.bytes_weight * cut_bytes[j];
+  };
+
+  // dp[k][i]: best cost to split nodes[0, i) into k stages
+  std::vector<std::vector<StageCost>> dp(K + 1, std::vector<StageCost>(N + 1));
+  std::vector<std::vector<uint32_t>> from(K + 1, std::vector<uint32_t>(N + 1, 0));
+  dp[0][0].slowest = 0.0;
+  for (uint32_t k = 1; k <= K; ++k)
+  {
+    for (uint32_t i = k; i <= N - (K - k); ++i)
+    {
+      for (uint32_t j = k - 1; j < i; ++j)
+      {
+        if (dp[k - 1][j].slowest == std::numeric_limits<double>::max())
+          continue;
+        StageCost cand;
+        cand.slowest = std::max(dp[k - 1][j].slowest, stage_time(j, i));
+        cand.bytes = dp[k - 1][j].bytes + cut_bytes[j];
+        if (cand < dp[k][i])
+        {
+          dp[k][i] = cand;
+          from[k][i] = j;
+        }
+      }
+    }
+  }
+
+  // trace back stage boundaries
+  std::vector<uint32_t> bounds(K + 1, N);
+  for (uint32_t k = K; k > 0; --k)
+    bounds[k - 1] = from[k][bounds[k]];
+  assert(bounds[0] == 0);
+
+  AutoPartition autopart;
+  auto &table = autopart.table;
+  table.comply = luci::PartitionTable::COMPLY::OPNAME;
+  for (uint32_t k = 0; k < K; ++k)
+    table.groups.push_back("stage" + std::to_string(k + 1));
+  table.default_group = table.groups.front();
+
+  uint32_t num_ops = 0;
+  std::vector<std::pair<uint32_t, uint32_t>> op_stages;
+  for (uint32_t k = 0; k < K; ++k)
+  {
+    autopart.stage_costs.push_back(stage_time(bounds[k], bounds[k + 1]));
+    autopart.stage_in_bytes.push_back(cut_bytes[bounds[k]]);
+    for (uint32_t i = bounds[k]; i < bounds[k + 1]; ++i)
+    {
+      const auto &name = nodes[i]->name();
+      if (name.empty())
+        throw std::runtime_error("Node without name cannot be partitioned by name");
+      auto it = table.byopnames.find(name);
+      if (it != table.byopnames.end() && it->second != table.groups[k])
+        throw std::runtime_error("Node name '" + name + "' is not unique");
+      table.byopnames[name] = table.groups[k];
+
+      // operator index in source circle is kept as node id by the importer
+      if (luci::has_node_id(nodes[i]))
+      {
+        const auto op_index = luci::get_node_id(nodes[i]);
+        op_stages.emplace_back(op_index, k);
+        num_ops = std::max(num_ops, op_index + 1);
+      }
+    }
+    INFO(l) << "Auto partition " << table.groups[k] << ": nodes [" << bounds[k] << ", "
+            << bounds[k + 1] << "), cost " << autopart.stage_costs[k] << ", input bytes "
+            << autopart.stage_in_bytes[k] << std::endl;
+  }
+  autopart.op_stages.resize(num_ops, 0);
+  for (auto &op_stage : op_stages)
+    autopart.op_stages[op_stage.first] = op_stage.second;
+
+  return autopart;
+}
+
+bool export_part_ini(const std::string &path, const luci::PartitionTable &table)
+{
+  crew::Sections sections;
+
+  crew::Section partition;
+  partition.name = "partition";
+  std::string backends;
+  for (auto &group : table.groups)
+    backends += (backends.empty() ? "" : ",") + group;
+  partition.items["backends"] = backends;
+  partition.items["default"] = table.default_group;
+  partition.items["comply"] = "opname";
+  sections.push_back(partition);
+
+  crew::Section opname;
+  opname.name = "OPNAME";
+  for (auto &byopname : table.byopnames)
+    opname.items[byopname.first] = byopname.second;
+  sections.push_back(opname);
+
+  try
+  {
+    crew::write_ini(path, sections);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "ERROR: Failed to write partition file: " << path << ": " << e.what()
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool export_partition_map(const std::string &output_base, const AutoPartition &autopart)
+{
+  auto filepath = output_base + "/partition_map.json";
+  std::ofstream fs(filepath.c_str(), std::ofstream::binary | std::ofstream::trunc);
+  if (not fs.good())
+  {
+    std::cerr << "ERROR: Failed to create file: " << filepath;
+    return false;
+  }
+
+  fs << "{" << std::endl;
+  fs << "  \"partition_map\" : [";
+  for (uint32_t i = 0; i < autopart.op_stages.size(); ++i)
+    fs << (i == 0 ? " " : ", ") << autopart.op_stages[i];
+  fs << " ]," << std::endl;
+  fs << "  \"num_partitions\" : " << autopart.stage_costs.size() << std::endl;
+  fs << "}" << std::endl;
+
+  return fs.good();
+}
+
+} // namespace partee
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_AUTO_H__
+#define __CIRCLE_PARTITION_AUTO_H__
+
+#include <luci/IR/Module.h>
+#include <luci/IR/CircleNode.h>
+#include <luci/Partition.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace partee
+{
+
+/**
+ * @brief Estimated execution time of each node, in microseconds
+ */
+using NodeCosts = std::unordered_map<const luci::CircleNode *, double>;
+
+struct AutoOptions
+{
+  // number of pipeline stages to make
+  uint32_t stages = 2;
+  // cost in microseconds to move one byte between two stages
+  double bytes_weight = 0.0001;
+};
+
+/**
+ * @brief Result of automatic partitioning
+ */
+struct AutoPartition
+{
+  luci::PartitionTable table;
+
+  // stage index of each operator, in operator order of source circle subgraph
+  std::vector<uint32_t> op_stages;
+
+  // estimated execution time of each stage
+  std::vector<double> stage_costs;
+  // bytes of tensors that flow into each stage from previous stages
+  std::vector<uint64_t> stage_in_bytes;
+};
+
+/**
+ * @brief Read node costs from onert 'exec_time.json' measurement file of backend
+ *
+ * @note  Nodes which have no measurement for their operation get the average cost
+ *        per byte of measured nodes
+ */
+NodeCosts read_exec_time(loco::Graph *graph, const std::string &path, const std::string &backend);
+
+/**
+ * @brief Measure node costs with luci-interpreter, averaged for 'runs' inferences
+ */
+NodeCosts profile_interpreter(const luci::Module *module, uint32_t runs);
+
+/**
+ * @brief Split nodes of graph into contiguous stages of balanced cost
+ */
+AutoPartition auto_partition(loco::Graph *graph, const NodeCosts &costs,
+                             const AutoOptions &options);
+
+/**
+ * @brief Write PartitionTable of auto partition as 'partition' INI file
+ */
+bool export_part_ini(const std::string &path, const luci::PartitionTable &table);
+
+/**
+ * @brief Write 'partition_map.json' for nnfw_prepare_pipeline in output_base
+ */
+bool export_partition_map(const std::string &output_base, const AutoPartition &autopart);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_AUTO_H__
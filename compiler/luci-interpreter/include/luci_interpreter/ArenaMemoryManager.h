@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
+#define LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
+
+#include "luci_interpreter/MemoryManager.h"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Serves tensors of a graph from one arena, with offsets planned from tensor lifetimes
+// when the graph builds its allocation plan. Tensors with overlapping lifetimes get disjoint
+// memory. Tensors not in the plan (constants, graph inputs) or grown larger than planned are
+// allocated from heap, the same as SimpleMemoryManager.
+class ArenaMemoryManager : public IMemoryManager
+{
+public:
+  void allocate_memory(luci_interpreter::Tensor &tensor) final;
+  void release_memory(luci_interpreter::Tensor &tensor) final;
+  void plan_memory(const std::vector<TensorLifetime> &lifetimes) final;
+
+  // Total bytes of all arenas
+  size_t arena_size() const;
+
+private:
+  struct Arena
+  {
+    std::unique_ptr<uint8_t[]> buffer;
+    // aligned beginning of buffer
+    uint8_t *base = nullptr;
+    size_t size = 0;
+    // number of tensors placed in this arena
+    size_t num_tensors = 0;
+  };
+
+  struct Placement
+  {
+    Arena *arena;
+    size_t offset;
+    size_t size;
+  };
+
+  void unplace(const Tensor *tensor);
+
+  std::vector<std::unique_ptr<Arena>> _arenas;
+  std::unordered_map<const Tensor *, Placement> _placements;
+  std::unordered_set<const Tensor *> _heap_tensors;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_ARENA_MEMORY_MANAGER_H
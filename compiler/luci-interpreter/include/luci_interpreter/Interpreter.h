@@ -47,6 +47,8 @@ public:
   virtual void postOperatorExecute(const luci::CircleNode *node);
 };
 
+// Tensors of constants refer to the data of module without copying it, so module should outlive
+// the interpreter.
 class Interpreter
 {
 public:
@@ -62,6 +64,9 @@ public:
 
   void interpret();
 
+  // Sets the number of threads which kernels run on. All hardware threads are used by default.
+  void setNumThreads(int num_threads);
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
@@ -20,15 +20,30 @@
 #include "luci_interpreter/core/DataType.h"
 #include "luci_interpreter/core/Tensor.h"
 
+#include <vector>
+
 namespace luci_interpreter
 {
 
+// Lifetime of a tensor allocated during graph execution.
+// 'first' and 'last' are indices of kernels in execution order that allocate and release it.
+struct TensorLifetime
+{
+  Tensor *tensor;
+  size_t first;
+  size_t last;
+};
+
 class IMemoryManager
 {
 public:
   virtual void allocate_memory(luci_interpreter::Tensor &tensor) = 0;
   virtual void release_memory(luci_interpreter::Tensor &tensor) = 0;
 
+  // Called when a graph has (re)built its allocation plan, with lifetimes of the tensors it
+  // allocates during execution. Managers that place tensors in advance can use this.
+  virtual void plan_memory(const std::vector<TensorLifetime> &) {}
+
   virtual ~IMemoryManager() = default;
 };
 
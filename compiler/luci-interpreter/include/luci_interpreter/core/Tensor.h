@@ -135,6 +135,9 @@ public:
 
   void resize(const Shape &new_shape);
 
+  // Increased whenever the shape is changed by resize()
+  uint32_t shape_version() const { return _shape_version; }
+
   void set_data_buffer(uint8_t *buffer)
   {
     if (buffer == nullptr)
@@ -148,6 +151,19 @@ public:
     _data = buffer;
   }
 
+  // Refer to constant data which the tensor does not own, e.g. the storage of a constant node,
+  // instead of a buffer of memory manager. Such tensor is read-only and is never allocated or
+  // released, so the data should outlive the tensor.
+  void set_const_data(const void *data)
+  {
+    _data = static_cast<uint8_t *>(const_cast<void *>(data));
+    _data_allocated = (data != nullptr);
+    _is_allocatable = false;
+    _is_const_data = true;
+  }
+
+  bool is_const_data() const { return _is_const_data; }
+
   bool is_observable() const { return _is_observable; }
 
   void set_observable(bool value) { _is_observable = value; }
@@ -176,6 +192,9 @@ private:
   // Kernel configuration could disable allocation of some tensors if they are not needed for
   // particular operation.
   bool _is_allocatable = true;
+  // Data is referred from outside by set_const_data() rather than owned by memory manager
+  bool _is_const_data = false;
+  uint32_t _shape_version = 0;
   // Used by static memory manager.
   // Stores the offset from the beginning of the allocated memory buffer.
   int32_t _offset = -1;
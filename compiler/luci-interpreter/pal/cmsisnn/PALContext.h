@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_CONTEXT_H
+#define LUCI_INTERPRETER_PAL_CONTEXT_H
+
+#include "core/KernelContext.h"
+
+namespace luci_interpreter_pal
+{
+
+// Kernels of this PAL run on the calling thread only, so the number of threads is always 1.
+class Context final : public luci_interpreter::KernelContext
+{
+public:
+  explicit Context(int num_threads) { (void)num_threads; }
+
+  void setNumThreads(int num_threads) override { (void)num_threads; }
+  int getNumThreads() const override { return 1; }
+};
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_CONTEXT_H
@@ -17,6 +17,8 @@
 #ifndef LUCI_INTERPRETER_PAL_CONV2D_H
 #define LUCI_INTERPRETER_PAL_CONV2D_H
 
+#include "PALContext.h"
+
 #include <tensorflow/lite/kernels/internal/reference/conv.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 #include <arm_nn_types.h>
@@ -29,10 +31,11 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         const float *filter_data, const tflite::RuntimeShape &bias_shape,
                         const float *bias_data, const tflite::RuntimeShape &output_shape,
                         float *output_data, const tflite::RuntimeShape &scratchpad_shape,
-                        float *scratchpad_data)
+                        float *scratchpad_data, luci_interpreter::KernelContext *context)
 {
   (void)scratchpad_shape;
   (void)scratchpad_data;
+  (void)context;
   tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
                               bias_shape, bias_data, output_shape, output_data,
                               tflite::RuntimeShape(), nullptr);
@@ -43,10 +46,11 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         const uint8 *filter_data, const tflite::RuntimeShape &bias_shape,
                         const int32 *bias_data, const tflite::RuntimeShape &output_shape,
                         uint8 *output_data, const tflite::RuntimeShape &scratchpad_shape,
-                        uint8 *scratchpad_data)
+                        uint8 *scratchpad_data, luci_interpreter::KernelContext *context)
 {
   (void)scratchpad_shape;
   (void)scratchpad_data;
+  (void)context;
   tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
                               bias_shape, bias_data, output_shape, output_data, scratchpad_shape,
                               scratchpad_data, nullptr);
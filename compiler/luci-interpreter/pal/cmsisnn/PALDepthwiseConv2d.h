@@ -17,6 +17,8 @@
 #ifndef LUCI_INTERPRETER_PAL_DEPTHWISECONV2D_H
 #define LUCI_INTERPRETER_PAL_DEPTHWISECONV2D_H
 
+#include "PALContext.h"
+
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h>
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
@@ -24,6 +26,30 @@
 
 namespace luci_interpreter_pal
 {
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const float *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                                 const tflite::RuntimeShape &output_shape, float *output_data,
+                                 luci_interpreter::KernelContext *context)
+{
+  (void)context;
+  tflite::reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape, filter_data,
+                                       bias_shape, bias_data, output_shape, output_data);
+}
+
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const uint8 *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const uint8 *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const int32 *bias_data,
+                                 const tflite::RuntimeShape &output_shape, uint8 *output_data,
+                                 luci_interpreter::KernelContext *context)
+{
+  (void)context;
+  tflite::reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape, filter_data,
+                                       bias_shape, bias_data, output_shape, output_data);
+}
+
 template <typename T>
 static inline void
 DepthwiseConvPerChannel(const tflite::DepthwiseParams &params, const int32_t *output_multiplier,
@@ -17,16 +17,65 @@
 #ifndef LUCI_INTERPRETER_PAL_BATCHMATMUL_H
 #define LUCI_INTERPRETER_PAL_BATCHMATMUL_H
 
+#include "PALContext.h"
+
 #include <tensorflow/lite/kernels/internal/reference/batch_matmul.h>
 
 namespace luci_interpreter_pal
 {
+// Returns the index of matrix of 'shape' which is broadcast to matrix 'batch' of 'output_shape'
+static inline int32_t broadcastBatchIndex(const tflite::RuntimeShape &shape,
+                                          const tflite::RuntimeShape &output_shape, int32_t batch)
+{
+  int32_t index = 0;
+  int32_t stride = 1;
+  for (int32_t i = output_shape.DimensionsCount() - 3; i >= 0; --i)
+  {
+    const int32_t dim_index = batch % output_shape.Dims(i);
+    batch /= output_shape.Dims(i);
+    if (shape.Dims(i) != 1)
+      index += dim_index * stride;
+    stride *= shape.Dims(i);
+  }
+  return index;
+}
+
+// Runs reference BatchMatMul on the matrices of output split between threads
 inline void BatchMatMul(const tflite::RuntimeShape &lhs_shape, const float *lhs_data,
                         const tflite::RuntimeShape &rhs_shape, const float *rhs_data,
-                        const tflite::RuntimeShape &output_shape, float *output_data)
+                        const tflite::RuntimeShape &output_shape, float *output_data,
+                        luci_interpreter::KernelContext *context)
 {
-  tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
-                                     output_data);
+  const int32_t rank = output_shape.DimensionsCount();
+  const auto extended_lhs_shape = tflite::RuntimeShape::ExtendedShape(rank, lhs_shape);
+  const auto extended_rhs_shape = tflite::RuntimeShape::ExtendedShape(rank, rhs_shape);
+
+  const int32_t lhs_rows = extended_lhs_shape.Dims(rank - 2);
+  const int32_t lhs_cols = extended_lhs_shape.Dims(rank - 1);
+  const int32_t rhs_rows = extended_rhs_shape.Dims(rank - 2);
+  const int32_t rhs_cols = extended_rhs_shape.Dims(rank - 1);
+  const int32_t output_rows = output_shape.Dims(rank - 2);
+  const int32_t output_cols = output_shape.Dims(rank - 1);
+
+  int32_t batches = 1;
+  for (int32_t i = 0; i < rank - 2; ++i)
+    batches *= output_shape.Dims(i);
+
+  getContext(context)->parallelFor(batches, [&](int32_t start, int32_t end) {
+    const tflite::RuntimeShape lhs_matrix_shape{lhs_rows, lhs_cols};
+    const tflite::RuntimeShape rhs_matrix_shape{rhs_rows, rhs_cols};
+    const tflite::RuntimeShape output_matrix_shape{output_rows, output_cols};
+
+    for (int32_t batch = start; batch < end; ++batch)
+    {
+      const int32_t lhs_index = broadcastBatchIndex(extended_lhs_shape, output_shape, batch);
+      const int32_t rhs_index = broadcastBatchIndex(extended_rhs_shape, output_shape, batch);
+      tflite::reference_ops::BatchMatMul(
+        lhs_matrix_shape, lhs_data + lhs_index * lhs_rows * lhs_cols, rhs_matrix_shape,
+        rhs_data + rhs_index * rhs_rows * rhs_cols, output_matrix_shape,
+        output_data + batch * output_rows * output_cols);
+    }
+  });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *lhs_scratchpad,
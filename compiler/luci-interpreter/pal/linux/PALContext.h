@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_CONTEXT_H
+#define LUCI_INTERPRETER_PAL_CONTEXT_H
+
+#include "core/KernelContext.h"
+
+#include <public/gemmlowp.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace luci_interpreter_pal
+{
+
+// Threads of kernels, which are the workers of gemmlowp context. The context is created once
+// per runtime module, so workers are kept alive between kernels.
+class Context final : public luci_interpreter::KernelContext
+{
+public:
+  explicit Context(int num_threads) { setNumThreads(num_threads); }
+
+  void setNumThreads(int num_threads) override
+  {
+    _gemmlowp_context.set_max_num_threads(std::max(num_threads, 1));
+  }
+  int getNumThreads() const override { return _gemmlowp_context.max_num_threads(); }
+
+  gemmlowp::GemmContext *gemmlowp_context() { return &_gemmlowp_context; }
+
+  // Calls fn(start, end) for the ranges partitioning [0, size), one range per thread.
+  // The last range runs on the calling thread, as gemmlowp WorkersPool::Execute does.
+  template <typename Fn> void parallelFor(int size, const Fn &fn)
+  {
+    const int num_tasks = std::min(size, getNumThreads());
+    if (num_tasks <= 1)
+    {
+      fn(0, size);
+      return;
+    }
+
+    std::vector<RangeTask<Fn>> tasks;
+    tasks.reserve(num_tasks);
+    for (int i = 0; i < num_tasks; ++i)
+      tasks.emplace_back(fn, size * i / num_tasks, size * (i + 1) / num_tasks);
+    _gemmlowp_context.workers_pool()->Execute(num_tasks, tasks.data());
+  }
+
+private:
+  template <typename Fn> struct RangeTask final : public gemmlowp::Task
+  {
+    RangeTask(const Fn &fn, int start, int end) : fn(fn), start(start), end(end) {}
+
+    void Run() override { fn(start, end); }
+
+    const Fn &fn;
+    const int start;
+    const int end;
+  };
+
+private:
+  gemmlowp::GemmContext _gemmlowp_context;
+};
+
+// Returns PAL context of kernel. Kernels built without context, like in kernel tests, run on the
+// calling thread only.
+static inline Context *getContext(luci_interpreter::KernelContext *context)
+{
+  if (context != nullptr)
+    return static_cast<Context *>(context);
+
+  static thread_local Context single_thread_context{1};
+  return &single_thread_context;
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_CONTEXT_H
@@ -17,6 +17,9 @@
 #ifndef LUCI_INTERPRETER_PAL_CONV2D_H
 #define LUCI_INTERPRETER_PAL_CONV2D_H
 
+#include "PALContext.h"
+#include "PALUtils.h"
+
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
@@ -27,28 +30,38 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         const float *filter_data, const tflite::RuntimeShape &bias_shape,
                         const float *bias_data, const tflite::RuntimeShape &output_shape,
                         float *output_data, const tflite::RuntimeShape &scratchpad_shape,
-                        float *scratchpad_data)
+                        float *scratchpad_data, luci_interpreter::KernelContext *context)
 {
   (void)scratchpad_shape;
-  if (scratchpad_data)
-  {
-    const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
-    const int32_t input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
-    const int32_t output_height = output_shape.Dims(1);
-    const int32_t output_width = output_shape.Dims(2);
-    const int32_t filter_height = filter_shape.Dims(1);
-    const int32_t filter_width = filter_shape.Dims(2);
-    tflite::RuntimeShape im2col_shape{batches, output_height, output_width,
-                                      input_depth * filter_height * filter_width};
-
-    tflite::optimized_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data, im2col_shape,
-                                scratchpad_data);
-  }
-  else
-    tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data,
-                                tflite::RuntimeShape(), nullptr);
+  const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
+  const int32_t output_width = output_shape.Dims(2);
+  const int32_t filter_height = filter_shape.Dims(1);
+  const int32_t filter_width = filter_shape.Dims(2);
+  const int32_t im2col_depth = input_depth * filter_height * filter_width;
+
+  // Output rows are split between threads. Scratchpad holds im2col of all output rows, so each
+  // thread makes im2col of its rows in its own part of scratchpad.
+  getContext(context)->parallelFor(output_shape.Dims(1), [&](int32_t start, int32_t end) {
+    tflite::ConvParams slice_params = params;
+    const tflite::RuntimeShape im2col_shape{1, end - start, output_width, im2col_depth};
+    float *im2col_data = nullptr;
+    if (scratchpad_data)
+      im2col_data = scratchpad_data + start * output_width * im2col_depth;
+
+    for (int32_t batch = 0; batch < batches; ++batch)
+    {
+      const ConvRowsSlice slice = sliceConvRows(
+        input_shape, output_shape, filter_height, params.stride_height,
+        params.dilation_height_factor, params.padding_values.height, batch, start, end);
+      slice_params.padding_values.height = slice.padding_height;
+
+      tflite::optimized_ops::Conv(slice_params, slice.input_shape, input_data + slice.input_offset,
+                                  filter_shape, filter_data, bias_shape, bias_data,
+                                  slice.output_shape, output_data + slice.output_offset,
+                                  im2col_shape, im2col_data);
+    }
+  });
 }
 
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -56,16 +69,32 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         const uint8 *filter_data, const tflite::RuntimeShape &bias_shape,
                         const int32 *bias_data, const tflite::RuntimeShape &output_shape,
                         uint8 *output_data, const tflite::RuntimeShape &scratchpad_shape,
-                        uint8 *scratchpad_data)
+                        uint8 *scratchpad_data, luci_interpreter::KernelContext *context)
 {
-  // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
-  auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-
-  tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                              bias_shape, bias_data, output_shape, output_data, scratchpad_shape,
-                              scratchpad_data, gemmlowp_context.get());
+  (void)scratchpad_shape;
+  (void)scratchpad_data;
+  const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t filter_height = filter_shape.Dims(1);
+
+  // NOTE Optimized uint8 Conv of gemmlowp requires filter values to be non-zero, which is not
+  //      guaranteed here. So reference Conv runs on the rows of output split between threads.
+  Context *pal_context = getContext(context);
+  pal_context->parallelFor(output_shape.Dims(1), [&](int32_t start, int32_t end) {
+    tflite::ConvParams slice_params = params;
+    for (int32_t batch = 0; batch < batches; ++batch)
+    {
+      const ConvRowsSlice slice = sliceConvRows(
+        input_shape, output_shape, filter_height, params.stride_height,
+        params.dilation_height_factor, params.padding_values.height, batch, start, end);
+      slice_params.padding_values.height = slice.padding_height;
+
+      tflite::reference_ops::Conv(slice_params, slice.input_shape, input_data + slice.input_offset,
+                                  filter_shape, filter_data, bias_shape, bias_data,
+                                  slice.output_shape, output_data + slice.output_offset,
+                                  tflite::RuntimeShape(), nullptr,
+                                  pal_context->gemmlowp_context());
+    }
+  });
 }
 
 static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_t *mult,
@@ -17,12 +17,66 @@
 #ifndef LUCI_INTERPRETER_PAL_DEPTHWISECONV2D_H
 #define LUCI_INTERPRETER_PAL_DEPTHWISECONV2D_H
 
+#include "PALContext.h"
+#include "PALUtils.h"
+
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h>
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
 
 namespace luci_interpreter_pal
 {
+// Runs reference DepthwiseConv on the rows of output split between threads
+template <typename T, typename BiasT>
+static inline void DepthwiseConvRows(const tflite::DepthwiseParams &params,
+                                     const tflite::RuntimeShape &input_shape, const T *input_data,
+                                     const tflite::RuntimeShape &filter_shape, const T *filter_data,
+                                     const tflite::RuntimeShape &bias_shape, const BiasT *bias_data,
+                                     const tflite::RuntimeShape &output_shape, T *output_data,
+                                     luci_interpreter::KernelContext *context)
+{
+  const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t filter_height = filter_shape.Dims(1);
+
+  getContext(context)->parallelFor(output_shape.Dims(1), [&](int32_t start, int32_t end) {
+    tflite::DepthwiseParams slice_params = params;
+    for (int32_t batch = 0; batch < batches; ++batch)
+    {
+      const ConvRowsSlice slice = sliceConvRows(
+        input_shape, output_shape, filter_height, params.stride_height,
+        params.dilation_height_factor, params.padding_values.height, batch, start, end);
+      slice_params.padding_values.height = slice.padding_height;
+
+      tflite::reference_ops::DepthwiseConv(slice_params, slice.input_shape,
+                                           input_data + slice.input_offset, filter_shape,
+                                           filter_data, bias_shape, bias_data, slice.output_shape,
+                                           output_data + slice.output_offset);
+    }
+  });
+}
+
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const float *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                                 const tflite::RuntimeShape &output_shape, float *output_data,
+                                 luci_interpreter::KernelContext *context)
+{
+  DepthwiseConvRows(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                    bias_data, output_shape, output_data, context);
+}
+
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const uint8 *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const uint8 *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const int32 *bias_data,
+                                 const tflite::RuntimeShape &output_shape, uint8 *output_data,
+                                 luci_interpreter::KernelContext *context)
+{
+  DepthwiseConvRows(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                    bias_data, output_shape, output_data, context);
+}
+
 template <typename T>
 static inline void
 DepthwiseConvPerChannel(const tflite::DepthwiseParams &params, const int32_t *output_multiplier,
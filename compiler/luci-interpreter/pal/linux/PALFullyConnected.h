@@ -17,11 +17,74 @@
 #ifndef LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 #define LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 
+#include "PALContext.h"
+
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
 namespace luci_interpreter_pal
 {
+// Runs reference FullyConnected on the output channels split between threads. A part of output
+// channels refers to its own rows of weights and bias, so it is computed for a batch at a time.
+template <typename T, typename BiasT>
+static inline void FullyConnectedChannels(const tflite::FullyConnectedParams &params,
+                                          const tflite::RuntimeShape &input_shape,
+                                          const T *input_data,
+                                          const tflite::RuntimeShape &weights_shape,
+                                          const T *weights_data, const BiasT *bias_data,
+                                          const tflite::RuntimeShape &output_shape, T *output_data,
+                                          luci_interpreter::KernelContext *context)
+{
+  (void)input_shape;
+  const int32_t output_dims_count = output_shape.DimensionsCount();
+  const int32_t weights_dims_count = weights_shape.DimensionsCount();
+  const int32_t batches = tflite::FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int32_t output_depth = tflite::MatchingDim(weights_shape, weights_dims_count - 2,
+                                                   output_shape, output_dims_count - 1);
+  const int32_t accum_depth = weights_shape.Dims(weights_dims_count - 1);
+
+  getContext(context)->parallelFor(output_depth, [&](int32_t start, int32_t end) {
+    const int32_t depth = end - start;
+    const tflite::RuntimeShape slice_input_shape{1, accum_depth};
+    const tflite::RuntimeShape slice_weights_shape{depth, accum_depth};
+    const tflite::RuntimeShape slice_bias_shape{depth};
+    const tflite::RuntimeShape slice_output_shape{1, depth};
+    const BiasT *slice_bias_data = bias_data ? bias_data + start : nullptr;
+
+    for (int32_t batch = 0; batch < batches; ++batch)
+    {
+      tflite::reference_ops::FullyConnected(
+        params, slice_input_shape, input_data + batch * accum_depth, slice_weights_shape,
+        weights_data + start * accum_depth, slice_bias_shape, slice_bias_data, slice_output_shape,
+        output_data + batch * output_depth + start);
+    }
+  });
+}
+
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const float *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const float *bias_data, const tflite::RuntimeShape &output_shape,
+                                  float *output_data, luci_interpreter::KernelContext *context)
+{
+  (void)bias_shape;
+  FullyConnectedChannels(params, input_shape, input_data, filter_shape, filter_data, bias_data,
+                         output_shape, output_data, context);
+}
+
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const uint8 *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const uint8 *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const int32 *bias_data, const tflite::RuntimeShape &output_shape,
+                                  uint8 *output_data, luci_interpreter::KernelContext *context)
+{
+  (void)bias_shape;
+  FullyConnectedChannels(params, input_shape, input_data, filter_shape, filter_data, bias_data,
+                         output_shape, output_data, context);
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
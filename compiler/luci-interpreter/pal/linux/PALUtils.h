@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_UTILS_H
+#define LUCI_INTERPRETER_PAL_UTILS_H
+
+#include <tensorflow/lite/kernels/internal/types.h>
+
+#include <algorithm>
+
+namespace luci_interpreter_pal
+{
+
+// Part of 2D convolution computing output rows [start, end) of a batch. Input is limited to the
+// rows read by the part, so the part is computed as a convolution of its own with the same
+// filter, given padding_height and the offsets of input and output data.
+struct ConvRowsSlice
+{
+  tflite::RuntimeShape input_shape;
+  tflite::RuntimeShape output_shape;
+  int32_t input_offset;
+  int32_t output_offset;
+  int32_t padding_height;
+};
+
+static inline ConvRowsSlice sliceConvRows(const tflite::RuntimeShape &input_shape,
+                                          const tflite::RuntimeShape &output_shape,
+                                          int32_t filter_height, int32_t stride_height,
+                                          int32_t dilation_height_factor, int32_t padding_height,
+                                          int32_t batch, int32_t start, int32_t end)
+{
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t input_depth = input_shape.Dims(3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_width = output_shape.Dims(2);
+  const int32_t output_depth = output_shape.Dims(3);
+  const int32_t effective_filter_height = (filter_height - 1) * dilation_height_factor + 1;
+
+  // Input row of the first filter row for output row 'start', which may be in the padding
+  const int32_t origin = start * stride_height - padding_height;
+  const int32_t input_start = std::max(origin, 0);
+  const int32_t input_end =
+    std::min((end - 1) * stride_height - padding_height + effective_filter_height, input_height);
+
+  return ConvRowsSlice{
+    tflite::RuntimeShape{1, input_end - input_start, input_width, input_depth},
+    tflite::RuntimeShape{1, end - start, output_width, output_depth},
+    (batch * input_height + input_start) * input_width * input_depth,
+    (batch * output_height + start) * output_width * output_depth, input_start - origin};
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_UTILS_H
@@ -17,11 +17,37 @@
 #ifndef LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 #define LUCI_INTERPRETER_PAL_FULLYCONNECTED_H
 
+#include "PALContext.h"
+
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
 namespace luci_interpreter_pal
 {
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const float *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const float *bias_data, const tflite::RuntimeShape &output_shape,
+                                  float *output_data, luci_interpreter::KernelContext *context)
+{
+  (void)context;
+  tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape, filter_data,
+                                        bias_shape, bias_data, output_shape, output_data);
+}
+
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const uint8 *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const uint8 *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const int32 *bias_data, const tflite::RuntimeShape &output_shape,
+                                  uint8 *output_data, luci_interpreter::KernelContext *context)
+{
+  (void)context;
+  tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape, filter_data,
+                                        bias_shape, bias_data, output_shape, output_data);
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
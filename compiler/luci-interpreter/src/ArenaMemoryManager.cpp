@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/ArenaMemoryManager.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace luci_interpreter
+{
+
+namespace
+{
+
+// Tensors are placed at multiples of this to keep SIMD loads in kernels aligned
+constexpr size_t ALIGNMENT = 64;
+
+size_t align(size_t size) { return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+size_t tensor_size(const Tensor &tensor)
+{
+  return getDataTypeSize(tensor.element_type()) * tensor.shape().num_elements();
+}
+
+struct AllocInfo
+{
+  size_t index;
+  size_t size;
+  size_t first;
+  size_t last;
+  size_t offset;
+};
+
+// Greedy by size approach, same as circle-execution-plan ExecutionPlanner
+// ("EFFICIENT MEMORY MANAGEMENT FOR DEEP NEURAL NET INFERENCE").
+// Tensors are placed in descending order of size, each at the smallest gap that fits among
+// already placed tensors with overlapping lifetime.
+// Return: required size of arena
+size_t greedy_by_size(std::vector<AllocInfo> &infos)
+{
+  std::vector<AllocInfo *> order;
+  for (auto &info : infos)
+    order.push_back(&info);
+  std::stable_sort(order.begin(), order.end(), [](const AllocInfo *lhs, const AllocInfo *rhs) {
+    if (lhs->size != rhs->size)
+      return lhs->size > rhs->size;
+    return lhs->first < rhs->first;
+  });
+
+  size_t result_size = 0;
+  // placed tensors, ordered by offset
+  std::vector<const AllocInfo *> placed;
+  for (auto *current : order)
+  {
+    if (current->size == 0)
+    {
+      current->offset = 0;
+      continue;
+    }
+    const size_t offset_not_assigned = std::numeric_limits<size_t>::max();
+    size_t best_offset = offset_not_assigned;
+    size_t best_offset_fit = offset_not_assigned;
+
+    size_t current_offset = 0;
+    for (const auto *alloc : placed)
+    {
+      if (alloc->last < current->first || alloc->first > current->last)
+        continue;
+
+      if (current_offset + current->size <= alloc->offset &&
+          alloc->offset - current_offset < best_offset_fit)
+      {
+        best_offset = current_offset;
+        best_offset_fit = alloc->offset - current_offset;
+      }
+      current_offset = std::max(current_offset, alloc->offset + alloc->size);
+    }
+    if (best_offset == offset_not_assigned)
+      best_offset = current_offset;
+
+    result_size = std::max(result_size, best_offset + current->size);
+    current->offset = best_offset;
+
+    auto insertion_it = std::upper_bound(
+      placed.begin(), placed.end(), current,
+      [](const AllocInfo *lhs, const AllocInfo *rhs) { return lhs->offset < rhs->offset; });
+    placed.insert(insertion_it, current);
+  }
+  return result_size;
+}
+
+} // namespace
+
+void ArenaMemoryManager::allocate_memory(luci_interpreter::Tensor &tensor)
+{
+  if (!tensor.is_allocatable())
+  {
+    return;
+  }
+  if (tensor.is_data_allocated())
+  {
+    release_memory(tensor);
+  }
+  const auto size = tensor_size(tensor);
+
+  auto it = _placements.find(&tensor);
+  if (it != _placements.end() && size <= it->second.size)
+  {
+    const auto &placement = it->second;
+    tensor.set_data_buffer(placement.arena->base + placement.offset);
+    return;
+  }
+
+  // Not planned or grown after planning
+  auto *data = new uint8_t[size];
+  tensor.set_data_buffer(data);
+  _heap_tensors.insert(&tensor);
+}
+
+void ArenaMemoryManager::release_memory(luci_interpreter::Tensor &tensor)
+{
+  auto it = _heap_tensors.find(&tensor);
+  if (it != _heap_tensors.end())
+  {
+    if (tensor.is_data_allocated())
+      delete[] tensor.data<uint8_t>();
+    _heap_tensors.erase(it);
+  }
+  tensor.set_data_buffer(nullptr);
+}
+
+void ArenaMemoryManager::plan_memory(const std::vector<TensorLifetime> &lifetimes)
+{
+  std::vector<AllocInfo> infos;
+  for (size_t i = 0; i < lifetimes.size(); ++i)
+  {
+    const auto &lifetime = lifetimes[i];
+    assert(lifetime.tensor != nullptr);
+    const Tensor *tensor = lifetime.tensor;
+    const size_t size = tensor->is_allocatable() ? align(tensor_size(*tensor)) : 0;
+    infos.push_back(AllocInfo{i, size, lifetime.first, lifetime.last, 0});
+  }
+  if (infos.empty())
+    return;
+
+  auto arena = std::make_unique<Arena>();
+  arena->size = greedy_by_size(infos);
+  arena->buffer = std::make_unique<uint8_t[]>(arena->size + ALIGNMENT);
+  const auto address = reinterpret_cast<uintptr_t>(arena->buffer.get());
+  arena->base = arena->buffer.get() + (align(address) - address);
+
+  for (const auto &info : infos)
+  {
+    Tensor *tensor = lifetimes[info.index].tensor;
+    unplace(tensor);
+    if (tensor->is_data_allocated() && _heap_tensors.count(tensor) == 0)
+    {
+      // Pointing to an arena that may be freed, tensor will be allocated again before use
+      tensor->set_data_buffer(nullptr);
+    }
+    _placements[tensor] = Placement{arena.get(), info.offset, info.size};
+    arena->num_tensors++;
+  }
+  _arenas.push_back(std::move(arena));
+}
+
+size_t ArenaMemoryManager::arena_size() const
+{
+  size_t size = 0;
+  for (const auto &arena : _arenas)
+    size += arena->size;
+  return size;
+}
+
+void ArenaMemoryManager::unplace(const Tensor *tensor)
+{
+  auto it = _placements.find(tensor);
+  if (it == _placements.end())
+    return;
+
+  Arena *arena = it->second.arena;
+  _placements.erase(it);
+  assert(arena->num_tensors > 0);
+  if (--arena->num_tensors == 0)
+  {
+    auto is_arena = [arena](const std::unique_ptr<Arena> &item) { return item.get() == arena; };
+    _arenas.erase(std::remove_if(_arenas.begin(), _arenas.end(), is_arena), _arenas.end());
+  }
+}
+
+} // namespace luci_interpreter
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci_interpreter/ArenaMemoryManager.h"
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+using namespace testing;
+
+TEST(ArenaMemoryManager, basic)
+{
+  ArenaMemoryManager memory_manager;
+  Tensor first_tensor(DataType::FLOAT32, Shape({4, 16}), AffineQuantization{}, "first_tensor");
+  Tensor second_tensor(DataType::FLOAT32, Shape({4, 16}), AffineQuantization{}, "second_tensor");
+  Tensor third_tensor(DataType::FLOAT32, Shape({4, 16}), AffineQuantization{}, "third_tensor");
+
+  // first and third tensors do not live at the same time
+  memory_manager.plan_memory({TensorLifetime{&first_tensor, 0, 1},
+                              TensorLifetime{&second_tensor, 1, 2},
+                              TensorLifetime{&third_tensor, 2, 3}});
+  EXPECT_EQ(2 * 4 * 16 * sizeof(float), memory_manager.arena_size());
+
+  memory_manager.allocate_memory(first_tensor);
+  memory_manager.allocate_memory(second_tensor);
+  EXPECT_NE(first_tensor.data<void>(), second_tensor.data<void>());
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(first_tensor.data<void>()) % 64);
+
+  float data[4 * 16];
+  for (int i = 0; i < 4 * 16; i++)
+    data[i] = static_cast<float>(i);
+  second_tensor.writeData(data, sizeof(data));
+
+  memory_manager.release_memory(first_tensor);
+  EXPECT_EQ(first_tensor.data<void>(), nullptr);
+
+  memory_manager.allocate_memory(third_tensor);
+  float array[4 * 16];
+  second_tensor.readData(array, sizeof(array));
+  for (int i = 0; i < 4 * 16; i++)
+  {
+    EXPECT_EQ(data[i], array[i]);
+  }
+
+  memory_manager.release_memory(second_tensor);
+  memory_manager.release_memory(third_tensor);
+  EXPECT_EQ(second_tensor.data<void>(), nullptr);
+  EXPECT_EQ(third_tensor.data<void>(), nullptr);
+}
+
+TEST(ArenaMemoryManager, replan)
+{
+  ArenaMemoryManager memory_manager;
+  Tensor tensor(DataType::U8, Shape({8}), AffineQuantization{}, "tensor");
+
+  memory_manager.plan_memory({TensorLifetime{&tensor, 0, 0}});
+  EXPECT_EQ(64, memory_manager.arena_size());
+
+  tensor.resize(Shape({128}));
+  memory_manager.plan_memory({TensorLifetime{&tensor, 0, 0}});
+  // previous arena is released as no tensor is placed there
+  EXPECT_EQ(128, memory_manager.arena_size());
+
+  memory_manager.allocate_memory(tensor);
+  EXPECT_NE(tensor.data<void>(), nullptr);
+  memory_manager.release_memory(tensor);
+}
+
+TEST(ArenaMemoryManager, not_planned)
+{
+  ArenaMemoryManager memory_manager;
+  Tensor tensor(DataType::U8, Shape({8}), AffineQuantization{}, "tensor");
+
+  memory_manager.allocate_memory(tensor);
+  EXPECT_NE(tensor.data<void>(), nullptr);
+  EXPECT_EQ(0, memory_manager.arena_size());
+
+  memory_manager.release_memory(tensor);
+  EXPECT_EQ(tensor.data<void>(), nullptr);
+}
+
+TEST(ArenaMemoryManager, grown_after_plan_NEG)
+{
+  ArenaMemoryManager memory_manager;
+  Tensor tensor(DataType::U8, Shape({8}), AffineQuantization{}, "tensor");
+
+  memory_manager.plan_memory({TensorLifetime{&tensor, 0, 0}});
+
+  // larger than planned, served out of arena
+  tensor.resize(Shape({256}));
+  memory_manager.allocate_memory(tensor);
+  EXPECT_NE(tensor.data<void>(), nullptr);
+
+  uint8_t data[256] = {0};
+  EXPECT_NO_THROW(tensor.writeData(data, sizeof(data)));
+
+  memory_manager.release_memory(tensor);
+  EXPECT_EQ(tensor.data<void>(), nullptr);
+}
+
+} // namespace
+} // namespace luci_interpreter
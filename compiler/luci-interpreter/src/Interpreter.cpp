@@ -127,6 +127,13 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::setNumThreads(int num_threads)
+{
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads should be positive.");
+  _runtime_module->getKernelContext()->setNumThreads(num_threads);
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
@@ -40,8 +40,9 @@ public:
   const std::vector<Tensor *> &getOutputTensors() const { return _outputs; }
 
   // Configures the kernel.
-  // This function is currently called once for each kernel during interpreter construction,
-  // which makes it a convenient place for preparing (resizing) output tensors.
+  // This function is called before execution when shapes of the inputs (or values of the
+  // integer inputs like shape or axis) have changed since the last call, which makes it
+  // a convenient place for preparing (resizing) output tensors.
   virtual void configure() = 0;
 
   // Executes the kernel.
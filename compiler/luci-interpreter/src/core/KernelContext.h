@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_KERNELCONTEXT_H
+#define LUCI_INTERPRETER_CORE_KERNELCONTEXT_H
+
+namespace luci_interpreter
+{
+
+// Context shared by all kernels of a runtime module, like the threads running the kernels.
+// It is implemented by PAL (see PALContext.h), and kernels pass it to PAL as is.
+class KernelContext
+{
+public:
+  virtual ~KernelContext() = default;
+
+  virtual void setNumThreads(int num_threads) = 0;
+  virtual int getNumThreads() const = 0;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_KERNELCONTEXT_H
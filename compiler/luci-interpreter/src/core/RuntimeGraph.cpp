@@ -19,11 +19,26 @@
 #include "core/RuntimeModule.h"
 
 #include <algorithm>
+#include <cstring>
 #include <unordered_map>
 
 namespace luci_interpreter
 {
 
+namespace
+{
+
+// Sum of shape versions of kernel outputs, changed if any output is resized
+uint64_t outputShapeVersions(const Kernel &kernel)
+{
+  uint64_t versions = 0;
+  for (const Tensor *tensor : kernel.getOutputTensors())
+    versions += tensor->shape_version();
+  return versions;
+}
+
+} // namespace
+
 class RuntimeGraph::TensorAllocPlan
 {
   std::vector<std::vector<Tensor *>> _alloc_plan;
@@ -50,6 +65,8 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
   invalidate();
   using Lifetime = std::pair<size_t, size_t>;
   std::unordered_map<Tensor *, Lifetime> lifetimes;
+  // tensors in order of allocation
+  std::vector<Tensor *> tensors;
   const size_t num_kernels = graph._kernels.size();
   for (size_t index = 0; index < num_kernels; ++index)
   {
@@ -64,6 +81,7 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
     {
       assert(lifetimes.count(tensor) == 0);
       lifetimes[tensor] = Lifetime(index, index);
+      tensors.push_back(tensor);
     }
   }
   for (const Tensor *tensor : graph.getOutputTensors())
@@ -74,11 +92,15 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
   }
   _alloc_plan.assign(num_kernels, std::vector<Tensor *>());
   _dealloc_plan.assign(num_kernels + 1, std::vector<Tensor *>());
-  for (const auto &item : lifetimes)
+  std::vector<TensorLifetime> tensor_lifetimes;
+  for (Tensor *tensor : tensors)
   {
-    _alloc_plan[item.second.first].push_back(item.first);
-    _dealloc_plan[item.second.second].push_back(item.first);
+    const auto &lifetime = lifetimes.at(tensor);
+    _alloc_plan[lifetime.first].push_back(tensor);
+    _dealloc_plan[lifetime.second].push_back(tensor);
+    tensor_lifetimes.push_back(TensorLifetime{tensor, lifetime.first, lifetime.second});
   }
+  _memory_manager->plan_memory(tensor_lifetimes);
   _valid = true;
 }
 
@@ -100,9 +122,102 @@ void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
   }
 }
 
+// Decides whether Kernel::configure() should be called again before execution.
+// Kernel outputs (and scratch tensors) need to be prepared again only when the shape of an input
+// has changed or the value of an input that configure() may read has changed. configure() reads
+// values of small integer tensors like shape, axis or paddings, so values of integer inputs are
+// kept and compared. Integer inputs too large to be such parameters cause configure every time.
+class RuntimeGraph::KernelConfigCache
+{
+  struct InputState
+  {
+    uint32_t shape_version = 0;
+    std::vector<uint8_t> values;
+  };
+
+  struct KernelState
+  {
+    bool configured = false;
+    std::vector<InputState> inputs;
+  };
+
+  static constexpr int32_t MAX_PARAM_ELEMENTS = 64;
+
+  std::vector<KernelState> _states;
+
+public:
+  void invalidate() { _states.clear(); }
+  bool needsConfigure(const RuntimeGraph &graph, size_t kernel_index);
+  void update(const RuntimeGraph &graph, size_t kernel_index);
+
+private:
+  static bool isParamCandidate(const Tensor *tensor)
+  {
+    return tensor->element_type() == DataType::S32 || tensor->element_type() == DataType::S64;
+  }
+};
+
+bool RuntimeGraph::KernelConfigCache::needsConfigure(const RuntimeGraph &graph,
+                                                      size_t kernel_index)
+{
+  if (_states.size() != graph._kernels.size())
+    _states.assign(graph._kernels.size(), KernelState());
+
+  const auto &state = _states[kernel_index];
+  if (!state.configured)
+    return true;
+
+  const auto &inputs = graph._kernels[kernel_index]->getInputTensors();
+  assert(inputs.size() == state.inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    const Tensor *tensor = inputs[i];
+    if (tensor == nullptr)
+      continue;
+    const auto &input_state = state.inputs[i];
+    if (input_state.shape_version != tensor->shape_version())
+      return true;
+    if (!isParamCandidate(tensor))
+      continue;
+    if (tensor->shape().num_elements() > MAX_PARAM_ELEMENTS || !tensor->is_data_allocated())
+      return true;
+    const auto size = input_state.values.size();
+    if (size > 0 && std::memcmp(input_state.values.data(), tensor->data<uint8_t>(), size) != 0)
+      return true;
+  }
+  return false;
+}
+
+void RuntimeGraph::KernelConfigCache::update(const RuntimeGraph &graph, size_t kernel_index)
+{
+  assert(_states.size() == graph._kernels.size());
+
+  auto &state = _states[kernel_index];
+  const auto &inputs = graph._kernels[kernel_index]->getInputTensors();
+  state.inputs.resize(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    const Tensor *tensor = inputs[i];
+    auto &input_state = state.inputs[i];
+    input_state.values.clear();
+    if (tensor == nullptr)
+      continue;
+    input_state.shape_version = tensor->shape_version();
+    if (isParamCandidate(tensor) && tensor->is_data_allocated() &&
+        tensor->shape().num_elements() <= MAX_PARAM_ELEMENTS)
+    {
+      const auto *data = tensor->data<uint8_t>();
+      const size_t size = tensor->shape().num_elements() * getDataTypeSize(tensor->element_type());
+      input_state.values.assign(data, data + size);
+    }
+  }
+  state.configured = true;
+}
+
 RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager)
   : _owning_module(owning_module), _memory_manager(memory_manager),
-    _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager))
+    _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager)),
+    _kernel_config_cache(std::make_unique<KernelConfigCache>())
 {
 }
 
@@ -110,7 +225,8 @@ RuntimeGraph::~RuntimeGraph()
 {
   for (auto &tensor : _tensors)
   {
-    if (tensor->is_data_allocated())
+    // Constant data is not owned by memory manager
+    if (tensor->is_data_allocated() && !tensor->is_const_data())
       _memory_manager->release_memory(*tensor);
   }
 }
@@ -146,6 +262,12 @@ void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
   assert(kernel != nullptr);
   _kernels.push_back(std::move(kernel));
   _tensor_alloc_plan->invalidate();
+  _kernel_config_cache->invalidate();
+}
+
+KernelContext *RuntimeGraph::getKernelContext() const
+{
+  return _owning_module != nullptr ? _owning_module->getKernelContext() : nullptr;
 }
 
 void RuntimeGraph::execute() const
@@ -165,6 +287,8 @@ void RuntimeGraph::execute() const
     }
   }
 
+  // Allocation plan should be built again if sizes of tensors have changed
+  bool resized = false;
   for (size_t index = 0; index < _kernels.size(); ++index)
   {
     const auto &kernel = _kernels[index];
@@ -173,9 +297,14 @@ void RuntimeGraph::execute() const
       event_notifier->preOperatorExecute(kernel.get());
     }
 
-    // TODO The `configure` method should only be called if the outputs of an operator need to be
-    //  resized.
-    kernel->configure();
+    // Outputs need to be resized only if inputs have changed since the last configure
+    if (_kernel_config_cache->needsConfigure(*this, index))
+    {
+      const auto shape_versions = outputShapeVersions(*kernel);
+      kernel->configure();
+      _kernel_config_cache->update(*this, index);
+      resized = resized || outputShapeVersions(*kernel) != shape_versions;
+    }
 
     // Preallocate outputs in advance instead of relying on automatic allocation
     _tensor_alloc_plan->allocate(index);
@@ -196,6 +325,9 @@ void RuntimeGraph::execute() const
     }
     _tensor_alloc_plan->deallocate(index);
   }
+
+  if (resized)
+    _tensor_alloc_plan->invalidate();
 }
 
 } // namespace luci_interpreter
@@ -20,6 +20,7 @@
 #include "luci_interpreter/core/Tensor.h"
 #include "luci_interpreter/MemoryManager.h"
 #include "core/Kernel.h"
+#include "core/KernelContext.h"
 
 #include <memory>
 #include <vector>
@@ -34,6 +35,7 @@ class RuntimeGraph
 private:
   class TensorAllocPlan;
   friend class TensorAllocPlan;
+  class KernelConfigCache;
 
 public:
   explicit RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager);
@@ -53,6 +55,9 @@ public:
 
   void execute() const;
 
+  // Context shared by kernels of the owning module, or nullptr if the graph has no owning module.
+  KernelContext *getKernelContext() const;
+
 private:
   IMemoryManager *_memory_manager;
   RuntimeModule *_owning_module;
@@ -64,6 +69,8 @@ private:
   std::vector<std::unique_ptr<Kernel>> _kernels;
   // Tensors that are not used anymore after given op
   std::unique_ptr<TensorAllocPlan> _tensor_alloc_plan;
+  // Inputs state of each kernel at last configure, to skip configure when nothing changed
+  std::unique_ptr<KernelConfigCache> _kernel_config_cache;
 };
 
 } // namespace luci_interpreter
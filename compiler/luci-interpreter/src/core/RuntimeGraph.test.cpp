@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+#include "luci_interpreter/TestMemoryManager.h"
+
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+using namespace testing;
+
+// Kernel counting configure() calls, of which output has the shape of input
+class CountingKernel : public Kernel
+{
+public:
+  CountingKernel(const Tensor *input, const Tensor *param, Tensor *output, int *num_configures)
+    : Kernel({input, param}, {output}), _num_configures(num_configures)
+  {
+  }
+
+  void configure() override
+  {
+    ++*_num_configures;
+    _outputs[0]->resize(_inputs[0]->shape());
+  }
+
+  void execute() const override {}
+
+private:
+  int *_num_configures;
+};
+
+class RuntimeGraphTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _graph = _module.addGraph(&_memory_manager);
+    _input = _graph->addTensor(
+      std::make_unique<Tensor>(DataType::FLOAT32, Shape({2, 3}), AffineQuantization{}, "input"));
+    _param = _graph->addTensor(
+      std::make_unique<Tensor>(DataType::S32, Shape({2}), AffineQuantization{}, "param"));
+    _output = _graph->addTensor(
+      std::make_unique<Tensor>(DataType::FLOAT32, Shape({}), AffineQuantization{}, "output"));
+    _graph->setInputTensors({_input, _param});
+    _graph->setOutputTensors({_output});
+    _graph->addKernel(std::make_unique<CountingKernel>(_input, _param, _output, &_num_configures));
+
+    _memory_manager.allocate_memory(*_input);
+    _memory_manager.allocate_memory(*_param);
+    writeParam({1, 2});
+  }
+
+  void writeParam(std::vector<int32_t> values)
+  {
+    _param->writeData(values.data(), values.size() * sizeof(int32_t));
+  }
+
+  TestMemoryManager _memory_manager;
+  RuntimeModule _module{nullptr};
+  RuntimeGraph *_graph = nullptr;
+  Tensor *_input = nullptr;
+  Tensor *_param = nullptr;
+  Tensor *_output = nullptr;
+  int _num_configures = 0;
+};
+
+TEST_F(RuntimeGraphTest, skip_configure_of_unchanged_inputs)
+{
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 1);
+  EXPECT_EQ(_output->shape(), Shape({2, 3}));
+
+  _graph->execute();
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 1);
+
+  // Rewriting the same parameter value is not a change
+  writeParam({1, 2});
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 1);
+}
+
+TEST_F(RuntimeGraphTest, configure_on_changed_shape)
+{
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 1);
+
+  _input->resize(Shape({4, 3}));
+  _memory_manager.allocate_memory(*_input);
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 2);
+  EXPECT_EQ(_output->shape(), Shape({4, 3}));
+
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 2);
+}
+
+TEST_F(RuntimeGraphTest, configure_on_changed_param_value)
+{
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 1);
+
+  writeParam({3, 2});
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 2);
+
+  _graph->execute();
+  EXPECT_EQ(_num_configures, 2);
+}
+
+} // namespace
+} // namespace luci_interpreter
@@ -19,6 +19,7 @@
 
 #include "core/RuntimeGraph.h"
 #include "core/EventNotifier.h"
+#include "core/KernelContext.h"
 #include "luci_interpreter/MemoryManager.h"
 
 #include <memory>
@@ -34,6 +35,12 @@ public:
 
   EventNotifier *getEventNotifier() const { return _event_notifier; }
 
+  void setKernelContext(std::unique_ptr<KernelContext> &&kernel_context)
+  {
+    _kernel_context = std::move(kernel_context);
+  }
+  KernelContext *getKernelContext() const { return _kernel_context.get(); }
+
   RuntimeGraph *addGraph(IMemoryManager *memory_manager)
   {
     _graphs.push_back(std::make_unique<RuntimeGraph>(this, memory_manager));
@@ -52,6 +59,8 @@ private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
+  // _kernel_context should be before _graphs, as kernels of graphs refer to it
+  std::unique_ptr<KernelContext> _kernel_context;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
 };
 
@@ -43,6 +43,10 @@ void Tensor::readData(void *data_ptr, size_t data_size) const
 
 void Tensor::writeData(const void *data_ptr, size_t data_size)
 {
+  if (_is_const_data)
+  {
+    throw std::runtime_error("Cannot write to constant tensor.");
+  }
   const size_t element_size = getDataTypeSize(element_type());
   const int32_t num_elements = shape().num_elements();
   if (data_size != num_elements * element_size)
@@ -53,6 +57,13 @@ void Tensor::writeData(const void *data_ptr, size_t data_size)
   std::memcpy(data<void>(), data_ptr, data_size);
 }
 
-void Tensor::resize(const Shape &new_shape) { _shape = new_shape; }
+void Tensor::resize(const Shape &new_shape)
+{
+  if (_shape != new_shape)
+  {
+    _shape = new_shape;
+    ++_shape_version;
+  }
+}
 
 } // namespace luci_interpreter
@@ -44,8 +44,9 @@ namespace kernels
 {
 
 BatchMatMul::BatchMatMul(const Tensor *x, const Tensor *y, Tensor *output, Tensor *x_tmp,
-                         Tensor *y_tmp, const BatchMatMulParams &params)
-  : KernelWithParams({x, y}, {output, x_tmp, y_tmp}, params)
+                         Tensor *y_tmp, const BatchMatMulParams &params,
+                         KernelContext *context)
+  : KernelWithParams({x, y}, {output, x_tmp, y_tmp}, params), _context(context)
 {
 }
 
@@ -177,7 +178,7 @@ void BatchMatMul::execute() const
     case DataType::FLOAT32:
       luci_interpreter_pal::BatchMatMul(rhs_shape, getTensorData<float>(rhs_tensor), lhs_shape,
                                         getTensorData<float>(lhs_tensor), getTensorShape(output()),
-                                        getTensorData<float>(output()));
+                                        getTensorData<float>(output()), _context);
       break;
     default:
       throw std::runtime_error("Unsupported type.");
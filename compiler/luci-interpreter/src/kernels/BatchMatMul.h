@@ -18,6 +18,7 @@
 #define LUCI_INTERPRETER_KERNELS_BATCHMATMUL_H
 
 #include "core/Kernel.h"
+#include "core/KernelContext.h"
 #include "core/KernelParams.h"
 
 namespace luci_interpreter
@@ -29,7 +30,7 @@ class BatchMatMul : public KernelWithParams<BatchMatMulParams>
 {
 public:
   BatchMatMul(const Tensor *x, const Tensor *y, Tensor *output, Tensor *x_tmp, Tensor *y_tmp,
-              const BatchMatMulParams &params);
+              const BatchMatMulParams &params, KernelContext *context = nullptr);
 
   const Tensor *x() const { return _inputs[0]; }
   const Tensor *y() const { return _inputs[1]; }
@@ -41,6 +42,9 @@ public:
 private:
   Tensor *temp_lhs() const { return _outputs[1]; }
   Tensor *temp_rhs() const { return _outputs[2]; }
+
+private:
+  KernelContext *const _context;
 };
 
 } // namespace kernels
@@ -30,8 +30,9 @@ namespace kernels
 {
 
 Conv2D::Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-               Tensor *scratchpad, const Conv2DParams &params)
-  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output, scratchpad}, params)
+               Tensor *scratchpad, const Conv2DParams &params, KernelContext *context)
+  : KernelWithParams<Conv2DParams>({input, filter, bias}, {output, scratchpad}, params),
+    _context(context)
 {
 }
 
@@ -193,7 +194,7 @@ void Conv2D::evalFloat() const
                              getTensorShape(filter()), getTensorData<float>(filter()),
                              getTensorShape(bias()), getTensorData<float>(bias()),
                              getTensorShape(output()), getTensorData<float>(output()),
-                             getTensorShape(scratchpad), scratchpad_data);
+                             getTensorShape(scratchpad), scratchpad_data, _context);
 }
 
 void Conv2D::evalQuantized() const
@@ -228,11 +229,15 @@ void Conv2D::evalQuantized() const
   params.quantized_activation_max = activation_max;
 
   auto scratchpad = getOutputTensors()[1];
+  uint8_t *scratchpad_data = nullptr;
+  if (scratchpad->is_allocatable())
+    scratchpad_data = scratchpad->data<uint8_t>();
+
   luci_interpreter_pal::Conv(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
                              getTensorShape(filter()), getTensorData<uint8_t>(filter()),
                              getTensorShape(bias()), getTensorData<int32_t>(bias()),
                              getTensorShape(output()), getTensorData<uint8_t>(output()),
-                             getTensorShape(scratchpad), getTensorData<uint8_t>(scratchpad));
+                             getTensorShape(scratchpad), scratchpad_data, _context);
 }
 
 void Conv2D::evalQuantizedPerChannel() const
@@ -18,6 +18,7 @@
 #define LUCI_INTERPRETER_KERNELS_CONV2D_H
 
 #include "core/Kernel.h"
+#include "core/KernelContext.h"
 #include "core/KernelParams.h"
 
 #include <memory>
@@ -31,7 +32,7 @@ class Conv2D : public KernelWithParams<Conv2DParams>
 {
 public:
   Conv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-         Tensor *scratchpad, const Conv2DParams &params);
+         Tensor *scratchpad, const Conv2DParams &params, KernelContext *context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *filter() const { return _inputs[1]; }
@@ -51,6 +52,7 @@ private:
 private:
   int32_t _padding_height{};
   int32_t _padding_width{};
+  KernelContext *const _context;
 };
 
 } // namespace kernels
@@ -15,6 +15,7 @@
  */
 
 #include "kernels/Conv2D.h"
+#include "kernels/KernelContext.h"
 #include "kernels/TestUtils.h"
 #include "luci_interpreter/TestMemoryManager.h"
 
@@ -85,6 +86,56 @@ TEST_F(Conv2DTest, Float)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST_F(Conv2DTest, FloatMultiThreads)
+{
+  // Output rows split between threads read overlapping rows of input and padding
+  Shape input_shape{2, 7, 5, 3};
+  Shape filter_shape{4, 3, 3, 3};
+  Shape bias_shape{4};
+  std::vector<float> input_data(input_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 11) - 5;
+  std::vector<float> filter_data(filter_shape.num_elements());
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 7) - 3;
+  std::vector<float> bias_data{1, -2, 3, -4};
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 1;
+  params.stride_width = 1;
+  params.dilation_height_factor = 2;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  auto run = [&](KernelContext *context) {
+    Tensor input_tensor =
+      makeInputTensor<DataType::FLOAT32>(input_shape, input_data, _memory_manager.get());
+    Tensor filter_tensor =
+      makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data, _memory_manager.get());
+    Tensor bias_tensor =
+      makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, _memory_manager.get());
+    Tensor im2col(DataType::FLOAT32, Shape({}), {}, "");
+    Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+    Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, &im2col, params,
+                  context);
+    kernel.configure();
+    _memory_manager->allocate_memory(im2col);
+    _memory_manager->allocate_memory(output_tensor);
+    kernel.execute();
+
+    EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 7, 5, 4}));
+    return extractTensorData<float>(output_tensor);
+  };
+
+  auto context = createKernelContext();
+  context->setNumThreads(3);
+
+  const std::vector<float> ref_output_data = run(nullptr);
+  EXPECT_THAT(run(context.get()), FloatArrayNear(ref_output_data));
+}
+
 TEST_F(Conv2DTest, FloatPointwise)
 {
   Shape input_shape{1, 2, 2, 2};
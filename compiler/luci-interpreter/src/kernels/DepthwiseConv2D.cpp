@@ -29,8 +29,9 @@ namespace kernels
 
 DepthwiseConv2D::DepthwiseConv2D(const Tensor *input, const Tensor *filter, const Tensor *bias,
                                  Tensor *output, Tensor *scratchpad,
-                                 const DepthwiseConv2DParams &params)
-  : KernelWithParams<DepthwiseConv2DParams>({input, filter, bias}, {output, scratchpad}, params)
+                                 const DepthwiseConv2DParams &params, KernelContext *context)
+  : KernelWithParams<DepthwiseConv2DParams>({input, filter, bias}, {output, scratchpad}, params),
+    _context(context)
 {
 }
 
@@ -172,10 +173,10 @@ void DepthwiseConv2D::evalFloat() const
   params.float_activation_min = activation_min;
   params.float_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
+  luci_interpreter_pal::DepthwiseConv(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(filter()),
     getTensorData<float>(filter()), getTensorShape(bias()), getTensorData<float>(bias()),
-    getTensorShape(output()), getTensorData<float>(output()));
+    getTensorShape(output()), getTensorData<float>(output()), _context);
 }
 
 void DepthwiseConv2D::evalQuantizedPerChannel() const
@@ -301,10 +302,10 @@ void DepthwiseConv2D::evalQuantized() const
   params.quantized_activation_min = activation_min;
   params.quantized_activation_max = activation_max;
 
-  tflite::reference_ops::DepthwiseConv(
+  luci_interpreter_pal::DepthwiseConv(
     params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(filter()),
     getTensorData<uint8_t>(filter()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
-    getTensorShape(output()), getTensorData<uint8_t>(output()));
+    getTensorShape(output()), getTensorData<uint8_t>(output()), _context);
 }
 
 void DepthwiseConv2D::evalQuantizedS8PerChannel() const
@@ -18,6 +18,7 @@
 #define LUCI_INTERPRETER_KERNELS_DEPTHWISECONV2D_H
 
 #include "core/Kernel.h"
+#include "core/KernelContext.h"
 #include "core/KernelParams.h"
 
 namespace luci_interpreter
@@ -29,7 +30,8 @@ class DepthwiseConv2D : public KernelWithParams<DepthwiseConv2DParams>
 {
 public:
   DepthwiseConv2D(const Tensor *input, const Tensor *filter, const Tensor *bias, Tensor *output,
-                  Tensor *scratchpad, const DepthwiseConv2DParams &params);
+                  Tensor *scratchpad, const DepthwiseConv2DParams &params,
+                  KernelContext *context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *filter() const { return _inputs[1]; }
@@ -49,6 +51,7 @@ private:
 private:
   int32_t _padding_height{};
   int32_t _padding_width{};
+  KernelContext *const _context;
 };
 
 } // namespace kernels
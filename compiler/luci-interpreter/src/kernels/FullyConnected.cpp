@@ -29,8 +29,10 @@ namespace kernels
 {
 
 FullyConnected::FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias,
-                               Tensor *output, const FullyConnectedParams &params)
-  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params)
+                               Tensor *output, const FullyConnectedParams &params,
+                               KernelContext *context)
+  : KernelWithParams<FullyConnectedParams>({input, weights, bias}, {output}, params),
+    _context(context)
 {
 }
 
@@ -105,10 +107,10 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
     getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
-    getTensorShape(output()), getTensorData<float>(output()));
+    getTensorShape(output()), getTensorData<float>(output()), _context);
 }
 
 void FullyConnected::evalQuantized() const
@@ -138,10 +140,10 @@ void FullyConnected::evalQuantized() const
   op_params.quantized_activation_max = output_activation_max;
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     op_params, getTensorShape(input()), getTensorData<uint8_t>(input()), getTensorShape(weights()),
     getTensorData<uint8_t>(weights()), getTensorShape(bias()), getTensorData<int32_t>(bias()),
-    getTensorShape(output()), getTensorData<uint8_t>(output()));
+    getTensorShape(output()), getTensorData<uint8_t>(output()), _context);
 }
 
 void FullyConnected::evalQuantizedS8() const
@@ -18,6 +18,7 @@
 #define LUCI_INTERPRETER_KERNELS_FULLYCONNECTED_H
 
 #include "core/Kernel.h"
+#include "core/KernelContext.h"
 #include "core/KernelParams.h"
 
 namespace luci_interpreter
@@ -29,7 +30,7 @@ class FullyConnected : public KernelWithParams<FullyConnectedParams>
 {
 public:
   FullyConnected(const Tensor *input, const Tensor *weights, const Tensor *bias, Tensor *output,
-                 const FullyConnectedParams &params);
+                 const FullyConnectedParams &params, KernelContext *context = nullptr);
 
   const Tensor *input() const { return _inputs[0]; }
   const Tensor *weights() const { return _inputs[1]; }
@@ -43,6 +44,9 @@ private:
   void evalFloat() const;
   void evalQuantized() const;
   void evalQuantizedS8() const;
+
+private:
+  KernelContext *const _context;
 };
 
 } // namespace kernels
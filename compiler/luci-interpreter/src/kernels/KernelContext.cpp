@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "kernels/KernelContext.h"
+
+#include "PALContext.h"
+
+#include <thread>
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+
+std::unique_ptr<KernelContext> createKernelContext()
+{
+  // hardware_concurrency() may return 0 when it is not computable
+  const auto num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  return std::make_unique<luci_interpreter_pal::Context>(num_threads > 0 ? num_threads : 1);
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
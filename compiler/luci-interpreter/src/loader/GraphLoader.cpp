@@ -233,10 +233,11 @@ void GraphLoader::loadTensors()
     {
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
+      // Refer to the storage of const node rather than copying it, so module outlives interpreter
       if (const_data != nullptr)
       {
-        _memory_manager->allocate_memory(*tensor);
-        tensor->writeData(const_data, data_size);
+        assert(data_size == tensor->shape().num_elements() * getDataTypeSize(node->dtype()));
+        tensor->set_const_data(const_data);
       }
     }
     else if (const auto *custom_out_node = dynamic_cast<const luci::CircleCustomOut *>(node))
@@ -250,8 +251,8 @@ void GraphLoader::loadTensors()
         const void *const_data = getNodeData(custom_node, &data_size);
         if (const_data != nullptr)
         {
-          _memory_manager->allocate_memory(*tensor);
-          tensor->writeData(const_data, data_size);
+          assert(data_size == tensor->shape().num_elements() * getDataTypeSize(node->dtype()));
+          tensor->set_const_data(const_data);
         }
       }
     }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loader/GraphLoader.h"
+#include "luci_interpreter/SimpleMemoryManager.h"
+
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+TEST(GraphLoaderTest, ConstTensorRefersNodeData)
+{
+  loco::Graph graph;
+  auto *const_node = graph.nodes()->create<luci::CircleConst>();
+  const_node->dtype(loco::DataType::FLOAT32);
+  const_node->shape({2, 3});
+  const_node->size<loco::DataType::FLOAT32>(6);
+  for (uint32_t i = 0; i < 6; ++i)
+    const_node->at<loco::DataType::FLOAT32>(i) = 0.5f * i;
+
+  SimpleMemoryManager memory_manager;
+  std::unordered_map<const loco::Graph *, RuntimeGraph *> graph_to_runtime_graph;
+  std::unordered_map<const loco::Node *, Tensor *> node_to_tensor;
+  RuntimeToIR runtime_to_ir;
+  {
+    RuntimeGraph runtime_graph(nullptr, &memory_manager);
+    graph_to_runtime_graph[&graph] = &runtime_graph;
+    GraphLoader graph_loader(&graph, &runtime_graph, runtime_to_ir, graph_to_runtime_graph,
+                             node_to_tensor, &memory_manager);
+    graph_loader.loadTensors();
+
+    Tensor *tensor = node_to_tensor.at(const_node);
+    EXPECT_EQ(tensor->data<float>(), &const_node->at<loco::DataType::FLOAT32>(0));
+    EXPECT_TRUE(tensor->is_const_data());
+    EXPECT_TRUE(tensor->is_data_allocated());
+    EXPECT_FALSE(tensor->is_allocatable());
+
+    // Memory manager does not touch constant data
+    memory_manager.allocate_memory(*tensor);
+    EXPECT_EQ(tensor->data<float>(), &const_node->at<loco::DataType::FLOAT32>(0));
+
+    std::vector<float> data(6);
+    tensor->readData(data.data(), data.size() * sizeof(float));
+    EXPECT_EQ(data, std::vector<float>({0.f, 0.5f, 1.f, 1.5f, 2.f, 2.5f}));
+    EXPECT_ANY_THROW(tensor->writeData(data.data(), data.size() * sizeof(float)));
+  }
+  // Data of const node is not released with runtime graph
+  EXPECT_EQ(const_node->at<loco::DataType::FLOAT32>(5), 2.5f);
+}
+
+} // namespace
+} // namespace luci_interpreter
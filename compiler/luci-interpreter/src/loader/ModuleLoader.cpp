@@ -18,6 +18,8 @@
 
 #include "GraphLoader.h"
 
+#include "kernels/KernelContext.h"
+
 namespace luci_interpreter
 {
 
@@ -32,6 +34,9 @@ ModuleLoader::ModuleLoader(const luci::Module *module, RuntimeModule *runtime_mo
 
 void ModuleLoader::load()
 {
+  // Kernels of all graphs share the context, so it is created before any kernel.
+  _runtime_module->setKernelContext(kernels::createKernelContext());
+
   // Runtime graphs have to be created in advance, because they will be needed during the loading
   // process for control flow nodes.
   for (size_t i = 0; i < _module->size(); ++i)
@@ -66,7 +66,9 @@ std::unique_ptr<Kernel> build_kernel_CircleBatchMatMul(const luci::CircleNode *c
   params.adj_x = node->adj_x();
   params.adj_y = node->adj_y();
 
-  return std::make_unique<kernels::BatchMatMul>(lhs, rhs, output, lhs_tmp, rhs_tmp, params);
+  KernelContext *context = helper.getRuntimeGraph(node->graph())->getKernelContext();
+  return std::make_unique<kernels::BatchMatMul>(lhs, rhs, output, lhs_tmp, rhs_tmp, params,
+                                                context);
 }
 
 } // namespace luci_interpreter
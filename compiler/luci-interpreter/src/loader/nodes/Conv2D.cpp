@@ -62,7 +62,8 @@ std::unique_ptr<Kernel> build_kernel_CircleConv2D(const luci::CircleNode *circle
   params.dilation_width_factor = node->dilation()->w();
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, tmp, params);
+  KernelContext *context = helper.getRuntimeGraph(node->graph())->getKernelContext();
+  return std::make_unique<kernels::Conv2D>(input, filter, bias, output, tmp, params, context);
 }
 
 } // namespace luci_interpreter
@@ -63,7 +63,9 @@ std::unique_ptr<Kernel> build_kernel_CircleDepthwiseConv2D(const luci::CircleNod
   }
   Tensor *tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(scratchpad));
 
-  return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, tmp, params);
+  KernelContext *context = helper.getRuntimeGraph(node->graph())->getKernelContext();
+  return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, tmp, params,
+                                                    context);
 }
 
 } // namespace luci_interpreter
@@ -37,7 +37,8 @@ std::unique_ptr<Kernel> build_kernel_CircleFullyConnected(const luci::CircleNode
   FullyConnectedParams params{};
   params.activation = node->fusedActivationFunction();
 
-  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params);
+  KernelContext *context = helper.getRuntimeGraph(node->graph())->getKernelContext();
+  return std::make_unique<kernels::FullyConnected>(input, weights, bias, output, params, context);
 }
 
 } // namespace luci_interpreter
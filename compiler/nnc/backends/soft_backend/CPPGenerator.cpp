@@ -17,6 +17,9 @@
 #include "backends/soft_backend/CPPGenerator.h"
 
 #include "mir/Operation.h"
+#include "mir/ops/CappedReluOp.h"
+#include "mir/ops/EluOp.h"
+#include "mir/ops/LeakyReluOp.h"
 #include "ModelAnalyzer.h"
 #include "SBSerializer.h"
 
@@ -27,6 +30,7 @@
 #include "CommonData.generated.h"
 #include "eigen.generated.h"
 #include "cpp_common_funcs.generated.h"
+#include "cpp_thread_pool.generated.h"
 #include "cpp_capped_relu.generated.h"
 #include "cpp_concat.generated.h"
 #include "cpp_conv.generated.h"
@@ -54,6 +58,9 @@
 
 #include <cstring>
 #include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 #include <stdexcept>
 #include <utility>
 
@@ -79,9 +86,13 @@ static unique_ptr<ofstream> getStream(const string &path)
   return ofs;
 }
 
-CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name)
-  : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name))
+CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name,
+                                   int32_t num_threads)
+  : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name)),
+    _num_threads(num_threads)
 {
+  if (_num_threads < 1)
+    throw runtime_error("Number of threads should be positive");
 }
 
 void CPPCodeGenerator::materializeModelParams(ostream &out, const Serializer &s)
@@ -238,6 +249,8 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
+  // memory of temporary tensors
+  out << "  std::unique_ptr<float[]> _arena;\n";
   out << "};\n";
 }
 
@@ -258,6 +271,23 @@ static void printOperationArgs(ostream &out, const vector<string> &args)
   }
 }
 
+/**
+ * @brief Prints construction of artifact Shape object
+ * @param out Stream to write program text
+ * @param shape Shape to print
+ */
+static void printShape(ostream &out, const mir::Shape &shape)
+{
+  out << "Shape{";
+  for (int i = 0; i < shape.rank(); ++i)
+  {
+    if (i != 0)
+      out << ", ";
+    out << shape.dim(i);
+  }
+  out << "}";
+}
+
 void CPPCodeGenerator::gatherOperationArguments(const ModelAnalyzer &ma,
                                                 const vector<size_t> &arg_ids, vector<string> &args)
 {
@@ -334,6 +364,97 @@ void CPPCodeGenerator::materializeCall(ostream &out, const ModelAnalyzer &ma,
   out << ");\n";
 }
 
+/**
+ * @brief Prints float literal that keeps exact value of *value*
+ */
+static string floatLiteral(float value)
+{
+  ostringstream literal;
+  literal << scientific << setprecision(numeric_limits<float>::max_digits10) << value << "f";
+  return literal.str();
+}
+
+void CPPCodeGenerator::materializeFusedElementwise(ostream &out, const ModelAnalyzer &ma,
+                                                   const sir::FusedElementwise *call)
+{
+  assert(call != nullptr);
+  vector<string> args;
+  gatherOperationArguments(ma, call->outputs, args);
+  gatherOperationArguments(ma, {call->inputs[0]}, args);
+  out << "  " << call->funcName << "(";
+  printOperationArgs(out, args);
+  out << ", [&](float v, index_t c) {\n";
+
+  // constant operands of binary operations follow input of chain
+  size_t operand_id = 1;
+  for (const mir::Operation *op : call->ops)
+  {
+    string operand;
+    if (op->getNumInputs() == 2)
+    {
+      assert(operand_id < call->inputs.size());
+      const size_t tensor_id = call->inputs[operand_id++];
+      const TensorDescriptor &td = ma.getTensors()[tensor_id];
+      assert(td.type == TensorDescriptor::Type::temporary);
+      operand = _formattedTensors[tensor_id] + ".getData()[" +
+                (td.shape.numElements() == 1 ? "0" : "c") + "]";
+    }
+    out << "    v = ";
+    switch (op->getType())
+    {
+      case mir::Operation::Type::abs:
+        out << "std::abs(v)";
+        break;
+      case mir::Operation::Type::cappedReLU:
+        out << "std::min(std::max(v, 0.0f), "
+            << floatLiteral(dynamic_cast<const mir::ops::CappedReluOp *>(op)->getCap()) << ")";
+        break;
+      case mir::Operation::Type::ELU:
+        out << "v < 0.0f ? "
+            << floatLiteral(dynamic_cast<const mir::ops::EluOp *>(op)->getAlpha())
+            << " * (std::exp(v) - 1.0f) : v";
+        break;
+      case mir::Operation::Type::leakyReLU:
+        out << "std::max("
+            << floatLiteral(dynamic_cast<const mir::ops::LeakyReluOp *>(op)->getAlpha())
+            << " * v, v)";
+        break;
+      case mir::Operation::Type::ReLU:
+        out << "std::max(v, 0.0f)";
+        break;
+      case mir::Operation::Type::sigmoid:
+        out << "1.0f / (1.0f + std::exp(-v))";
+        break;
+      case mir::Operation::Type::sqrt:
+        out << "std::sqrt(v)";
+        break;
+      case mir::Operation::Type::tanh:
+        out << "std::tanh(v)";
+        break;
+      case mir::Operation::Type::add:
+        out << "v + " << operand;
+        break;
+      case mir::Operation::Type::div:
+        out << "v / " << operand;
+        break;
+      case mir::Operation::Type::max:
+        out << "std::max(v, " << operand << ")";
+        break;
+      case mir::Operation::Type::mul:
+        out << "v * " << operand;
+        break;
+      case mir::Operation::Type::sub:
+        out << "v - " << operand;
+        break;
+      default:
+        assert(false && "unexpected fused operation");
+    }
+    out << ";\n";
+  }
+  out << "    return v;\n"
+         "  });\n";
+}
+
 void CPPCodeGenerator::materializeTranspose(ostream &out, const ModelAnalyzer &ma,
                                             const sir::TransposeTensor *transpose)
 {
@@ -350,9 +471,19 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(constructor != nullptr);
   const TensorDescriptor &td = ma.getTensors()[constructor->tensorId];
   assert(td.type == sir::TensorDescriptor::Type::temporary);
-  (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  out << "  Tensor " << t_name << "(";
+  if (td.arena_offset == sir::INVALID_ARENA_OFFSET)
+  {
+    // tensor references model parameters
+    out << "Shape{}, nullptr";
+  }
+  else
+  {
+    printShape(out, td.shape);
+    out << ", _arena.get() + " << td.arena_offset << ", " << td.shape.numElements();
+  }
+  out << ");\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -369,9 +500,9 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
 void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAnalyzer &ma)
 {
 
-  // Allocate temporary(im2col) tensor
+  // Place temporary(im2col) tensor after other temporary tensors
   out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{" << ma.getMaxTemporarySize()
-      << "});\n";
+      << "}, _arena.get() + " << ma.getArenaSize() << ", " << ma.getMaxTemporarySize() << ");\n";
 
   for (const unique_ptr<Action> &action : ma.getInferenceSequence())
   {
@@ -379,7 +510,10 @@ void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAna
     switch (action->type)
     {
       case Action::Type::callFunction:
-        materializeCall(out, ma, dynamic_cast<const sir::CallFunction *>(ptr));
+        if (auto fused = dynamic_cast<const sir::FusedElementwise *>(ptr))
+          materializeFusedElementwise(out, ma, fused);
+        else
+          materializeCall(out, ma, dynamic_cast<const sir::CallFunction *>(ptr));
         break;
       case Action::Type::transposeTensor:
         materializeTranspose(out, ma, dynamic_cast<const sir::TransposeTensor *>(ptr));
@@ -412,6 +546,9 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   out.write(CommonData, sizeof(CommonData));
 
   out.write(cpp_common_funcs, sizeof(cpp_common_funcs));
+  // thread pool used by parallel loops of operations below
+  out << "#define NNC_NUM_THREADS " << _num_threads << "\n";
+  out.write(cpp_thread_pool, sizeof(cpp_thread_pool));
   out.write(cpp_capped_relu, sizeof(cpp_capped_relu));
   out.write(cpp_concat, sizeof(cpp_concat));
   out.write(cpp_conv, sizeof(cpp_conv));
@@ -439,13 +576,26 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   out.write(cpp_leaky_relu, sizeof(cpp_leaky_relu));
 
   // gen NN constructor
+  // all memory of inference is allocated here, so doInference does not allocate
+  const auto &tensors = ma.getTensors();
   out << class_name << "::" << class_name
       << "(const string& parametersPath)\n"
+         "  : _arena(new float["
+      << ma.getArenaSize() + ma.getMaxTemporarySize()
+      << "])\n"
          "{\n"
          "  readParameters(_parameters, _paramSize, parametersPath, "
       << s.getFormatVersion() << ", " << s.getModelHash()
       << ");\n"
-         "}\n\n";
+         "  initThreadPool();\n";
+  for (size_t output_tensor_id : ma.getPersistentTensors())
+  {
+    const string &output_tensor_name = _formattedTensors[output_tensor_id];
+    out << "  " << output_tensor_name << ".reset(new Tensor(";
+    printShape(out, tensors[output_tensor_id].shape);
+    out << "));\n";
+  }
+  out << "}\n\n";
   // gen NN destructor
   out << class_name << "::~" << class_name
       << "()\n"
@@ -455,7 +605,6 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   // generate input setters
   // generate main setter if network has only one
   const auto &inputs = ma.getInputs();
-  const auto &tensors = ma.getTensors();
   if (inputs.size() == 1)
   {
     const TensorDescriptor &td = tensors[inputs[0]];
@@ -486,11 +635,6 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   out << "void " << class_name
       << "::doInference()\n"
          "{\n";
-  for (size_t output_tensor_id : ma.getPersistentTensors())
-  {
-    const string &output_tensor_name = _formattedTensors[output_tensor_id];
-    out << "  " << output_tensor_name << ".reset(new Tensor());\n";
-  }
 
   // gen inference sequence
   materializeInferenceSequence(out, ma);
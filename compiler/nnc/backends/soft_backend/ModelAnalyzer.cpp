@@ -20,8 +20,10 @@
 #include "mir/Graph.h"
 #include "mir/OpDefs.h"
 
+#include <algorithm>
 #include <stack>
 #include <map>
+#include <set>
 
 using namespace std;
 
@@ -49,7 +51,7 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
   {
     // register constant tensor
     // it's data is deserialized to described tensor by O(1) at runtime
-    const auto tensor_id = declareTemporaryTensor();
+    const auto tensor_id = declareTemporaryTensor(op->getOutputShape(0));
     node_output_tensors.push_back(tensor_id);
   }
   else if (op->getType() == Operation::Type::output)
@@ -61,8 +63,10 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-        tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto &tensor_shape = output.getShape();
+      const auto tensor_id = tensor_name.empty()
+                               ? declareTemporaryTensor(tensor_shape)
+                               : declarePersistentTensor(tensor_name, tensor_shape);
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -101,22 +105,138 @@ size_t ModelAnalyzer::declareInputTensor(const std::string &name, const mir::Sha
   return id;
 }
 
-size_t ModelAnalyzer::declarePersistentTensor(const std::string &name)
+size_t ModelAnalyzer::declarePersistentTensor(const std::string &name, const mir::Shape &shape)
 {
   assert(!name.empty());
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, {}});
+  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, shape});
   _persistent_tensors.push_back(id);
   return id;
 }
 
-size_t ModelAnalyzer::declareTemporaryTensor()
+size_t ModelAnalyzer::declareTemporaryTensor(const mir::Shape &shape)
 {
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", {}});
+  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", shape});
   return id;
 }
 
+/**
+ * @brief Checks that input of elementwise operation is a constant which can be indexed by channel:
+ * a scalar or a vector along the last dimension of output, while other input has shape of output
+ */
+static bool isChannelConstant(const Operation *op, size_t index)
+{
+  if (op->getInput(index)->getNode()->getType() != Operation::Type::constant)
+    return false;
+
+  const Shape &shape = op->getInputShape(index);
+  const Shape &out_shape = op->getOutputShape(0);
+  if (op->getInputShape(1 - index) != out_shape)
+    return false;
+  if (shape.numElements() == 1)
+    return true;
+  const int32_t channels = out_shape.rank() > 0 ? out_shape.dim(out_shape.rank() - 1) : 1;
+  return shape.rank() > 0 && shape.rank() <= out_shape.rank() &&
+         shape.dim(shape.rank() - 1) == channels && shape.numElements() == channels;
+}
+
+/**
+ * @return Index of operation input passed through fused chain, -1 if operation can not be fused
+ */
+static int getChainInputIndex(const Operation *op)
+{
+  switch (op->getType())
+  {
+    case Operation::Type::abs:
+    case Operation::Type::cappedReLU:
+    case Operation::Type::ELU:
+    case Operation::Type::leakyReLU:
+    case Operation::Type::ReLU:
+    case Operation::Type::sigmoid:
+    case Operation::Type::sqrt:
+    case Operation::Type::tanh:
+      return 0;
+    case Operation::Type::add:
+    case Operation::Type::max:
+    case Operation::Type::mul:
+      if (isChannelConstant(op, 1))
+        return 0;
+      return isChannelConstant(op, 0) ? 1 : -1;
+    case Operation::Type::div:
+    case Operation::Type::sub:
+      return isChannelConstant(op, 1) ? 0 : -1;
+    default:
+      return -1;
+  }
+}
+
+void ModelAnalyzer::fuseElementwiseChains()
+{
+  map<const Operation *, size_t> positions;
+  for (size_t pos = 0; pos < _inferenceSequence.size(); ++pos)
+  {
+    auto call = dynamic_cast<const CallFunction *>(_inferenceSequence[pos].get());
+    assert(call);
+    positions[call->mirOp] = pos;
+  }
+
+  set<const Operation *> fused_ops;
+  for (size_t pos = 0; pos < _inferenceSequence.size(); ++pos)
+  {
+    auto call = dynamic_cast<const CallFunction *>(_inferenceSequence[pos].get());
+    if (call == nullptr || fused_ops.count(call->mirOp))
+      continue;
+    int chain_input = getChainInputIndex(call->mirOp);
+    if (chain_input < 0)
+      continue;
+
+    // inputs of fused call are input of chain and constant operands of binary operations
+    vector<Operation *> chain{call->mirOp};
+    vector<size_t> inputs{call->inputs[chain_input]};
+    if (call->mirOp->getNumInputs() == 2)
+      inputs.push_back(call->inputs[1 - chain_input]);
+    while (true)
+    {
+      const Operation::Output *output = chain.back()->getOutput(0);
+      if (!output->getName().empty() || output->getUses().size() != 1)
+        break;
+      const Operation::Use &use = output->getUses().front();
+      Operation *next = use.getNode();
+      const int next_input = getChainInputIndex(next);
+      if (next_input < 0 || use.getIndex() != static_cast<size_t>(next_input))
+        break;
+      chain.push_back(next);
+      if (next->getNumInputs() == 2)
+      {
+        const Action *next_call = _inferenceSequence[positions[next]].get();
+        assert(dynamic_cast<const CallFunction *>(next_call));
+        inputs.push_back(static_cast<const CallFunction *>(next_call)->inputs[1 - next_input]);
+      }
+    }
+    if (chain.size() < 2)
+      continue;
+
+    // Fused call takes place of the last operation, when all inputs of chain are computed
+    const size_t last_pos = positions[chain.back()];
+    auto last_call = dynamic_cast<const CallFunction *>(_inferenceSequence[last_pos].get());
+    vector<size_t> outputs = last_call->outputs;
+    for (Operation *op : chain)
+    {
+      fused_ops.insert(op);
+      _opToDescr.erase(op);
+      _inferenceSequence[positions[op]].reset();
+    }
+    Operation *last_op = chain.back();
+    _inferenceSequence[last_pos].reset(
+      new FusedElementwise(std::move(chain), std::move(inputs), std::move(outputs)));
+    _opToDescr[last_op] = _inferenceSequence[last_pos].get();
+  }
+
+  auto removed = std::remove(_inferenceSequence.begin(), _inferenceSequence.end(), nullptr);
+  _inferenceSequence.erase(removed, _inferenceSequence.end());
+}
+
 void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_order,
                                      map<size_t, size_t> &first_def, map<size_t, size_t> &last_use)
 {
@@ -150,6 +270,68 @@ void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_orde
   }
 }
 
+void ModelAnalyzer::planArena(const map<size_t, size_t> &first_def,
+                              const map<size_t, size_t> &last_use)
+{
+  // Every tensor is aligned like a separately allocated buffer
+  const size_t alignment = 4;
+
+  struct Placement
+  {
+    size_t tensor_id;
+    size_t def;
+    size_t use;
+    size_t size;
+    size_t offset;
+  };
+
+  vector<Placement> planned;
+  for (const auto &def : first_def)
+  {
+    const size_t tensor_id = def.first;
+    auto call = dynamic_cast<const CallFunction *>(_inferenceSequence[def.second].get());
+    assert(call);
+    if (call->mirOp->getType() == Operation::Type::constant)
+      continue;
+
+    const size_t use = last_use.count(tensor_id) ? last_use.at(tensor_id) : def.second;
+    const auto num_elements = static_cast<size_t>(_tensors[tensor_id].shape.numElements());
+    const size_t size = (num_elements + alignment - 1) / alignment * alignment;
+    planned.push_back({tensor_id, def.second, use, size, 0});
+  }
+
+  // Place large tensors first
+  std::stable_sort(planned.begin(), planned.end(),
+                   [](const Placement &a, const Placement &b) { return a.size > b.size; });
+  for (size_t i = 0; i < planned.size(); ++i)
+  {
+    Placement &current = planned[i];
+
+    // Gather already placed tensors that are alive at the same time, ordered by offset
+    vector<const Placement *> alive;
+    for (size_t j = 0; j < i; ++j)
+    {
+      const Placement &other = planned[j];
+      if (other.def <= current.use && current.def <= other.use)
+        alive.push_back(&other);
+    }
+    std::sort(alive.begin(), alive.end(),
+              [](const Placement *a, const Placement *b) { return a->offset < b->offset; });
+
+    // Find the first gap large enough to fit tensor
+    size_t offset = 0;
+    for (const Placement *other : alive)
+    {
+      if (offset + current.size <= other->offset)
+        break;
+      offset = std::max(offset, other->offset + other->size);
+    }
+    current.offset = offset;
+    _tensors[current.tensor_id].arena_offset = offset;
+    _arena_size = std::max(_arena_size, offset + current.size);
+  }
+}
+
 void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_order)
 {
   // Run inference sequence construction over constructed list of operations
@@ -159,6 +341,9 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
     node->accept(this);
   }
 
+  // compute chains of elementwise operations in single pass
+  fuseElementwiseChains();
+
   // Insert temporary tensor constructors
   // map temporary tensor id to index in original sequence where it was defined/used first/last time
   map<size_t, size_t> first_def;
@@ -167,6 +352,9 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
   // prepare use-def info
   gatherDefUseInfo(_inferenceSequence, first_def, last_use);
 
+  // assign memory to temporary tensors
+  planArena(first_def, last_use);
+
   // insert memory operations
   // Every iteration of loop contains three steps:
   // 1) insert constructors of temporary tensors used in current operations
@@ -387,8 +575,10 @@ void ModelAnalyzer::visit(mir::ops::DeConv2DOp &op)
 {
   const auto &kernel_shape = op.getInputShape(1);
   const auto &out_shape = op.getOutputShape(0);
+  // temporary buffer holds im2col data followed by transposed kernel
   const int32_t tmp_size = kernel_shape.dim(0) * kernel_shape.dim(1) * kernel_shape.dim(3) *
-                           out_shape.dim(0) * out_shape.dim(1) * out_shape.dim(2);
+                             out_shape.dim(0) * out_shape.dim(1) * out_shape.dim(2) +
+                           kernel_shape.numElements();
   updateMaxTemporarySize(static_cast<size_t>(tmp_size));
   appendOperationToInference(&op, "convTransposed2d", {_temp_tensor_id});
 }
@@ -401,7 +591,9 @@ void ModelAnalyzer::visit(mir::ops::PadOp &op) { appendOperationToInference(&op,
 
 void ModelAnalyzer::visit(mir::ops::ReduceMeanOp &op)
 {
-  appendOperationToInference(&op, "reduceMean");
+  // temporary buffer holds partial sums
+  updateMaxTemporarySize(static_cast<size_t>(op.getOutputShape(0).numElements()));
+  appendOperationToInference(&op, "reduceMean", {_temp_tensor_id});
 }
 
 void ModelAnalyzer::visit(mir::ops::TransposeOp &op)
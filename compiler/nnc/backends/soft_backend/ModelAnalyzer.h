@@ -121,6 +121,11 @@ public:
 
   size_t getMaxTemporarySize() const { return _max_temp_size; }
 
+  /**
+   * @return Number of elements in memory arena shared by temporary tensors
+   */
+  size_t getArenaSize() const { return _arena_size; }
+
   size_t getTempTID() const { return _temp_tensor_id; }
 
 protected:
@@ -157,15 +162,26 @@ private:
   /**
    * @brief Declares persistent tensor in artifact
    * @param name Name of variable, if empty - assigned automaticly
+   * @param shape Shape of tensor
    * @return Id of created tensor
    */
-  size_t declarePersistentTensor(const std::string &name);
+  size_t declarePersistentTensor(const std::string &name, const mir::Shape &shape);
 
   /**
    * @brief Declares temporary tensor in artifact
+   * @param shape Shape of tensor
    * @return Id of created tensor
    */
-  size_t declareTemporaryTensor();
+  size_t declareTemporaryTensor(const mir::Shape &shape = {});
+
+  /**
+   * @brief Replaces chains of elementwise operations with single calls that compute
+   * whole chain in one pass over input
+   *
+   * Chain consists of unary activations and binary operations with constant scalar or
+   * per-channel operand, intermediate results of chain must be temporary and have single use.
+   */
+  void fuseElementwiseChains();
 
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
@@ -176,6 +192,17 @@ private:
   void gatherDefUseInfo(const std::vector<std::unique_ptr<sir::Action>> &post_order,
                         std::map<size_t, size_t> &first_def, std::map<size_t, size_t> &last_use);
 
+  /**
+   * @brief Assigns offsets in memory arena to temporary tensors
+   * @param first_def Maps tensor id to position in inf sequence where it was defined first time.
+   * @param last_use Maps tensor id to position in inf sequence where it was used last time.
+   *
+   * Tensors with overlapping lifetimes get disjoint parts of arena, others may share memory.
+   * Outputs of constant operations reference model parameters and do not occupy arena.
+   */
+  void planArena(const std::map<size_t, size_t> &first_def,
+                 const std::map<size_t, size_t> &last_use);
+
   /**
    * @brief constructs inference sequence from vector of mir::Operations, constructed
    * @param post_order vector representing layout of operations in inference
@@ -197,6 +224,7 @@ private:
   /// @brief list of tensor ids corresponding to NN outputs
   std::vector<size_t> _outputs;
   size_t _max_temp_size = 0;
+  size_t _arena_size = 0;
   size_t _temp_tensor_id = 0;
   std::vector<sir::TensorDescriptor> _tensors;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
@@ -33,6 +33,7 @@ namespace sir
 {
 
 const size_t INVALID_TENSOR_ID = std::numeric_limits<size_t>::max();
+const size_t INVALID_ARENA_OFFSET = std::numeric_limits<size_t>::max();
 
 /**
  * @brief Represents variable used in artifact.
@@ -58,6 +59,9 @@ struct TensorDescriptor
   std::string name;
   // if _shape.rank() == 0 - assume shape is not known for this tensor on compilation
   mir::Shape shape;
+  // offset of temporary tensor data in artifact memory arena in elements,
+  // INVALID_ARENA_OFFSET if tensor does not occupy arena
+  size_t arena_offset = INVALID_ARENA_OFFSET;
 };
 
 /**
@@ -137,6 +141,24 @@ struct CallFunction : public Action
   size_t paramStartOffset;
 };
 
+/**
+ * @brief Call of chain of elementwise operations computed in one pass over input.
+ * inputs[0] is input of the chain, other inputs are constant operands of binary operations
+ * in order of the chain, mirOp is the last operation of the chain.
+ */
+struct FusedElementwise : public CallFunction
+{
+
+  FusedElementwise(std::vector<mir::Operation *> &&chain, std::vector<size_t> &&inputs,
+                   std::vector<size_t> &&outputs)
+    : CallFunction(chain.back(), "fusedElementwise", std::move(inputs), std::move(outputs)),
+      ops(std::move(chain))
+  {
+  }
+
+  std::vector<mir::Operation *> ops;
+};
+
 } // namespace sir
 
 } // namespace nnc
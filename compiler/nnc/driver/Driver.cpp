@@ -117,7 +117,7 @@ static void backend(mir::Graph *graph)
 {
   if (cli::target == NNC_TARGET_ARM_CPP || cli::target == NNC_TARGET_X86_CPP)
   {
-    CPPCodeGenerator(cli::artifactDir, cli::artifactName).run(graph);
+    CPPCodeGenerator(cli::artifactDir, cli::artifactName, cli::numThreads).run(graph);
   }
   else if (cli::target == NNC_TARGET_ARM_GPU_CPP)
   {
@@ -122,6 +122,9 @@ Option<std::string> artifactDir(optname("--output-dir, -d"),
                                 overview("specify directory for output files"),
                                 ".", // default is current directory
                                 optional(true), optvalues(""), checkOutDir, separators("="));
+Option<int32_t> numThreads(optname("--threads"),
+                           overview("number of threads used by generated code for inference"),
+                           1, optional(true), optvalues(""), checkNumThreads, separators("="));
 
 /**
  * Options for *interpreter*
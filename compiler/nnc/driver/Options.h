@@ -56,6 +56,7 @@ extern Option<std::string> inputFile; // files contains model of specific AI fra
  */
 extern Option<std::string> artifactDir;  // output directory for artifact
 extern Option<std::string> artifactName; // name of artifact
+extern Option<int32_t> numThreads;       // number of threads used by artifact
 
 /**
  * Options for interpreter
@@ -19,6 +19,7 @@
 
 #include "mir/Graph.h"
 
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -34,6 +35,7 @@ namespace sir
 struct TensorDescriptor;
 struct Action;
 struct CallFunction;
+struct FusedElementwise;
 struct TransposeTensor;
 struct CreateTmp;
 struct DestroyTmp;
@@ -47,7 +49,12 @@ struct DestroyTmp;
 class CPPCodeGenerator final
 {
 public:
-  CPPCodeGenerator(std::string output_dir, std::string artifact_name);
+  /**
+   * @param output_dir Directory for artifact files
+   * @param artifact_name Name of artifact files
+   * @param num_threads Number of threads used by artifact for inference
+   */
+  CPPCodeGenerator(std::string output_dir, std::string artifact_name, int32_t num_threads = 1);
 
   /**
    * @brief Method represents base generation sequence: analysis, serialization, header/code
@@ -103,6 +110,14 @@ private:
    * @param call Action to generate code from
    */
   void materializeCall(std::ostream &out, const ModelAnalyzer &ma, const sir::CallFunction *call);
+  /**
+   * @brief Generate code for fused chain of elementwise operations
+   * @param out Output stream to print
+   * @param ma Intermediate model representation
+   * @param call Action to generate code from
+   */
+  void materializeFusedElementwise(std::ostream &out, const ModelAnalyzer &ma,
+                                   const sir::FusedElementwise *call);
   /**
    * @brief Generate code for transpose action
    * @param out Output stream to print
@@ -154,6 +169,7 @@ private:
 
   std::string _output_dir;
   std::string _artifact_name;
+  int32_t _num_threads;
   std::vector<std::string> _formattedTensors;
 };
 
@@ -550,6 +550,8 @@ void checkInDir(const Option<std::string> &dir);
 
 void checkOutDir(const Option<std::string> &dir);
 
+void checkNumThreads(const Option<int32_t> &num_threads);
+
 } // namespace cli
 } // namespace nnc
 
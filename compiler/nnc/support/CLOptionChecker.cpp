@@ -70,5 +70,12 @@ void checkOutDir(const Option<std::string> &dir)
   closedir(stream);
 } // checkOutDir
 
+void checkNumThreads(const Option<int32_t> &num_threads)
+{
+  if (num_threads < 1)
+    throw BadOption("Number of threads should be positive");
+
+} // checkNumThreads
+
 } // namespace cli
 } // namespace nnc
@@ -122,4 +122,18 @@ TEST(SOFT_BACKEND, tensor)
       {
         ASSERT_EQ(t3.at({k, i, j}), t4.at({k, i, j}));
       }
+
+  // test tensor in external buffer
+  std::vector<float> buffer(tensor2_height * tensor2_width);
+  Tensor t5(Shape{tensor2_height, tensor2_width}, buffer.data(), buffer.size());
+  t5.reshape(Shape{tensor2_width, tensor2_height});
+  ASSERT_EQ(t5.getData(), buffer.data());
+  t5.reshape(Shape{tensor2_width});
+  ASSERT_EQ(t5.getData(), buffer.data());
+  t5.fillData(data_ptr, tensor2_width);
+  ASSERT_EQ(buffer[0], data[0]);
+// This check must be performed only if assertions are enabled
+#ifndef NDEBUG
+  ASSERT_DEATH(t5.reshape(Shape{tensor2_height + 1, tensor2_width}), "");
+#endif
 }
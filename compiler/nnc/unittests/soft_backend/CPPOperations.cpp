@@ -25,6 +25,9 @@
 
 #include "code_snippets/cpp_header_types.def"
 #include "code_snippets/cpp_common_funcs.def"
+// operations are run on several threads to check splitting of parallel loops
+#define NNC_NUM_THREADS 3
+#include "code_snippets/cpp_thread_pool.def"
 
 #include "code_snippets/cpp_broadcast.def"
 #include "code_snippets/cpp_capped_relu.def"
@@ -829,6 +832,7 @@ TEST(cpp_operations_test, reduceMeanTst)
   // test prerequisites
   // different test cases
   std::vector<int> test_axis_list[] = {{2, 3}, {1}, {0}, {2}, {3}, {0, 2}, {1, 2, 3}};
+  Tensor temporary(Shape({2 * 3 * 4 * 5}));
   for (const vector<int> &axis_list : test_axis_list)
   {
     for (const bool keep_dims : {true, false})
@@ -843,7 +847,7 @@ TEST(cpp_operations_test, reduceMeanTst)
         return op;
       };
 
-      createAndRunTestGraph(op_generator, reduceMean, input_ntensors, input_atensor);
+      createAndRunTestGraph(op_generator, reduceMean, input_ntensors, input_atensor, temporary);
     }
   }
 }
@@ -16,12 +16,19 @@
 
 #include "ModelAnalyzer.h"
 #include "mir/Graph.h"
+#include "mir/ops/AddOp.h"
+#include "mir/ops/ConcatOp.h"
+#include "mir/ops/ConstantOp.h"
 #include "mir/ops/InputOp.h"
 #include "mir/ops/ReluOp.h"
-#include "mir/ops/ConcatOp.h"
+#include "mir/ops/SigmoidOp.h"
+#include "mir/ops/SubOp.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <map>
+
 using namespace std;
 using namespace nnc;
 using namespace mir;
@@ -81,3 +88,97 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+/*
+ * This test designed to check that temporary tensors with disjoint lifetimes share memory
+ */
+TEST(ModelAnalyzer, arena_planning)
+{
+  mir::Graph g;
+  /*
+   * Create graph of operations that are not fused:
+   * [input] -> [concat1] -> [concat2] -> [concat3] -> [output]
+   */
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  auto create_concat = [&g](Operation *arg) {
+    return g.create<ops::ConcatOp>(vector<Operation::Output *>{arg->getOutput(0)}, 0);
+  };
+  Operation *concat1 = create_concat(input);
+  Operation *concat2 = create_concat(concat1);
+  Operation *concat3 = create_concat(concat2);
+  Operation *output = create_concat(concat3);
+  input->getOutput(0)->setName("input");
+  output->getOutput(0)->setName("output");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  map<Operation *, const TensorDescriptor *> op_outputs;
+  for (const auto &action : ma.getInferenceSequence())
+  {
+    const CallFunction *call = getCall(action);
+    if (call != nullptr && !call->outputs.empty())
+      op_outputs[call->mirOp] = &ma.getTensors()[call->outputs[0]];
+  }
+
+  // output of concat1 is dead when concat3 produces its output
+  ASSERT_EQ(op_outputs[concat1]->type, TensorDescriptor::Type::temporary);
+  ASSERT_EQ(op_outputs[concat1]->arena_offset, op_outputs[concat3]->arena_offset);
+  ASSERT_NE(op_outputs[concat1]->arena_offset, op_outputs[concat2]->arena_offset);
+  ASSERT_EQ(op_outputs[output]->arena_offset, INVALID_ARENA_OFFSET);
+  // two tensors of 6 elements aligned to 4 elements
+  ASSERT_EQ(ma.getArenaSize(), 16u);
+}
+
+/*
+ * This test designed to check that chains of elementwise operations are fused into single call
+ */
+TEST(ModelAnalyzer, elementwise_fusion)
+{
+  mir::Graph g;
+  /*
+   * Create graph:
+   * [input] -> [add] -> [relu] -> [sigmoid] -> output1
+   *    |         ^
+   *    |      [bias]
+   *    +-----> [sub] -> [relu] -> output2
+   *              ^
+   *           [bias]
+   */
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *bias = g.create<ops::ConstantOp>(TensorVariant(DataType::FLOAT32, Shape{3}));
+  Operation *add = g.create<ops::AddOp>(input->getOutput(0), bias->getOutput(0));
+  Operation *relu1 = g.create<ops::ReluOp>(add->getOutput(0));
+  Operation *sigmoid = g.create<ops::SigmoidOp>(relu1->getOutput(0));
+  // constant on the left side of subtraction can not be fused
+  Operation *sub = g.create<ops::SubOp>(bias->getOutput(0), input->getOutput(0));
+  Operation *relu2 = g.create<ops::ReluOp>(sub->getOutput(0));
+  input->getOutput(0)->setName("input");
+  sigmoid->getOutput(0)->setName("output1");
+  relu2->getOutput(0)->setName("output2");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  vector<const FusedElementwise *> fused_calls;
+  size_t num_calls = 0;
+  for (const auto &action : ma.getInferenceSequence())
+  {
+    if (const auto *fused = dynamic_cast<const FusedElementwise *>(action.get()))
+      fused_calls.push_back(fused);
+    if (getCall(action) != nullptr)
+      ++num_calls;
+  }
+  // input, bias, fused chain, sub and relu
+  ASSERT_EQ(num_calls, 5u);
+  ASSERT_EQ(fused_calls.size(), 1u);
+
+  const FusedElementwise *fused = fused_calls.front();
+  ASSERT_EQ(fused->ops, (vector<Operation *>{add, relu1, sigmoid}));
+  ASSERT_EQ(fused->mirOp, sigmoid);
+  ASSERT_EQ(fused->inputs.size(), 2u);
+  ASSERT_EQ(ma.getTensors()[fused->inputs[0]].name, "input");
+  ASSERT_EQ(ma.getTensors()[fused->outputs[0]].name, "output1");
+}
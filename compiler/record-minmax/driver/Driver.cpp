@@ -80,7 +80,7 @@ int entry(const int argc, char **argv)
   arser.add_argument("--mode")
     .nargs(1)
     .type(arser::DataType::STR)
-    .help("Record mode. percentile (default) or moving_average");
+    .help("Record mode. percentile (default), moving_average, histogram or entropy");
 
   arser.add_argument("--input_data_format")
     .nargs(1)
@@ -93,6 +93,13 @@ int entry(const int argc, char **argv)
     .default_value(false)
     .help("This will turn on profiling data generation.");
 
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .required(false)
+    .default_value(1)
+    .help("Number of threads to run inference of input data. Default is 1");
+
   try
   {
     arser.parse(argc, argv);
@@ -131,7 +138,8 @@ int entry(const int argc, char **argv)
   if (arser["--mode"])
     mode = arser.get<std::string>("--mode");
 
-  if (mode != "percentile" && mode != "moving_average")
+  if (mode != "percentile" && mode != "moving_average" && mode != "histogram" &&
+      mode != "entropy")
     throw std::runtime_error("Unsupported mode");
 
   if (arser["--generate_profile_data"])
@@ -140,7 +148,11 @@ int entry(const int argc, char **argv)
   if (arser["--input_data_format"])
     input_data_format = arser.get<std::string>("--input_data_format");
 
-  RecordMinMax rmm;
+  auto num_threads = arser.get<int32_t>("--num_threads");
+  if (num_threads < 1)
+    throw std::runtime_error("The number of threads must be greater than zero");
+
+  RecordMinMax rmm(static_cast<uint32_t>(num_threads));
 
   // Initialize interpreter and observer
   rmm.initialize(input_model_path);
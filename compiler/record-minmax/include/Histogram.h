@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HISTOGRAM_H__
+#define __RECORD_MINMAX_HISTOGRAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Histogram with fixed number of bins, which covers [-range, range]
+ *
+ * @note  range is a power of two. When a value out of range is added, range is doubled
+ *        (merging each two adjacent bins) until it covers the value.
+ *        So memory does not grow with the number of added values.
+ */
+class Histogram
+{
+public:
+  static constexpr uint32_t NUM_BINS = 2048;
+
+public:
+  // Add values of data. min/max are the smallest/largest ones in data to be added.
+  // NaN and the lowest float are skipped, the same as recording min/max.
+  void add(const float *data, uint32_t size, float min, float max);
+
+  void add(float value) { add(&value, 1, value, value); }
+
+  void merge(const Histogram &other);
+
+  uint64_t count(void) const { return _count; }
+  float range(void) const { return _range; }
+  float min(void) const { return _min; }
+  float max(void) const { return _max; }
+  const std::vector<uint64_t> &bins(void) const { return _bins; }
+
+private:
+  void grow(float range);
+
+private:
+  float _range = 0.0f;
+  std::vector<uint64_t> _bins;
+  uint64_t _count = 0;
+  float _min = 0.0f;
+  float _max = 0.0f;
+};
+
+/**
+ * @brief  getHistogramPercentile calculates the n-th percentile of values added to histogram
+ *         (0.0 <= n <= 100.0), linear interpolation is used inside a bin
+ */
+float getHistogramPercentile(const Histogram &hist, float percentile);
+
+/**
+ * @brief  getEntropyThreshold returns the threshold of absolute values which minimizes
+ *         KL divergence between the distribution of values clipped by the threshold and
+ *         its quantized one with num_quantized_bins levels
+ */
+float getEntropyThreshold(const Histogram &hist, uint32_t num_quantized_bins = 128);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HISTOGRAM_H__
@@ -20,6 +20,8 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
+#include "Histogram.h"
+
 #include <vector>
 #include <unordered_map>
 
@@ -32,6 +34,15 @@ struct MinMaxVectors
   std::vector<float> max_vector;
 };
 
+struct MinMaxHistograms
+{
+  // min/max of each record
+  Histogram min_hist;
+  Histogram max_hist;
+  // all values of all records
+  Histogram value_hist;
+};
+
 class MinMaxMap
 {
 public:
@@ -43,13 +54,50 @@ public:
     vectors.max_vector.push_back(max);
   }
 
+  // Record min/max and values of node to histograms, whose size does not grow with records
+  void recordHistogram(const luci::CircleNode *node, const float *data, uint32_t size, float min,
+                       float max)
+  {
+    MinMaxHistograms &histograms = _histogram_map[node];
+    histograms.min_hist.add(min);
+    histograms.max_hist.add(max);
+    histograms.value_hist.add(data, size, min, max);
+  }
+
+  // Append min/max recorded in other, which are recorded after ones in this
+  void appendMinMax(const MinMaxMap &other)
+  {
+    for (const auto &item : other._minmax_map)
+    {
+      MinMaxVectors &vectors = _minmax_map[item.first];
+      const MinMaxVectors &others = item.second;
+      vectors.min_vector.insert(vectors.min_vector.end(), others.min_vector.begin(),
+                                others.min_vector.end());
+      vectors.max_vector.insert(vectors.max_vector.end(), others.max_vector.begin(),
+                                others.max_vector.end());
+    }
+    for (const auto &item : other._histogram_map)
+    {
+      MinMaxHistograms &histograms = _histogram_map[item.first];
+      histograms.min_hist.merge(item.second.min_hist);
+      histograms.max_hist.merge(item.second.max_hist);
+      histograms.value_hist.merge(item.second.value_hist);
+    }
+  }
+
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
   {
     return &_minmax_map;
   }
 
+  const std::unordered_map<const luci::CircleNode *, MinMaxHistograms> *getHistogramMap() const
+  {
+    return &_histogram_map;
+  }
+
 private:
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  std::unordered_map<const luci::CircleNode *, MinMaxHistograms> _histogram_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
@@ -65,8 +113,12 @@ public:
 
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  // Record to histograms instead of min/max vectors
+  void recordHistogram(bool enable) { _record_histogram = enable; }
+
 private:
   MinMaxMap _minmax_data;
+  bool _record_histogram = false;
 };
 
 } // namespace record_minmax
@@ -22,7 +22,9 @@
 
 #include "MinMaxObserver.h"
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace record_minmax
 {
@@ -32,6 +34,9 @@ class RecordMinMax
 public:
   explicit RecordMinMax() = default;
 
+  // Records are sharded across num_threads worker threads, each with its own interpreter
+  explicit RecordMinMax(uint32_t num_threads) : _num_threads(num_threads) {}
+
   ~RecordMinMax() = default;
 
   void initialize(const std::string &input_model_path);
@@ -51,9 +56,23 @@ public:
   void saveModel(const std::string &output_model_path);
 
 private:
+  using WriteInputs = std::function<void(uint32_t record_idx, luci_interpreter::Interpreter *)>;
+
+  // Run records [0, num_records) with worker threads, 'write_inputs' sets inputs of a record
+  void runRecords(uint32_t num_records, const WriteInputs &write_inputs);
+
+  // Set what observers record for mode
+  void prepareObservers(const std::string &mode);
+
+  // Min/max of all workers, in order of records
+  MinMaxMap mergedMinMax(void) const;
+
+private:
+  uint32_t _num_threads = 1;
   std::unique_ptr<luci::Module> _module;
-  std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
-  std::unique_ptr<MinMaxObserver> _observer;
+  // Interpreter and observer of each worker thread, sharing _module
+  std::vector<std::unique_ptr<luci_interpreter::Interpreter>> _interpreters;
+  std::vector<std::unique_ptr<MinMaxObserver>> _observers;
 };
 
 } // namespace record_minmax
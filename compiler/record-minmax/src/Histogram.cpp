@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+// Range of histogram which has only zeros
+const float MIN_RANGE = std::ldexp(1.0f, -32);
+// The largest power of two in float
+const float MAX_RANGE = std::ldexp(1.0f, 127);
+
+// Return the smallest power of two larger than value, in [MIN_RANGE, MAX_RANGE]
+float power_of_two_range(float value)
+{
+  if (!(value < MAX_RANGE))
+    return MAX_RANGE;
+
+  int exp = 0;
+  std::frexp(value, &exp);
+  return std::max(MIN_RANGE, std::ldexp(1.0f, exp));
+}
+
+double kl_divergence(const std::vector<double> &p, const std::vector<double> &q, uint32_t size)
+{
+  double p_sum = 0.0;
+  double q_sum = 0.0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    p_sum += p[i];
+    q_sum += q[i];
+  }
+  if (p_sum == 0.0 || q_sum == 0.0)
+    return std::numeric_limits<double>::infinity();
+
+  // Probability of empty bin in q, not to make divergence infinite
+  const double epsilon = 1e-4;
+
+  double divergence = 0.0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    if (p[i] == 0.0)
+      continue;
+
+    const double p_i = p[i] / p_sum;
+    const double q_i = std::max(q[i] / q_sum, epsilon);
+    divergence += p_i * std::log(p_i / q_i);
+  }
+  return divergence;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+constexpr uint32_t Histogram::NUM_BINS;
+
+void Histogram::add(const float *data, uint32_t size, float min, float max)
+{
+  // Nothing to add (all values are NaN or the lowest float)
+  if (min > max)
+    return;
+
+  grow(power_of_two_range(std::max(std::abs(min), std::abs(max))));
+
+  const double scale = NUM_BINS / (2.0 * _range);
+  const double last_bin = NUM_BINS - 1;
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    const float value = data[i];
+    if (std::isnan(value) || value == std::numeric_limits<float>::lowest())
+      continue;
+
+    const double pos = (static_cast<double>(value) + _range) * scale;
+    const auto bin = static_cast<uint32_t>(std::min(std::max(pos, 0.0), last_bin));
+    _bins[bin]++;
+    count++;
+  }
+
+  if (_count == 0)
+  {
+    _min = min;
+    _max = max;
+  }
+  else
+  {
+    _min = std::min(_min, min);
+    _max = std::max(_max, max);
+  }
+  _count += count;
+}
+
+void Histogram::merge(const Histogram &other)
+{
+  if (other._count == 0)
+    return;
+
+  if (_count == 0)
+  {
+    *this = other;
+    return;
+  }
+
+  // Ranges are powers of two, so one covers the other exactly after growing
+  Histogram grown = other;
+  grown.grow(_range);
+  grow(grown._range);
+
+  for (uint32_t i = 0; i < NUM_BINS; ++i)
+    _bins[i] += grown._bins[i];
+
+  _count += grown._count;
+  _min = std::min(_min, grown._min);
+  _max = std::max(_max, grown._max);
+}
+
+void Histogram::grow(float range)
+{
+  if (_bins.empty())
+  {
+    _range = range;
+    _bins.assign(NUM_BINS, 0);
+    return;
+  }
+
+  while (_range < range)
+  {
+    // Bins of [-range, range] become the central half of [-2 * range, 2 * range]
+    std::vector<uint64_t> bins(NUM_BINS, 0);
+    for (uint32_t i = 0; i < NUM_BINS; ++i)
+      bins[NUM_BINS / 4 + i / 2] += _bins[i];
+
+    _bins.swap(bins);
+    _range *= 2.0f;
+  }
+}
+
+float getHistogramPercentile(const Histogram &hist, float percentile)
+{
+  if (percentile < 0 || percentile > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (hist.count() == 0)
+    throw std::runtime_error("Percentile must take a non-empty histogram as an argument");
+
+  if (percentile == 0.0)
+    return hist.min();
+
+  if (percentile == 100.0)
+    return hist.max();
+
+  const auto &bins = hist.bins();
+  const double bin_width = 2.0 * hist.range() / Histogram::NUM_BINS;
+  const double target = hist.count() * percentile / 100.0;
+
+  double cumulative = 0.0;
+  for (uint32_t i = 0; i < Histogram::NUM_BINS; ++i)
+  {
+    if (bins[i] == 0)
+      continue;
+
+    if (cumulative + bins[i] >= target)
+    {
+      const double fraction = (target - cumulative) / bins[i];
+      const double value = -hist.range() + (i + fraction) * bin_width;
+      return std::min(std::max(static_cast<float>(value), hist.min()), hist.max());
+    }
+    cumulative += bins[i];
+  }
+  return hist.max();
+}
+
+float getEntropyThreshold(const Histogram &hist, uint32_t num_quantized_bins)
+{
+  if (hist.count() == 0)
+    throw std::runtime_error("Entropy threshold must take a non-empty histogram as an argument");
+
+  const uint32_t num_abs_bins = Histogram::NUM_BINS / 2;
+  if (num_quantized_bins == 0 || num_quantized_bins > num_abs_bins)
+    throw std::runtime_error("Wrong number of quantized bins");
+
+  // Histogram of absolute values, which covers [0, range]
+  const auto &bins = hist.bins();
+  std::vector<double> abs_bins(num_abs_bins);
+  for (uint32_t i = 0; i < num_abs_bins; ++i)
+    abs_bins[i] = static_cast<double>(bins[num_abs_bins + i]) + bins[num_abs_bins - 1 - i];
+
+  double outliers = 0.0;
+  for (uint32_t i = num_quantized_bins; i < num_abs_bins; ++i)
+    outliers += abs_bins[i];
+
+  std::vector<double> p(num_abs_bins);
+  std::vector<double> q(num_abs_bins);
+  double best_divergence = std::numeric_limits<double>::infinity();
+  uint32_t best_num_bins = num_abs_bins;
+  for (uint32_t num_bins = num_quantized_bins; num_bins <= num_abs_bins; ++num_bins)
+  {
+    // Reference distribution, values beyond threshold are clipped into the last bin
+    std::copy(abs_bins.begin(), abs_bins.begin() + num_bins, p.begin());
+    p[num_bins - 1] += outliers;
+    if (num_bins < num_abs_bins)
+      outliers = std::max(0.0, outliers - abs_bins[num_bins]);
+
+    // Quantized distribution of values under threshold, expanded to num_bins over bins
+    // non-empty in reference distribution
+    for (uint32_t j = 0; j < num_quantized_bins; ++j)
+    {
+      const uint32_t start = j * num_bins / num_quantized_bins;
+      const uint32_t end = (j + 1) * num_bins / num_quantized_bins;
+
+      double total = 0.0;
+      uint32_t non_empty = 0;
+      for (uint32_t k = start; k < end; ++k)
+      {
+        total += abs_bins[k];
+        if (p[k] > 0.0)
+          non_empty++;
+      }
+      for (uint32_t k = start; k < end; ++k)
+        q[k] = p[k] > 0.0 ? total / non_empty : 0.0;
+    }
+
+    const double divergence = kl_divergence(p, q, num_bins);
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best_num_bins = num_bins;
+    }
+  }
+
+  const double bin_width = static_cast<double>(hist.range()) / num_abs_bins;
+  return static_cast<float>(best_num_bins * bin_width);
+}
+
+} // namespace record_minmax
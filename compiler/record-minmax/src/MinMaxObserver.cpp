@@ -20,8 +20,89 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 using DataType = luci_interpreter::DataType;
 
+namespace
+{
+
+// Find min/max of data, skipping NaN and the lowest float
+// Return false if there is no value left
+bool getMinMax(const float *data, uint32_t size, float &min, float &max)
+{
+  // TODO use metadata hints to detect the lowest float cases
+  const float lowest = std::numeric_limits<float>::lowest();
+  const float largest = std::numeric_limits<float>::max();
+
+  min = largest;
+  max = lowest;
+
+  uint32_t i = 0;
+#if defined(__SSE2__)
+  const __m128 lowest_v = _mm_set1_ps(lowest);
+  const __m128 largest_v = _mm_set1_ps(largest);
+  __m128 min_v = largest_v;
+  __m128 max_v = lowest_v;
+  for (; i + 4 <= size; i += 4)
+  {
+    const __m128 x = _mm_loadu_ps(data + i);
+    // The lowest float should not be min, the largest one does not change min
+    const __m128 is_lowest = _mm_cmpeq_ps(x, lowest_v);
+    const __m128 x_for_min =
+      _mm_or_ps(_mm_and_ps(is_lowest, largest_v), _mm_andnot_ps(is_lowest, x));
+    // NOTE min/max return the second operand if either is NaN, so NaN is skipped
+    min_v = _mm_min_ps(x_for_min, min_v);
+    max_v = _mm_max_ps(x, max_v);
+  }
+  float min_lanes[4];
+  float max_lanes[4];
+  _mm_storeu_ps(min_lanes, min_v);
+  _mm_storeu_ps(max_lanes, max_v);
+  for (uint32_t lane = 0; lane < 4; ++lane)
+  {
+    min = std::min(min, min_lanes[lane]);
+    max = std::max(max, max_lanes[lane]);
+  }
+#elif defined(__aarch64__)
+  const float32x4_t lowest_v = vdupq_n_f32(lowest);
+  const float32x4_t largest_v = vdupq_n_f32(largest);
+  float32x4_t min_v = largest_v;
+  float32x4_t max_v = lowest_v;
+  for (; i + 4 <= size; i += 4)
+  {
+    const float32x4_t x = vld1q_f32(data + i);
+    // The lowest float should not be min, the largest one does not change min
+    const float32x4_t x_for_min = vbslq_f32(vceqq_f32(x, lowest_v), largest_v, x);
+    // NOTE minnm/maxnm return the number if one operand is NaN, so NaN is skipped
+    min_v = vminnmq_f32(x_for_min, min_v);
+    max_v = vmaxnmq_f32(x, max_v);
+  }
+  min = vminvq_f32(min_v);
+  max = vmaxvq_f32(max_v);
+#endif
+  for (; i < size; ++i)
+  {
+    const float x = data[i];
+    // Comparisons with NaN are false, so NaN is skipped
+    if (x < min && x != lowest)
+      min = x;
+    if (x > max)
+      max = x;
+  }
+
+  return min <= max;
+}
+
+} // namespace
+
 namespace record_minmax
 {
 
@@ -82,33 +163,17 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
+  float min = 0.0f;
+  float max = 0.0f;
+  if (!getMinMax(data, num_elements, min, max))
+    throw std::runtime_error("All values are NaN(Not a Number)");
 
-  bool all_nan = true;
-  for (auto number : buf)
+  if (_record_histogram)
   {
-    if (isnan(number))
-      continue;
-
-    // TODO use metadata hints to detect such cases
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
-
-    if (number > max)
-      max = number;
-
-    if (number < min)
-      min = number;
+    _minmax_data.recordHistogram(node, data, num_elements, min, max);
+    return;
   }
 
-  if (all_nan)
-    throw std::runtime_error("All values are NaN(Not a Number)");
-
   _minmax_data.recordMinMax(node, min, max);
 }
 
@@ -18,6 +18,7 @@
 #include "RecordFunction.h"
 #include "MinMaxObserver.h"
 #include "HDF5Importer.h"
+#include "Histogram.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
@@ -27,11 +28,14 @@
 #include <dirent.h>
 #include <algorithm>
 #include <cmath>
+#include <exception>
 #include <fstream>
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <mutex>
 #include <random>
+#include <thread>
 
 using Shape = luci_interpreter::Shape;
 using DataType = luci_interpreter::DataType;
@@ -108,10 +112,53 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
   }
 }
 
-void update_quantparam(record_minmax::MinMaxObserver *observer, const std::string &mode,
+void set_minmax(const luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+
+  assert(node->quantparam() == nullptr);
+
+  auto mutable_node = const_cast<luci::CircleNode *>(node);
+  mutable_node->quantparam(std::move(quantparam));
+}
+
+bool is_histogram_mode(const std::string &mode)
+{
+  return mode == "histogram" || mode == "entropy";
+}
+
+void update_quantparam(const record_minmax::MinMaxMap &minmax_data, const std::string &mode,
                        float min_percentile, float max_percentile)
 {
-  auto minmax_map = observer->minMaxData()->getMap();
+  if (is_histogram_mode(mode))
+  {
+    auto histogram_map = minmax_data.getHistogramMap();
+    for (auto iter = histogram_map->begin(); iter != histogram_map->end(); ++iter)
+    {
+      auto node = iter->first;
+      const auto &histograms = iter->second;
+
+      float min{0.0f}, max{0.0f};
+      if (mode == "histogram")
+      {
+        min = record_minmax::getHistogramPercentile(histograms.min_hist, min_percentile);
+        max = record_minmax::getHistogramPercentile(histograms.max_hist, max_percentile);
+      }
+      else if (mode == "entropy")
+      {
+        const auto &value_hist = histograms.value_hist;
+        const auto threshold = record_minmax::getEntropyThreshold(value_hist);
+        min = std::max(-threshold, value_hist.min());
+        max = std::min(threshold, value_hist.max());
+      }
+      set_minmax(node, min, max);
+    }
+    return;
+  }
+
+  auto minmax_map = minmax_data.getMap();
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
@@ -129,14 +176,7 @@ void update_quantparam(record_minmax::MinMaxObserver *observer, const std::strin
       max = record_minmax::getMovingAverage(minmax.max_vector, 0.9, 16, false);
     }
     assert(mode == "percentile" || mode == "moving_average");
-    auto quantparam = std::make_unique<luci::CircleQuantParam>();
-    quantparam->min.push_back(min);
-    quantparam->max.push_back(max);
-
-    assert(node->quantparam() == nullptr);
-
-    auto mutable_node = const_cast<luci::CircleNode *>(node);
-    mutable_node->quantparam(std::move(quantparam));
+    set_minmax(node, min, max);
   }
 }
 
@@ -171,12 +211,89 @@ void RecordMinMax::initialize(const std::string &input_model_path)
     throw std::runtime_error("Failed to load '" + input_model_path + "'");
   }
 
-  // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  if (_num_threads == 0)
+    throw std::runtime_error("Number of threads must be positive");
+
+  // Cores are divided among workers, as kernels of each interpreter run on its own threads
+  const uint32_t num_cores = std::max(1u, std::thread::hardware_concurrency());
+  const auto kernel_threads = static_cast<int>(std::max(1u, num_cores / _num_threads));
+
+  // Initialize interpreters of workers. They only read _module, which is shared.
+  for (uint32_t t = 0; t < _num_threads; ++t)
+  {
+    auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+    interpreter->setNumThreads(kernel_threads);
+    auto observer = std::make_unique<MinMaxObserver>();
+
+    interpreter->attachObserver(observer.get());
 
-  _observer = std::make_unique<MinMaxObserver>();
+    _interpreters.push_back(std::move(interpreter));
+    _observers.push_back(std::move(observer));
+  }
+}
+
+void RecordMinMax::runRecords(uint32_t num_records, const WriteInputs &write_inputs)
+{
+  assert(!_interpreters.empty());
+  const auto num_workers =
+    std::max(1u, std::min(static_cast<uint32_t>(_interpreters.size()), num_records));
+
+  auto run = [&](uint32_t worker) {
+    // Each worker runs contiguous records, so that min/max merged in order of workers
+    // are in the same order as running all records serially
+    const uint32_t begin = static_cast<uint64_t>(num_records) * worker / num_workers;
+    const uint32_t end = static_cast<uint64_t>(num_records) * (worker + 1) / num_workers;
+    auto interpreter = _interpreters.at(worker).get();
+    for (uint32_t record_idx = begin; record_idx < end; ++record_idx)
+    {
+      write_inputs(record_idx, interpreter);
+      interpreter->interpret();
+    }
+  };
+
+  if (num_workers == 1)
+  {
+    run(0);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> errors(num_workers);
+  for (uint32_t worker = 0; worker < num_workers; ++worker)
+  {
+    threads.emplace_back([&run, &errors, worker]() {
+      try
+      {
+        run(worker);
+      }
+      catch (...)
+      {
+        errors[worker] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+void RecordMinMax::prepareObservers(const std::string &mode)
+{
+  for (auto &observer : _observers)
+    observer->recordHistogram(is_histogram_mode(mode));
+}
 
-  _interpreter->attachObserver(_observer.get());
+MinMaxMap RecordMinMax::mergedMinMax(void) const
+{
+  MinMaxMap merged;
+  for (const auto &observer : _observers)
+    merged.appendMinMax(*observer->minMaxData());
+  return merged;
 }
 
 // input_data_path is a path to the directory
@@ -187,6 +304,8 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
                                            const std::string &input_data_path, float min_percentile,
                                            float max_percentile)
 {
+  prepareObservers(mode);
+
   struct dirent *entry = nullptr;
   DIR *dp = nullptr;
 
@@ -195,7 +314,6 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     throw std::runtime_error("Cannot open directory. Please check \"" + input_data_path +
                              "\" is a directory.\n");
 
-  uint32_t num_records = 0;
   const auto input_nodes = loco::input_nodes(_module->graph());
 
   // Get total input size
@@ -206,20 +324,34 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     total_input_size += getTensorSize(input_node);
   }
 
+  std::vector<std::string> records;
   while (entry = readdir(dp))
   {
     // Skip if the entry is not a regular file
     if (entry->d_type != DT_REG)
       continue;
 
-    const std::string filename = entry->d_name;
-    std::cout << "Recording " << num_records << "'th data" << std::endl;
+    records.emplace_back(input_data_path + "/" + entry->d_name);
+  }
+
+  closedir(dp);
+
+  const auto num_records = static_cast<uint32_t>(records.size());
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  std::mutex cout_mutex;
+  runRecords(num_records, [&](uint32_t record_idx, luci_interpreter::Interpreter *interpreter) {
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << "Recording " << record_idx << "'th data" << std::endl;
+    }
 
     // Read data from file to buffer
     // Assumption: For a multi-input model, the binary file should have inputs concatenated in the
     // same order with the input index.
     std::vector<char> input_data(total_input_size);
-    readDataFromFile(input_data_path + "/" + filename, input_data, total_input_size);
+    readDataFromFile(records[record_idx], input_data, total_input_size);
 
     // Write data from buffer to interpreter
     uint32_t offset = 0;
@@ -227,24 +359,15 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     {
       const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
       const auto input_size = getTensorSize(input_node);
-      _interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
+      interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
 
       offset += input_size;
     }
-
-    _interpreter->interpret();
-
-    num_records++;
-  }
-
-  closedir(dp);
-
-  if (num_records == 0)
-    throw std::runtime_error("The input data file does not contain any record.");
+  });
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(mergedMinMax(), mode, min_percentile, max_percentile);
 }
 
 // input_data_path is a text file which specifies the representative data
@@ -256,12 +379,12 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
 void RecordMinMax::profileRawData(const std::string &mode, const std::string &input_data_path,
                                   float min_percentile, float max_percentile)
 {
+  prepareObservers(mode);
+
   std::ifstream input_file(input_data_path);
   if (input_file.fail())
     throw std::runtime_error("Cannot open file \"" + input_data_path + "\".\n");
 
-  std::string record;
-  uint32_t num_records = 0;
   const auto input_nodes = loco::input_nodes(_module->graph());
 
   // Get total input size
@@ -272,15 +395,27 @@ void RecordMinMax::profileRawData(const std::string &mode, const std::string &in
     total_input_size += getTensorSize(input_node);
   }
 
+  std::string record;
+  std::vector<std::string> records;
   while (getline(input_file, record))
-  {
-    std::cout << "Recording " << num_records << "'th data" << std::endl;
+    records.push_back(record);
+
+  const auto num_records = static_cast<uint32_t>(records.size());
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  std::mutex cout_mutex;
+  runRecords(num_records, [&](uint32_t record_idx, luci_interpreter::Interpreter *interpreter) {
+    {
+      std::lock_guard<std::mutex> lock(cout_mutex);
+      std::cout << "Recording " << record_idx << "'th data" << std::endl;
+    }
 
     // Read data from file to buffer
     // Assumption: For a multi-input model, the binary file should have inputs concatenated in the
     // same order with the input index.
     std::vector<char> input_data(total_input_size);
-    readDataFromFile(record, input_data, total_input_size);
+    readDataFromFile(records[record_idx], input_data, total_input_size);
 
     // Write data from buffer to interpreter
     uint32_t offset = 0;
@@ -288,27 +423,22 @@ void RecordMinMax::profileRawData(const std::string &mode, const std::string &in
     {
       const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
       const auto input_size = getTensorSize(input_node);
-      _interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
+      interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
 
       offset += input_size;
     }
-
-    _interpreter->interpret();
-
-    num_records++;
-  }
-
-  if (num_records == 0)
-    throw std::runtime_error("The input data file does not contain any record.");
+  });
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(mergedMinMax(), mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::profileData(const std::string &mode, const std::string &input_data_path,
                                float min_percentile, float max_percentile)
 {
+  prepareObservers(mode);
+
   try
   {
     HDF5Importer importer(input_data_path);
@@ -323,8 +453,11 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-    {
+    // NOTE HDF5 library is not thread-safe, so reading is serialized
+    std::mutex importer_mutex;
+    runRecords(num_records, [&](uint32_t record_idx, luci_interpreter::Interpreter *interpreter) {
+      std::lock_guard<std::mutex> lock(importer_mutex);
+
       if (num_inputs != importer.numInputs(record_idx))
         throw std::runtime_error("Wrong number of inputs.");
 
@@ -353,11 +486,9 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
 
         // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
         //       We can redcue the copy by directly writing data from file to interpreter inputs
-        _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+        interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
       }
-
-      _interpreter->interpret();
-    }
+    });
 
     std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
   }
@@ -367,12 +498,14 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     throw std::runtime_error("HDF5 error occurred.");
   }
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(mergedMinMax(), mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float min_percentile,
                                                float max_percentile)
 {
+  prepareObservers(mode);
+
   // We use three randomly-generated records
   const uint32_t num_records = 3;
 
@@ -383,8 +516,11 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
   std::mt19937 gen(rd());
   std::uniform_real_distribution<> dist(-5, 5);
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-  {
+  // NOTE random generator is shared by workers
+  std::mutex gen_mutex;
+  runRecords(num_records, [&](uint32_t record_idx, luci_interpreter::Interpreter *interpreter) {
+    std::lock_guard<std::mutex> lock(gen_mutex);
+
     std::cout << "Recording " << record_idx << "'th data" << std::endl;
 
     for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
@@ -419,35 +555,33 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
 
         // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
         //       We can redcue the copy by directly writing data from file to interpreter inputs
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(float));
+        interpreter->writeInputTensor(input_node, input_data.data(),
+                                      input_data.size() * sizeof(float));
       }
       else if (input_node->dtype() == DataType::BOOL)
       {
         auto input_data = genRandomBoolData(gen, num_elements);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(uint8_t));
+        interpreter->writeInputTensor(input_node, input_data.data(),
+                                      input_data.size() * sizeof(uint8_t));
       }
       else if (input_node->dtype() == DataType::S32)
       {
         auto input_data = genRandomIntData<int32_t>(gen, num_elements, 0, 100);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(int32_t));
+        interpreter->writeInputTensor(input_node, input_data.data(),
+                                      input_data.size() * sizeof(int32_t));
       }
       else if (input_node->dtype() == DataType::S64)
       {
         auto input_data = genRandomIntData<int64_t>(gen, num_elements, 0, 100);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(int64_t));
+        interpreter->writeInputTensor(input_node, input_data.data(),
+                                      input_data.size() * sizeof(int64_t));
       }
     }
-
-    _interpreter->interpret();
-  }
+  });
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  update_quantparam(mergedMinMax(), mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
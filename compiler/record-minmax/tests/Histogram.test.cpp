@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+namespace
+{
+
+void addValues(Histogram &hist, const std::vector<float> &values)
+{
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  for (auto value : values)
+  {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+  hist.add(values.data(), values.size(), min, max);
+}
+
+} // namespace
+
+TEST(HistogramTest, Add)
+{
+  Histogram hist;
+  addValues(hist, {-1.5, 0.0, 0.5, 3.0});
+
+  EXPECT_EQ(4, hist.count());
+  EXPECT_EQ(4.0f, hist.range());
+  EXPECT_EQ(-1.5f, hist.min());
+  EXPECT_EQ(3.0f, hist.max());
+  EXPECT_EQ(Histogram::NUM_BINS, hist.bins().size());
+
+  SUCCEED();
+}
+
+TEST(HistogramTest, Grow)
+{
+  Histogram hist;
+  addValues(hist, {0.1, 0.2});
+  addValues(hist, {100.0});
+
+  EXPECT_EQ(3, hist.count());
+  EXPECT_EQ(128.0f, hist.range());
+  EXPECT_EQ(0.1f, hist.min());
+  EXPECT_EQ(100.0f, hist.max());
+
+  // Memory does not grow with added values
+  EXPECT_EQ(Histogram::NUM_BINS, hist.bins().size());
+
+  SUCCEED();
+}
+
+TEST(HistogramTest, Merge)
+{
+  Histogram hist1;
+  Histogram hist2;
+  Histogram hist_all;
+  addValues(hist1, {-0.3, 0.7});
+  addValues(hist2, {5.0, -9.0});
+  addValues(hist_all, {-0.3, 0.7, 5.0, -9.0});
+
+  hist1.merge(hist2);
+
+  EXPECT_EQ(hist_all.count(), hist1.count());
+  EXPECT_EQ(hist_all.range(), hist1.range());
+  EXPECT_EQ(hist_all.min(), hist1.min());
+  EXPECT_EQ(hist_all.max(), hist1.max());
+  EXPECT_EQ(hist_all.bins(), hist1.bins());
+
+  SUCCEED();
+}
+
+TEST(HistogramTest, SkipNaN)
+{
+  Histogram hist;
+  std::vector<float> values{NAN, 1.0, std::numeric_limits<float>::lowest()};
+  hist.add(values.data(), values.size(), 1.0, 1.0);
+
+  EXPECT_EQ(1, hist.count());
+
+  SUCCEED();
+}
+
+TEST(GetHistogramPercentileTest, Simple)
+{
+  Histogram hist;
+  std::vector<float> values;
+  for (int i = 0; i < 1000; i++)
+    values.push_back(i * 0.01f);
+  addValues(hist, values);
+
+  EXPECT_FLOAT_EQ(0.0f, getHistogramPercentile(hist, 0));
+  EXPECT_FLOAT_EQ(9.99f, getHistogramPercentile(hist, 100));
+  EXPECT_NEAR(0.1f, getHistogramPercentile(hist, 1), 0.02f);
+  EXPECT_NEAR(5.0f, getHistogramPercentile(hist, 50), 0.02f);
+  EXPECT_NEAR(9.9f, getHistogramPercentile(hist, 99), 0.02f);
+
+  SUCCEED();
+}
+
+TEST(GetHistogramPercentileTest, OutOfBoundary_NEG)
+{
+  Histogram hist;
+  hist.add(1.0f);
+
+  EXPECT_ANY_THROW(getHistogramPercentile(hist, -1));
+  EXPECT_ANY_THROW(getHistogramPercentile(hist, 101));
+
+  SUCCEED();
+}
+
+TEST(GetHistogramPercentileTest, EmptyHistogram_NEG)
+{
+  Histogram hist;
+
+  EXPECT_ANY_THROW(getHistogramPercentile(hist, 10));
+
+  SUCCEED();
+}
+
+TEST(GetEntropyThresholdTest, ClipOutlier)
+{
+  Histogram hist;
+  std::vector<float> values;
+  // Values are in [-1, 1], except a few outliers
+  for (int i = -1000; i <= 1000; i++)
+    values.push_back(i * 0.001f);
+  for (int i = 0; i < 3; i++)
+    values.push_back(3.0f + i * 0.1f);
+  addValues(hist, values);
+
+  auto threshold = getEntropyThreshold(hist);
+  EXPECT_GT(threshold, 0.9f);
+  EXPECT_LT(threshold, 3.0f);
+
+  SUCCEED();
+}
+
+TEST(GetEntropyThresholdTest, EmptyHistogram_NEG)
+{
+  Histogram hist;
+
+  EXPECT_ANY_THROW(getEntropyThreshold(hist));
+
+  SUCCEED();
+}
+
+} // namespace record_minmax
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ELEMENTWISE_ENGINE_H__
+#define __NNFW_CKER_ELEMENTWISE_ENGINE_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace elementwise
+{
+
+// Maximum rank after collapsing dims of the same broadcast pattern
+constexpr int kMaxDims = 8;
+// Minimum elements per thread for cheap ops such as add, compare and select
+constexpr int kMinElementsPerThread = 16384;
+// Minimum elements per thread for ops calling libm such as pow, sin and log
+constexpr int kMinTranscendentalElementsPerThread = 2048;
+
+// Output of N inputs broadcasting to output, where adjacent dims are merged while each input
+// keeps broadcasting or not broadcasting along them. The innermost stride of each input is
+// 1 (contiguous) or 0 (broadcast).
+template <int N> struct BroadcastPlan
+{
+  int rank = 0;
+  int dims[kMaxDims];
+  int64_t strides[N][kMaxDims];
+  int64_t size = 1;
+};
+
+template <int N>
+inline BroadcastPlan<N> MakeBroadcastPlan(const Shape *const (&input_shapes)[N],
+                                          const Shape &output_shape)
+{
+  BroadcastPlan<N> plan;
+  const int output_rank = output_shape.DimensionsCount();
+  uint32_t masks[kMaxDims];
+  uint32_t prev_mask = 0;
+  for (int i = 0; i < output_rank; ++i)
+  {
+    const int output_dim = output_shape.Dims(i);
+    if (output_dim == 1)
+      continue;
+
+    uint32_t mask = 0;
+    for (int k = 0; k < N; ++k)
+    {
+      const int offset = output_rank - input_shapes[k]->DimensionsCount();
+      assert(offset >= 0);
+      const int input_dim = (i < offset) ? 1 : input_shapes[k]->Dims(i - offset);
+      assert(input_dim == 1 || input_dim == output_dim);
+      if (input_dim != output_dim)
+        mask |= (1u << k);
+    }
+
+    if (plan.rank > 0 && mask == prev_mask)
+    {
+      plan.dims[plan.rank - 1] *= output_dim;
+    }
+    else
+    {
+      if (plan.rank == kMaxDims)
+        throw std::runtime_error{"Elementwise: too many broadcast dimensions"};
+      masks[plan.rank] = mask;
+      plan.dims[plan.rank++] = output_dim;
+    }
+    prev_mask = mask;
+    plan.size *= output_dim;
+  }
+
+  // Scalar output
+  if (plan.rank == 0)
+  {
+    masks[0] = 0;
+    plan.dims[plan.rank++] = 1;
+  }
+
+  for (int k = 0; k < N; ++k)
+  {
+    int64_t stride = 1;
+    for (int j = plan.rank - 1; j >= 0; --j)
+    {
+      const bool broadcast = masks[j] & (1u << k);
+      plan.strides[k][j] = broadcast ? 0 : stride;
+      if (!broadcast)
+        stride *= plan.dims[j];
+    }
+  }
+  return plan;
+}
+
+// Walk output elements in [begin, end) row by row of the innermost collapsed dim, and call
+// row_fn(input_offsets, output_offset, count) for each row.
+template <int N, typename RowFn>
+inline void ForEachRow(const BroadcastPlan<N> &plan, int64_t begin, int64_t end,
+                       const RowFn &row_fn)
+{
+  if (begin >= end)
+    return;
+
+  const int last = plan.rank - 1;
+  int64_t index[kMaxDims];
+  int64_t offsets[N] = {};
+  int64_t remain = begin;
+  for (int j = last; j >= 0; --j)
+  {
+    index[j] = remain % plan.dims[j];
+    remain /= plan.dims[j];
+    for (int k = 0; k < N; ++k)
+      offsets[k] += index[j] * plan.strides[k][j];
+  }
+
+  int64_t pos = begin;
+  while (pos < end)
+  {
+    const int64_t count = std::min<int64_t>(plan.dims[last] - index[last], end - pos);
+    row_fn(offsets, pos, count);
+    pos += count;
+
+    // Advance to the next row
+    for (int k = 0; k < N; ++k)
+      offsets[k] += count * plan.strides[k][last];
+    index[last] += count;
+    for (int j = last; j > 0 && index[j] == plan.dims[j]; --j)
+    {
+      index[j] = 0;
+      ++index[j - 1];
+      for (int k = 0; k < N; ++k)
+        offsets[k] += plan.strides[k][j - 1] - plan.dims[j] * plan.strides[k][j];
+    }
+  }
+}
+
+template <typename RangeFn> struct RangeWorkerTask : cpu_backend_threadpool::Task
+{
+  RangeWorkerTask(const RangeFn &fn, int64_t begin, int64_t end)
+    : fn_(fn), begin_(begin), end_(end)
+  {
+  }
+
+  void Run() override { fn_(begin_, end_); }
+
+private:
+  const RangeFn &fn_;
+  int64_t begin_;
+  int64_t end_;
+};
+
+// Split [0, size) into contiguous ranges over the threads of ruy_context, keeping at least
+// min_elements_per_thread elements in each range. range_fn must not throw when it runs on
+// multiple threads.
+template <typename RangeFn>
+inline void ParallelFor(int64_t size, ruy::Context *ruy_context, const RangeFn &range_fn,
+                        int64_t min_elements_per_thread = kMinElementsPerThread)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = static_cast<int>(
+    std::max<int64_t>(1, std::min<int64_t>(max_threads, size / min_elements_per_thread)));
+
+  if (thread_count == 1)
+  {
+    range_fn(int64_t{0}, size);
+    return;
+  }
+
+  std::vector<RangeWorkerTask<RangeFn>> tasks;
+  tasks.reserve(thread_count);
+  int64_t begin = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int64_t end = begin + (size - begin) / (thread_count - i);
+    tasks.emplace_back(range_fn, begin, end);
+    begin = end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+// Inner loops over a row of which input strides are 1 or 0. Each broadcast pattern is a
+// separate plain loop so that compilers can vectorize it.
+template <typename T1, typename T2, typename R, typename Fn>
+inline void BinaryRow(const T1 *input1, int64_t stride1, const T2 *input2, int64_t stride2,
+                      R *output, int64_t count, const Fn &fn)
+{
+  if (stride1 == 1 && stride2 == 1)
+  {
+    for (int64_t i = 0; i < count; ++i)
+      output[i] = fn(input1[i], input2[i]);
+  }
+  else if (stride1 == 0 && stride2 == 1)
+  {
+    const T1 scalar = *input1;
+    for (int64_t i = 0; i < count; ++i)
+      output[i] = fn(scalar, input2[i]);
+  }
+  else if (stride1 == 1 && stride2 == 0)
+  {
+    const T2 scalar = *input2;
+    for (int64_t i = 0; i < count; ++i)
+      output[i] = fn(input1[i], scalar);
+  }
+  else
+  {
+    std::fill_n(output, count, fn(*input1, *input2));
+  }
+}
+
+template <typename T1, typename T2, typename T3, typename R, typename Fn>
+inline void TernaryRow(const T1 *input1, int64_t stride1, const T2 *input2, int64_t stride2,
+                       const T3 *input3, int64_t stride3, R *output, int64_t count, const Fn &fn)
+{
+  if (stride1 == 1 && stride2 == 1 && stride3 == 1)
+  {
+    for (int64_t i = 0; i < count; ++i)
+      output[i] = fn(input1[i], input2[i], input3[i]);
+  }
+  else
+  {
+    for (int64_t i = 0; i < count; ++i)
+      output[i] = fn(input1[i * stride1], input2[i * stride2], input3[i * stride3]);
+  }
+}
+
+// output[i] = fn(input[i]) over a flat range
+template <typename T, typename R, typename Fn>
+inline void UnaryOp(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                    R *output_data, const Fn &fn, ruy::Context *ruy_context = nullptr,
+                    int64_t min_elements_per_thread = kMinElementsPerThread)
+{
+  const int64_t size = MatchingFlatSize(input_shape, output_shape);
+  auto range_fn = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i)
+      output_data[i] = fn(input_data[i]);
+  };
+  ParallelFor(size, ruy_context, range_fn, min_elements_per_thread);
+}
+
+// Same as UnaryOp, but array_fn takes an Eigen array of a range and returns an array
+// expression, which uses packet math of Eigen, e.g. [](const auto &x) { return x.sin(); }.
+template <typename T, typename R, typename ArrayFn>
+inline void UnaryArrayOp(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                         R *output_data, const ArrayFn &array_fn,
+                         ruy::Context *ruy_context = nullptr,
+                         int64_t min_elements_per_thread = kMinElementsPerThread)
+{
+  using InputArray = Eigen::Map<const Eigen::Array<T, Eigen::Dynamic, 1>>;
+  using OutputArray = Eigen::Map<Eigen::Array<R, Eigen::Dynamic, 1>>;
+
+  const int64_t size = MatchingFlatSize(input_shape, output_shape);
+  auto range_fn = [&](int64_t begin, int64_t end) {
+    const InputArray input(input_data + begin, end - begin);
+    OutputArray output(output_data + begin, end - begin);
+    output = array_fn(input);
+  };
+  ParallelFor(size, ruy_context, range_fn, min_elements_per_thread);
+}
+
+// output = fn(input1, input2) with numpy style broadcasting of inputs up to output_shape
+template <typename T1, typename T2, typename R, typename Fn>
+inline void BinaryOp(const Shape &input1_shape, const T1 *input1_data, const Shape &input2_shape,
+                     const T2 *input2_data, const Shape &output_shape, R *output_data,
+                     const Fn &fn, ruy::Context *ruy_context = nullptr,
+                     int64_t min_elements_per_thread = kMinElementsPerThread)
+{
+  const Shape *const input_shapes[2] = {&input1_shape, &input2_shape};
+  const auto plan = MakeBroadcastPlan(input_shapes, output_shape);
+  const int last = plan.rank - 1;
+
+  auto range_fn = [&](int64_t begin, int64_t end) {
+    ForEachRow(plan, begin, end, [&](const int64_t *offsets, int64_t output_offset,
+                                     int64_t count) {
+      BinaryRow(input1_data + offsets[0], plan.strides[0][last], input2_data + offsets[1],
+                plan.strides[1][last], output_data + output_offset, count, fn);
+    });
+  };
+  ParallelFor(plan.size, ruy_context, range_fn, min_elements_per_thread);
+}
+
+// output = fn(input1, input2, input3) with numpy style broadcasting of inputs
+template <typename T1, typename T2, typename T3, typename R, typename Fn>
+inline void TernaryOp(const Shape &input1_shape, const T1 *input1_data, const Shape &input2_shape,
+                      const T2 *input2_data, const Shape &input3_shape, const T3 *input3_data,
+                      const Shape &output_shape, R *output_data, const Fn &fn,
+                      ruy::Context *ruy_context = nullptr,
+                      int64_t min_elements_per_thread = kMinElementsPerThread)
+{
+  const Shape *const input_shapes[3] = {&input1_shape, &input2_shape, &input3_shape};
+  const auto plan = MakeBroadcastPlan(input_shapes, output_shape);
+  const int last = plan.rank - 1;
+
+  auto range_fn = [&](int64_t begin, int64_t end) {
+    ForEachRow(plan, begin, end, [&](const int64_t *offsets, int64_t output_offset,
+                                     int64_t count) {
+      TernaryRow(input1_data + offsets[0], plan.strides[0][last], input2_data + offsets[1],
+                 plan.strides[1][last], input3_data + offsets[2], plan.strides[2][last],
+                 output_data + output_offset, count, fn);
+    });
+  };
+  ParallelFor(plan.size, ruy_context, range_fn, min_elements_per_thread);
+}
+
+} // namespace elementwise
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ELEMENTWISE_ENGINE_H__
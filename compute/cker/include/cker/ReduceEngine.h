@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_REDUCE_ENGINE_H__
+#define __NNFW_CKER_REDUCE_ENGINE_H__
+
+#include "cker/ElementwiseEngine.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace reduce
+{
+
+// Minimum input elements reduced by a thread
+constexpr int64_t kMinElementsPerThread = 16384;
+// Elements reduced by a plain loop, larger ranges are split into halves and combined
+constexpr int64_t kPairwiseBlockSize = 128;
+// Independent accumulators of a contiguous reduction, which compilers map to SIMD lanes
+constexpr int kLanes = 8;
+// Output columns reduced together when the reduced axes are not innermost
+constexpr int kColumnTile = 256;
+
+// Reducers accumulate In values to Acc with operator() and merge two partial results with
+// Combine. Identity is the initial value of an accumulator.
+template <typename In, typename Acc = In> struct SumReducer
+{
+  static Acc Identity() { return static_cast<Acc>(0); }
+  Acc operator()(const Acc current, const In in) const { return current + static_cast<Acc>(in); }
+  Acc Combine(const Acc lhs, const Acc rhs) const { return lhs + rhs; }
+};
+
+template <typename T> struct ProdReducer
+{
+  static T Identity() { return static_cast<T>(1); }
+  T operator()(const T current, const T in) const { return in * current; }
+  T Combine(const T lhs, const T rhs) const { return lhs * rhs; }
+};
+
+template <typename T> struct MaxReducer
+{
+  static T Identity() { return std::numeric_limits<T>::lowest(); }
+  T operator()(const T current, const T in) const { return (in > current) ? in : current; }
+  T Combine(const T lhs, const T rhs) const { return (rhs > lhs) ? rhs : lhs; }
+};
+
+template <typename T> struct MinReducer
+{
+  static T Identity() { return std::numeric_limits<T>::max(); }
+  T operator()(const T current, const T in) const { return (in < current) ? in : current; }
+  T Combine(const T lhs, const T rhs) const { return (rhs < lhs) ? rhs : lhs; }
+};
+
+struct AnyReducer
+{
+  static bool Identity() { return false; }
+  bool operator()(const bool current, const bool in) const { return in || current; }
+  bool Combine(const bool lhs, const bool rhs) const { return lhs || rhs; }
+};
+
+struct AllReducer
+{
+  static bool Identity() { return true; }
+  bool operator()(const bool current, const bool in) const { return in && current; }
+  bool Combine(const bool lhs, const bool rhs) const { return lhs && rhs; }
+};
+
+// Reducer merging partial results of another reducer
+template <typename Acc, typename Reducer> struct CombineReducer
+{
+  explicit CombineReducer(const Reducer &reducer) : reducer_(reducer) {}
+  static Acc Identity() { return Reducer::Identity(); }
+  Acc operator()(const Acc current, const Acc in) const { return reducer_.Combine(current, in); }
+  Acc Combine(const Acc lhs, const Acc rhs) const { return reducer_.Combine(lhs, rhs); }
+
+private:
+  const Reducer &reducer_;
+};
+
+// Input viewed as [outer, reduce, inner], where output is [outer, inner]
+struct ReducePlan
+{
+  int64_t outer = 1;
+  int64_t reduce = 1;
+  int64_t inner = 1;
+};
+
+// Merge adjacent reduced dims and adjacent kept dims, ignoring dims of size 1. Returns false
+// if the reduced dims do not form a single group (e.g. axes {0, 2} of a 3D tensor) or the
+// input is empty, which is left to the generic index iteration.
+inline bool MakeReducePlan(const Shape &input_shape, const int *axis, int num_axis,
+                           ReducePlan *plan)
+{
+  int64_t groups[3] = {1, 1, 1};
+  bool group_reduced[3] = {false, false, false};
+  int num_groups = 0;
+  for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+  {
+    const int dim = input_shape.Dims(i);
+    if (dim == 0)
+      return false;
+    if (dim == 1)
+      continue;
+
+    const bool reduced = std::find(axis, axis + num_axis, i) != axis + num_axis;
+    if (num_groups > 0 && group_reduced[num_groups - 1] == reduced)
+    {
+      groups[num_groups - 1] *= dim;
+      continue;
+    }
+    // Only [kept] [reduced] [kept] is supported
+    if (num_groups == 3 || (num_groups == 2 && group_reduced[0]))
+      return false;
+    group_reduced[num_groups] = reduced;
+    groups[num_groups++] = dim;
+  }
+
+  *plan = ReducePlan{};
+  int group = 0;
+  if (group < num_groups && !group_reduced[group])
+    plan->outer = groups[group++];
+  if (group < num_groups && group_reduced[group])
+    plan->reduce = groups[group++];
+  if (group < num_groups)
+    plan->inner = groups[group++];
+  return true;
+}
+
+// Reduce contiguous elements with kLanes independent accumulators, splitting ranges longer
+// than kPairwiseBlockSize into halves so that rounding errors of float sums grow with the log
+// of size rather than with size.
+template <typename In, typename Acc, typename Reducer>
+inline Acc ReduceContiguous(const In *data, int64_t size, const Reducer &reducer)
+{
+  if (size > kPairwiseBlockSize)
+  {
+    const int64_t half = (size / 2) & ~static_cast<int64_t>(kLanes - 1);
+    return reducer.Combine(ReduceContiguous<In, Acc>(data, half, reducer),
+                           ReduceContiguous<In, Acc>(data + half, size - half, reducer));
+  }
+
+  Acc lanes[kLanes];
+  std::fill_n(lanes, kLanes, Reducer::Identity());
+  int64_t i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+  {
+    for (int l = 0; l < kLanes; ++l)
+      lanes[l] = reducer(lanes[l], data[i + l]);
+  }
+  Acc result = Reducer::Identity();
+  for (; i < size; ++i)
+    result = reducer(result, data[i]);
+  for (int l = 0; l < kLanes; l += 2)
+    result = reducer.Combine(result, reducer.Combine(lanes[l], lanes[l + 1]));
+  return result;
+}
+
+// Reduce rows of cols elements, of which starts are stride apart, into acc. Each row is
+// accumulated by a loop over contiguous columns, and long columns are split into halves.
+template <typename In, typename Acc, typename Reducer>
+inline void ReduceColumns(const In *data, int64_t rows, int64_t stride, int cols, Acc *acc,
+                          const Reducer &reducer)
+{
+  assert(cols <= kColumnTile);
+  if (rows > kPairwiseBlockSize)
+  {
+    const int64_t half = rows / 2;
+    Acc partial[kColumnTile];
+    ReduceColumns<In, Acc>(data, half, stride, cols, acc, reducer);
+    ReduceColumns<In, Acc>(data + half * stride, rows - half, stride, cols, partial, reducer);
+    for (int c = 0; c < cols; ++c)
+      acc[c] = reducer.Combine(acc[c], partial[c]);
+    return;
+  }
+
+  std::fill_n(acc, cols, Reducer::Identity());
+  for (int64_t r = 0; r < rows; ++r)
+  {
+    const In *row = data + r * stride;
+    for (int c = 0; c < cols; ++c)
+      acc[c] = reducer(acc[c], row[c]);
+  }
+}
+
+// Reduce input_data along the resolved axis into output_data of Acc, which has as many
+// elements as the reduced shape. Work is split over independent output elements, or over
+// blocks of the input when all elements reduce to one value. Results do not depend on the
+// number of threads. Returns false without writing output_data if the axes are not supported.
+template <typename In, typename Acc, typename Reducer>
+inline bool ReduceAxes(const Shape &input_shape, const In *input_data, const int *axis,
+                       int num_axis, const Reducer &reducer, Acc *output_data,
+                       ruy::Context *ruy_context = nullptr)
+{
+  ReducePlan plan;
+  if (!MakeReducePlan(input_shape, axis, num_axis, &plan))
+    return false;
+
+  if (plan.inner == 1 && plan.outer == 1)
+  {
+    const int64_t num_blocks = (plan.reduce + kMinElementsPerThread - 1) / kMinElementsPerThread;
+    if (num_blocks == 1)
+    {
+      output_data[0] = ReduceContiguous<In, Acc>(input_data, plan.reduce, reducer);
+      return true;
+    }
+
+    std::unique_ptr<Acc[]> partials(new Acc[num_blocks]);
+    elementwise::ParallelFor(
+      num_blocks, ruy_context,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t b = begin; b < end; ++b)
+        {
+          const int64_t start = b * kMinElementsPerThread;
+          const int64_t size = std::min(kMinElementsPerThread, plan.reduce - start);
+          partials[b] = ReduceContiguous<In, Acc>(input_data + start, size, reducer);
+        }
+      },
+      1);
+    output_data[0] = ReduceContiguous<Acc, Acc>(partials.get(), num_blocks,
+                                                CombineReducer<Acc, Reducer>(reducer));
+    return true;
+  }
+
+  if (plan.inner == 1)
+  {
+    elementwise::ParallelFor(
+      plan.outer, ruy_context,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t o = begin; o < end; ++o)
+          output_data[o] = ReduceContiguous<In, Acc>(input_data + o * plan.reduce, plan.reduce,
+                                                     reducer);
+      },
+      std::max<int64_t>(1, kMinElementsPerThread / plan.reduce));
+    return true;
+  }
+
+  const int64_t tiles_per_outer = (plan.inner + kColumnTile - 1) / kColumnTile;
+  const int64_t elements_per_tile = plan.reduce * std::min<int64_t>(plan.inner, kColumnTile);
+  elementwise::ParallelFor(
+    plan.outer * tiles_per_outer, ruy_context,
+    [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; ++t)
+      {
+        const int64_t o = t / tiles_per_outer;
+        const int64_t c = (t % tiles_per_outer) * kColumnTile;
+        const int cols = static_cast<int>(std::min<int64_t>(kColumnTile, plan.inner - c));
+        ReduceColumns<In, Acc>(input_data + o * plan.reduce * plan.inner + c, plan.reduce,
+                               plan.inner, cols, output_data + o * plan.inner + c, reducer);
+      }
+    },
+    std::max<int64_t>(1, kMinElementsPerThread / elements_per_tile));
+  return true;
+}
+
+} // namespace reduce
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_REDUCE_ENGINE_H__
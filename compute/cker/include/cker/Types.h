@@ -296,6 +296,17 @@ struct GatherParams
   int32_t axis;
 };
 
+struct BCQFullyConnectedParams
+{
+  FusedActivationFunctionType activation{FusedActivationFunctionType::kNone};
+};
+
+struct BCQGatherParams
+{
+  int32_t axis;
+  int32_t hidden_size;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
@@ -311,6 +322,22 @@ struct ResizeBilinearParams
   bool half_pixel_centers;
 };
 
+struct ResizeNearestNeighborParams
+{
+  int32_t output_height;
+  int32_t output_width;
+  bool align_corners;
+  bool half_pixel_centers;
+};
+
+struct LocalResponseNormalizationParams
+{
+  int32_t range;
+  float bias;
+  float alpha;
+  float beta;
+};
+
 struct TransposeConvParams
 {
   PaddingType padding_type;
@@ -394,6 +421,19 @@ struct LeakyReluParams
   float alpha;
 };
 
+struct PReLUParams
+{
+  int32_t input_offset;
+  int32_t alpha_offset;
+  int32_t output_offset;
+  // for input >= 0, where output is scaled input
+  int32_t output_multiplier_1;
+  int32_t output_shift_1;
+  // for input < 0, where output is scaled input * alpha
+  int32_t output_multiplier_2;
+  int32_t output_shift_2;
+};
+
 enum class Order
 {
   kColMajor,
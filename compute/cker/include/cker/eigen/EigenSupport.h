@@ -95,6 +95,14 @@ struct EigenContext
     {
       num_threads = default_num_threadpool_threads;
     }
+    SetNumThreads(num_threads);
+  }
+
+  // Recreate the thread pool with num_threads. It must not be called while kernels run on it.
+  void SetNumThreads(int num_threads)
+  {
+    if (device != nullptr && device->numThreads() == num_threads)
+      return;
     device.reset(); // destroy before we invalidate the thread pool
     thread_pool_wrapper.reset(new EigenThreadPoolWrapper(new Eigen::ThreadPool(num_threads)));
     device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
@@ -19,12 +19,100 @@
 #define __NNFW_CKER_ARGMINMAX_H__
 
 #include "cker/Shape.h"
+#include "cker/eigen/Utils.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
+namespace argminmax
+{
+
+// Return the largest (kIsMax) or the smallest element of data, vectorized by Eigen
+template <bool kIsMax, typename T> inline T ReduceMinMax(const T *data, int size)
+{
+  assert(size > 0);
+  const VectorMap<const T> data_map(data, size, 1);
+  return kIsMax ? data_map.maxCoeff() : data_map.minCoeff();
+}
+
+// Index of the first largest (kIsMax) or smallest element of contiguous data
+template <bool kIsMax, typename T> inline int ArgMinMaxContiguous(const T *data, int size)
+{
+  // Find the first chunk which has the result with vectorized reduction, and search only it
+  constexpr int kChunkSize = 256;
+  int chunk_start = 0;
+  T value = ReduceMinMax<kIsMax>(data, std::min(size, kChunkSize));
+  for (int start = kChunkSize; start < size; start += kChunkSize)
+  {
+    const T chunk_value = ReduceMinMax<kIsMax>(data + start, std::min(size - start, kChunkSize));
+    if (kIsMax ? chunk_value > value : chunk_value < value)
+    {
+      value = chunk_value;
+      chunk_start = start;
+    }
+  }
+
+  const int chunk_end = std::min(size, chunk_start + kChunkSize);
+  for (int i = chunk_start; i < chunk_end; ++i)
+  {
+    if (data[i] == value)
+      return i;
+  }
+
+  // Only NaN is not found, follow comparison of the generic implementation
+  int index = 0;
+  for (int i = 1; i < size; ++i)
+  {
+    if (kIsMax ? data[i] > data[index] : data[i] < data[index])
+      index = i;
+  }
+  return index;
+}
+
+template <bool kIsMax, typename T1, typename T2>
+void ArgMinMaxImpl(const T1 *input_data, T2 *output_data, int outer_size, int axis_size,
+                   int inner_size)
+{
+  if (inner_size == 1)
+  {
+    for (int outer = 0; outer < outer_size; ++outer)
+    {
+      output_data[outer] =
+        static_cast<T2>(ArgMinMaxContiguous<kIsMax>(input_data + outer * axis_size, axis_size));
+    }
+    return;
+  }
+
+  // Keep candidates of all inner elements and update them slice by slice, which reads input
+  // sequentially instead of striding over axis
+  std::vector<T1> min_max_values(inner_size);
+  for (int outer = 0; outer < outer_size; ++outer)
+  {
+    const T1 *input_ptr = input_data + outer * axis_size * inner_size;
+    T2 *output_ptr = output_data + outer * inner_size;
+    std::copy_n(input_ptr, inner_size, min_max_values.begin());
+    std::fill_n(output_ptr, inner_size, 0);
+    for (int i = 1; i < axis_size; ++i)
+    {
+      const T1 *slice = input_ptr + i * inner_size;
+      for (int inner = 0; inner < inner_size; ++inner)
+      {
+        const bool update =
+          kIsMax ? slice[inner] > min_max_values[inner] : slice[inner] < min_max_values[inner];
+        min_max_values[inner] = update ? slice[inner] : min_max_values[inner];
+        output_ptr[inner] = update ? static_cast<T2>(i) : output_ptr[inner];
+      }
+    }
+  }
+}
+
+} // namespace argminmax
+
 template <typename T1, typename T2, typename Cmp>
 void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &output_shape,
                T2 *output_data, int32_t axis, const Cmp &cmp)
@@ -72,6 +160,44 @@ void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &ou
   }
 }
 
+template <typename T1, typename T2>
+void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &output_shape,
+               T2 *output_data, int32_t axis, bool is_arg_max)
+{
+  UNUSED_RELEASE(output_shape);
+  assert(input1_shape.DimensionsCount() > 0);
+  assert(input1_shape.DimensionsCount() - 1 == output_shape.DimensionsCount());
+  if (axis < 0)
+  {
+    axis += input1_shape.DimensionsCount();
+  }
+  const int axis_size = input1_shape.Dims(axis);
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i)
+  {
+    assert(input1_shape.Dims(i) == output_shape.Dims(i));
+    outer_size *= input1_shape.Dims(i);
+  }
+
+  int inner_size = 1;
+  const int dims_count = input1_shape.DimensionsCount();
+  for (int i = axis + 1; i < dims_count; ++i)
+  {
+    assert(input1_shape.Dims(i) == output_shape.Dims(i - 1));
+    inner_size *= input1_shape.Dims(i);
+  }
+
+  if (is_arg_max)
+  {
+    argminmax::ArgMinMaxImpl<true>(input1_data, output_data, outer_size, axis_size, inner_size);
+  }
+  else
+  {
+    argminmax::ArgMinMaxImpl<false>(input1_data, output_data, outer_size, axis_size, inner_size);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
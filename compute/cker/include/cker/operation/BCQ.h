@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_H__
+#define __NNFW_CKER_BCQ_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/TensorUtils.h"
+#include "cker/CpuBackendThreadpool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Binary-coding quantization (BCQ) represents each row of weights as
+//   W[o][h] = sum_k alpha[r(o, k)] * (bit(binary[r(o, k)], h) ? 1 : -1)
+// where k ranges over qbits of the cluster which row o belongs to.
+//
+// - clusters : [num_clusters, 2], each cluster is (qbits, number of rows)
+// - binary   : [sum of qbits * rows, ceil(hidden / 32)], bit (h % 32) of word (h / 32)
+//              is the sign of hidden element h
+// - alpha    : [sum of qbits * rows], scale of each binary code row
+//
+// Binary code rows of a cluster are ordered by output row then by bit, so
+// r(o, k) = (rows of previous clusters) + (o - first row of cluster) * qbits + k.
+namespace bcq
+{
+
+constexpr int kBitsPerWord = 32;
+
+inline int NumWords(int hidden_size) { return (hidden_size + kBitsPerWord - 1) / kBitsPerWord; }
+
+struct RowCode
+{
+  int code_row; // First binary code row of output row
+  int qbits;
+};
+
+// Map each output row to its binary code rows
+inline std::vector<RowCode> GetRowCodes(const Shape &clusters_shape, const int32_t *clusters_data)
+{
+  assert(clusters_shape.DimensionsCount() == 2);
+  assert(clusters_shape.Dims(1) == 2);
+
+  std::vector<RowCode> row_codes;
+  int code_row = 0;
+  for (int c = 0; c < clusters_shape.Dims(0); ++c)
+  {
+    const int qbits = clusters_data[c * 2];
+    const int rows = clusters_data[c * 2 + 1];
+    for (int r = 0; r < rows; ++r)
+    {
+      row_codes.push_back({code_row, qbits});
+      code_row += qbits;
+    }
+  }
+  return row_codes;
+}
+
+// Sum of input elements whose bits are set in binary code row
+inline float SumSetBits(const int32_t *code, const float *input, int hidden_size)
+{
+  float sum = 0.f;
+  int h = 0;
+  for (; h + kBitsPerWord <= hidden_size; h += kBitsPerWord)
+  {
+    const uint32_t word = static_cast<uint32_t>(code[h / kBitsPerWord]);
+    if (word == 0)
+      continue;
+    // Branchless to be vectorized
+    for (int j = 0; j < kBitsPerWord; ++j)
+      sum += input[h + j] * static_cast<float>((word >> j) & 1u);
+  }
+  if (h < hidden_size)
+  {
+    const uint32_t word = static_cast<uint32_t>(code[h / kBitsPerWord]);
+    for (int j = 0; h + j < hidden_size; ++j)
+      sum += input[h + j] * static_cast<float>((word >> j) & 1u);
+  }
+  return sum;
+}
+
+// Dequantize a weight element
+inline float DequantizeElement(const RowCode &row_code, const float *alpha_data,
+                               const int32_t *binary_data, int num_words, int h)
+{
+  float value = 0.f;
+  for (int k = 0; k < row_code.qbits; ++k)
+  {
+    const int code_row = row_code.code_row + k;
+    const int32_t *code = binary_data + code_row * num_words;
+    const uint32_t word = static_cast<uint32_t>(code[h / kBitsPerWord]);
+    value += ((word >> (h % kBitsPerWord)) & 1u) ? alpha_data[code_row] : -alpha_data[code_row];
+  }
+  return value;
+}
+
+// output[o][b] for o in [row_start, row_end) with transposed input [batch, hidden]
+inline void BCQFullyConnectedRows(const std::vector<RowCode> &row_codes, const float *alpha_data,
+                                  const int32_t *binary_data, int hidden_size,
+                                  const float *input_t, const float *input_sums, int batch_size,
+                                  const float *bias_data, int bias_size, float *output_data,
+                                  int row_start, int row_end)
+{
+  const int num_words = NumWords(hidden_size);
+  for (int o = row_start; o < row_end; ++o)
+  {
+    const auto &row_code = row_codes[o];
+    float bias = 0.f;
+    if (bias_data != nullptr)
+      bias = bias_data[bias_size == 1 ? 0 : o];
+
+    for (int b = 0; b < batch_size; ++b)
+    {
+      const float *input = input_t + b * hidden_size;
+      float acc = bias;
+      for (int k = 0; k < row_code.qbits; ++k)
+      {
+        const int code_row = row_code.code_row + k;
+        // dot(sign, input) = sum(set) - sum(unset) = 2 * sum(set) - sum(all)
+        const float set_sum = SumSetBits(binary_data + code_row * num_words, input, hidden_size);
+        acc += alpha_data[code_row] * (2.f * set_sum - input_sums[b]);
+      }
+      output_data[o * batch_size + b] = acc;
+    }
+  }
+}
+
+struct BCQFullyConnectedWorkerTask : cpu_backend_threadpool::Task
+{
+  BCQFullyConnectedWorkerTask(const std::vector<RowCode> &row_codes, const float *alpha_data,
+                              const int32_t *binary_data, int hidden_size, const float *input_t,
+                              const float *input_sums, int batch_size, const float *bias_data,
+                              int bias_size, float *output_data, int row_start, int row_end)
+    : row_codes_(row_codes), alpha_data_(alpha_data), binary_data_(binary_data),
+      hidden_size_(hidden_size), input_t_(input_t), input_sums_(input_sums),
+      batch_size_(batch_size), bias_data_(bias_data), bias_size_(bias_size),
+      output_data_(output_data), row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    BCQFullyConnectedRows(row_codes_, alpha_data_, binary_data_, hidden_size_, input_t_,
+                          input_sums_, batch_size_, bias_data_, bias_size_, output_data_,
+                          row_start_, row_end_);
+  }
+
+private:
+  const std::vector<RowCode> &row_codes_;
+  const float *alpha_data_;
+  const int32_t *binary_data_;
+  int hidden_size_;
+  const float *input_t_;
+  const float *input_sums_;
+  int batch_size_;
+  const float *bias_data_;
+  int bias_size_;
+  float *output_data_;
+  int row_start_;
+  int row_end_;
+};
+
+} // namespace bcq
+
+// BCQFullyConnected takes transposed input and produces transposed output
+// - input  : [hidden, batch]
+// - output : [rows, batch]
+// It is evaluated on binary codes directly without dequantizing weights, and runs with multi
+// threads over output rows when ruy_context is given.
+inline void BCQFullyConnected(const BCQFullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const Shape &alpha_shape,
+                              const float *alpha_data, const Shape &binary_shape,
+                              const int32_t *binary_data, const Shape &clusters_shape,
+                              const int32_t *clusters_data, const Shape &bias_shape,
+                              const float *bias_data, const Shape &output_shape,
+                              float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(alpha_shape);
+  UNUSED_RELEASE(binary_shape);
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+
+  const int hidden_size = input_shape.Dims(0);
+  const int batch_size = input_shape.Dims(1);
+  const auto row_codes = bcq::GetRowCodes(clusters_shape, clusters_data);
+  const int num_rows = static_cast<int>(row_codes.size());
+  assert(output_shape.Dims(0) == num_rows);
+  assert(output_shape.Dims(1) == batch_size);
+  assert(binary_shape.Dims(1) == bcq::NumWords(hidden_size));
+  const int bias_size = bias_data == nullptr ? 0 : bias_shape.FlatSize();
+  assert(bias_data == nullptr || bias_size == 1 || bias_size == num_rows);
+
+  // Make each batch contiguous and get sum of its elements
+  std::vector<float> input_t(batch_size * hidden_size);
+  std::vector<float> input_sums(batch_size, 0.f);
+  for (int h = 0; h < hidden_size; ++h)
+  {
+    for (int b = 0; b < batch_size; ++b)
+    {
+      const float value = input_data[h * batch_size + b];
+      input_t[b * hidden_size + h] = value;
+      input_sums[b] += value;
+    }
+  }
+
+  // Split rows not to make too small tasks
+  constexpr int kMinRowsPerThread = 16;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = std::max(1, std::min(max_threads, num_rows / kMinRowsPerThread));
+
+  if (thread_count == 1)
+  {
+    bcq::BCQFullyConnectedRows(row_codes, alpha_data, binary_data, hidden_size, input_t.data(),
+                               input_sums.data(), batch_size, bias_data, bias_size, output_data,
+                               0, num_rows);
+  }
+  else
+  {
+    std::vector<bcq::BCQFullyConnectedWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int row_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int row_end = row_start + (num_rows - row_start) / (thread_count - i);
+      tasks.emplace_back(row_codes, alpha_data, binary_data, hidden_size, input_t.data(),
+                         input_sums.data(), batch_size, bias_data, bias_size, output_data,
+                         row_start, row_end);
+      row_start = row_end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    ApplyActivationToVector(output_data, num_rows * batch_size, params.activation, output_data);
+  }
+}
+
+// BCQGather gathers rows (axis 0) or columns (axis 1) of weights [rows, hidden] represented by
+// BCQ, dequantizing only gathered elements
+template <typename CoordsT = int32_t>
+inline void BCQGather(const BCQGatherParams &params, const Shape &alpha_shape,
+                      const float *alpha_data, const Shape &binary_shape,
+                      const int32_t *binary_data, const Shape &coords_shape,
+                      const CoordsT *coords_data, const Shape &clusters_shape,
+                      const int32_t *clusters_data, const Shape &output_shape, float *output_data)
+{
+  UNUSED_RELEASE(alpha_shape);
+  UNUSED_RELEASE(binary_shape);
+  UNUSED_RELEASE(output_shape);
+  assert(params.axis == 0 || params.axis == 1);
+
+  const int hidden_size = params.hidden_size;
+  const int num_words = bcq::NumWords(hidden_size);
+  assert(binary_shape.Dims(1) == num_words);
+  const auto row_codes = bcq::GetRowCodes(clusters_shape, clusters_data);
+  const int num_rows = static_cast<int>(row_codes.size());
+  const int coords_count = coords_shape.FlatSize();
+
+  if (params.axis == 0)
+  {
+    assert(output_shape.FlatSize() == coords_count * hidden_size);
+    for (int i = 0; i < coords_count; ++i)
+    {
+      assert(coords_data[i] >= 0);
+      assert(coords_data[i] < num_rows);
+      const auto &row_code = row_codes[coords_data[i]];
+      float *output = output_data + i * hidden_size;
+      std::fill(output, output + hidden_size, 0.f);
+      for (int k = 0; k < row_code.qbits; ++k)
+      {
+        const int code_row = row_code.code_row + k;
+        const float alpha = alpha_data[code_row];
+        const int32_t *code = binary_data + code_row * num_words;
+        for (int h = 0; h < hidden_size; ++h)
+        {
+          const uint32_t bit = (static_cast<uint32_t>(code[h / bcq::kBitsPerWord]) >>
+                                (h % bcq::kBitsPerWord)) &
+                               1u;
+          output[h] += bit ? alpha : -alpha;
+        }
+      }
+    }
+  }
+  else
+  {
+    assert(output_shape.FlatSize() == num_rows * coords_count);
+    for (int o = 0; o < num_rows; ++o)
+    {
+      for (int i = 0; i < coords_count; ++i)
+      {
+        assert(coords_data[i] >= 0);
+        assert(coords_data[i] < hidden_size);
+        output_data[o * coords_count + i] = bcq::DequantizeElement(
+          row_codes[o], alpha_data, binary_data, num_words, static_cast<int>(coords_data[i]));
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_H__
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
 #include <functional>
+#include "cker/ElementwiseEngine.h"
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -30,48 +31,58 @@ namespace nnfw
 namespace cker
 {
 
-namespace
+template <BinaryArithmeticOpType op_type, typename T> struct BinaryArithmeticFn;
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::ADD, T>
 {
-template <BinaryArithmeticOpType op_type, typename T>
-const std::function<T(const T &, const T &)> GetBinaryArtithmeticFn()
+  T operator()(const T &a, const T &b) const { return a + b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::MUL, T>
 {
-  switch (op_type)
+  T operator()(const T &a, const T &b) const { return a * b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::SUB, T>
+{
+  T operator()(const T &a, const T &b) const { return a - b; }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::DIV, T>
+{
+  T operator()(const T &a, const T &b) const
   {
-    case BinaryArithmeticOpType::ADD:
-    {
-      return [](const T &a, const T &b) -> T { return a + b; };
-    }
-    case BinaryArithmeticOpType::MUL:
-    {
-      return [](const T &a, const T &b) -> T { return a * b; };
-    }
-    case BinaryArithmeticOpType::SUB:
-    {
-      return [](const T &a, const T &b) -> T { return a - b; };
-    }
-    case BinaryArithmeticOpType::DIV:
-    {
-      if (std::is_floating_point<T>::value)
-        return [](const T &a, const T &b) -> T { return a / b; };
-      else
-        return [](const T &a, const T &b) -> T {
-          if (b == 0)
-            throw std::runtime_error("Divide by zero");
-          return a / b;
-        };
-    }
-    case BinaryArithmeticOpType::POW:
-    {
-      return [](const T &a, const T &b) -> T { return std::pow(a, b); };
-    }
-    default:
-    {
-      assert(false);
-      return nullptr;
-    }
+    if (!std::is_floating_point<T>::value && b == 0)
+      throw std::runtime_error("Divide by zero");
+    return a / b;
   }
+};
+
+template <typename T> struct BinaryArithmeticFn<BinaryArithmeticOpType::POW, T>
+{
+  T operator()(const T &a, const T &b) const { return std::pow(a, b); }
+};
+
+// Integer division may throw, which must not happen on worker threads
+template <BinaryArithmeticOpType op_type, typename T>
+inline ruy::Context *BinaryArithmeticContext(ruy::Context *ruy_context)
+{
+  return (op_type == BinaryArithmeticOpType::DIV && !std::is_floating_point<T>::value)
+           ? nullptr
+           : ruy_context;
+}
+
+// Run flat_fn(offset, chunk_shape) over chunks of same shaped inputs on threads of ruy_context
+template <typename FlatFn>
+inline void ParallelBinaryArithmeticOp(const Shape &input1_shape, const Shape &input2_shape,
+                                       const Shape &output_shape, ruy::Context *ruy_context,
+                                       const FlatFn &flat_fn)
+{
+  const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  elementwise::ParallelFor(size, ruy_context, [&](int64_t begin, int64_t end) {
+    flat_fn(static_cast<int>(begin), Shape{static_cast<int>(end - begin)});
+  });
 }
-} // namespace
 
 // Consolidates dimensions in broadcast inputs, checks for five-fold pattern.
 //
@@ -193,85 +204,97 @@ template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<!is_quant8<T>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   reference::BinaryArithmeticOp(params, input1_shape, input1_data, input2_shape, input2_data,
-                                output_shape, output_data, GetBinaryArtithmeticFn<op_type, T>());
+                                output_shape, output_data, BinaryArithmeticFn<op_type, T>(),
+                                BinaryArithmeticContext<op_type, T>(ruy_context));
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
-  switch (op_type)
-  {
-    case nnfw::cker::BinaryArithmeticOpType::ADD:
-    case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::DIV:
-      throw std::runtime_error{"Quant8 Asymm NYI"};
-    default:
-      assert(false);
-      break;
-  }
+  if (op_type == nnfw::cker::BinaryArithmeticOpType::DIV)
+    throw std::runtime_error{"Quant8 Asymm NYI"};
+
+  ParallelBinaryArithmeticOp(
+    input1_shape, input2_shape, output_shape, ruy_context, [&](int offset, const Shape &shape) {
+      switch (op_type)
+      {
+        case nnfw::cker::BinaryArithmeticOpType::ADD:
+        case nnfw::cker::BinaryArithmeticOpType::SUB:
+          optimized::Add(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::MUL:
+          optimized::Mul(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        default:
+          assert(false);
+          break;
+      }
+    });
 }
 
 template <BinaryArithmeticOpType op_type>
 inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                const float *input1_data, const Shape &input2_shape,
                                const float *input2_data, const Shape &output_shape,
-                               float *output_data)
+                               float *output_data, ruy::Context *ruy_context = nullptr)
 {
   // Supported type is only float now
-  switch (op_type)
-  {
-    case nnfw::cker::BinaryArithmeticOpType::ADD:
-      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::Sub(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::DIV:
-      optimized::Div(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    default:
-      assert(false);
-      break;
-  }
+  ParallelBinaryArithmeticOp(
+    input1_shape, input2_shape, output_shape, ruy_context, [&](int offset, const Shape &shape) {
+      switch (op_type)
+      {
+        case nnfw::cker::BinaryArithmeticOpType::ADD:
+          optimized::Add(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::MUL:
+          optimized::Mul(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::SUB:
+          optimized::Sub(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::DIV:
+          optimized::Div(params, shape, input1_data + offset, shape, input2_data + offset, shape,
+                         output_data + offset);
+          break;
+        default:
+          assert(false);
+          break;
+      }
+    });
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<!is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context *ruy_context = nullptr)
 {
   reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                              input2_data, output_shape, output_data,
-                                             GetBinaryArtithmeticFn<op_type, T>());
+                                             BinaryArithmeticFn<op_type, T>(),
+                                             BinaryArithmeticContext<op_type, T>(ruy_context));
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context *ruy_context = nullptr)
 {
+  UNUSED_RELEASE(ruy_context);
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
@@ -296,8 +319,18 @@ template <BinaryArithmeticOpType op_type>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const float *input1_data, const Shape &input2_shape,
                                         const float *input2_data, const Shape &output_shape,
-                                        float *output_data)
+                                        float *output_data, ruy::Context *ruy_context = nullptr)
 {
+  // Shapes which five-fold loops cannot handle and Pow run on the elementwise engine
+  if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast ||
+      op_type == nnfw::cker::BinaryArithmeticOpType::POW)
+  {
+    reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
+                                               input2_data, output_shape, output_data,
+                                               BinaryArithmeticFn<op_type, float>(), ruy_context);
+    return;
+  }
+
   // Supported type is only float now
   switch (op_type)
   {
@@ -317,11 +350,6 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
       optimized::BroadcastDivDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
                                       output_shape, output_data);
       break;
-    case nnfw::cker::BinaryArithmeticOpType::POW:
-      reference::BroadcastBinaryArithmeticOpSlow<float>(
-        params, input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
-        GetBinaryArtithmeticFn<op_type, float>());
-      break;
     default:
       assert(false);
       break;
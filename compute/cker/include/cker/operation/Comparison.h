@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_COMPARISON_H__
 #define __NNFW_CKER_COMPARISON_H__
 
+#include "cker/ElementwiseEngine.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -39,189 +40,148 @@ template <typename T> using ComparisonFn = bool (*)(T, T);
 template <typename T, ComparisonFn<T> F>
 inline void ComparisonImpl(const Shape &input1_shape, const T *input1_data,
                            const Shape &input2_shape, const T *input2_data,
-                           const Shape &output_shape, bool *output_data)
+                           const Shape &output_shape, bool *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
   const int64_t flatsize = // number of data....
     MatchingFlatSize(input1_shape, input2_shape, output_shape);
-  for (int64_t i = 0; i < flatsize; ++i)
-  {
-    output_data[i] = F(input1_data[i], input2_data[i]);
-  }
+  const Shape flat_shape{static_cast<int>(flatsize)};
+  elementwise::BinaryOp(flat_shape, input1_data, flat_shape, input2_data, flat_shape, output_data,
+                        F, ruy_context);
 }
 
 template <ComparisonFn<float> F>
 inline void Comparison(const Shape &input1_shape, const float *input1_data,
                        const Shape &input2_shape, const float *input2_data,
-                       const Shape &output_shape, bool *output_data)
+                       const Shape &output_shape, bool *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   ComparisonImpl<float, F>(input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                           output_data);
+                           output_data, ruy_context);
 }
 
+// Rescales quantized inputs to compare them in a common scale
+template <typename T, ComparisonFn<int32_t> F> struct ScaledComparisonFn
+{
+  explicit ScaledComparisonFn(const ComparisonParams &params) : params_(params) {}
+
+  bool operator()(T input1, T input2) const
+  {
+    const int32_t input1_val = params_.input1_offset + input1;
+    const int32_t input2_val = params_.input2_offset + input2;
+    const int32_t shifted_input1_val = input1_val * (1 << params_.left_shift);
+    const int32_t shifted_input2_val = input2_val * (1 << params_.left_shift);
+    const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+      shifted_input1_val, params_.input1_multiplier, params_.input1_shift);
+    const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+      shifted_input2_val, params_.input2_multiplier, params_.input2_shift);
+    return F(scaled_input1_val, scaled_input2_val);
+  }
+
+private:
+  const ComparisonParams &params_;
+};
+
 template <typename T, ComparisonFn<int32_t> F>
 inline void ComparisonWithScaling(ComparisonParams &params, const Shape &input1_shape,
                                   const T *input1_data, const Shape &input2_shape,
                                   const T *input2_data, const Shape &output_shape,
-                                  bool *output_data)
+                                  bool *output_data, ruy::Context *ruy_context = nullptr)
 {
-  int left_shift = params.left_shift;
-  int32_t input1_offset = params.input1_offset;
-  int32_t input1_multiplier = params.input1_multiplier;
-  int input1_shift = params.input1_shift;
-  int32_t input2_offset = params.input2_offset;
-  int32_t input2_multiplier = params.input2_multiplier;
-  int input2_shift = params.input2_shift;
   const int64_t flatsize = MatchingFlatSize(input1_shape, input2_shape, output_shape);
-  for (int64_t i = 0; i < flatsize; ++i)
-  {
-    const int32_t input1_val = input1_offset + input1_data[i];
-    const int32_t input2_val = input2_offset + input2_data[i];
-    const int32_t shifted_input1_val = input1_val * (1 << left_shift);
-    const int32_t shifted_input2_val = input2_val * (1 << left_shift);
-    const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-      shifted_input1_val, input1_multiplier, input1_shift);
-    const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-      shifted_input2_val, input2_multiplier, input2_shift);
-    output_data[i] = F(scaled_input1_val, scaled_input2_val);
-  }
+  const Shape flat_shape{static_cast<int>(flatsize)};
+  elementwise::BinaryOp(flat_shape, input1_data, flat_shape, input2_data, flat_shape, output_data,
+                        ScaledComparisonFn<T, F>(params), ruy_context);
 }
 
+// NOTE Broadcasting is not limited to 4D anymore, but names are kept for compatibility
 template <typename T, ComparisonFn<T> F>
 inline void
 BroadcastComparison4DSlowImpl(const Shape &unextended_input1_shape, const T *input1_data,
                               const Shape &unextended_input2_shape, const T *input2_data,
-                              const Shape &unextended_output_shape, bool *output_data)
+                              const Shape &unextended_output_shape, bool *output_data,
+                              ruy::Context *ruy_context = nullptr)
 {
-  assert(unextended_input1_shape.DimensionsCount() <= 4);
-  assert(unextended_input2_shape.DimensionsCount() <= 4);
-  assert(unextended_output_shape.DimensionsCount() <= 4);
-  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
-
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(unextended_input1_shape, unextended_input2_shape, &desc1,
-                                      &desc2);
-
-  for (int b = 0; b < output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < output_shape.Dims(3); ++c)
-        {
-          output_data[Offset(output_shape, b, y, x, c)] =
-            F(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
-              input2_data[SubscriptToIndex(desc2, b, y, x, c)]);
-        }
-      }
-    }
-  }
+  elementwise::BinaryOp(unextended_input1_shape, input1_data, unextended_input2_shape,
+                        input2_data, unextended_output_shape, output_data, F, ruy_context);
 }
 
 template <typename T, ComparisonFn<T> F>
 inline void BroadcastComparison4DSlow(const Shape &input1_shape, const T *input1_data,
                                       const Shape &input2_shape, const T *input2_data,
-                                      const Shape &output_shape, bool *output_data)
+                                      const Shape &output_shape, bool *output_data,
+                                      ruy::Context *ruy_context = nullptr)
 {
   BroadcastComparison4DSlowImpl<T, F>(input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
 }
 
 template <typename T, ComparisonFn<int32_t> F>
 inline void BroadcastComparison4DSlowWithScaling(ComparisonParams &params,
                                                  const Shape &input1_shape, const T *input1_data,
                                                  const Shape &input2_shape, const T *input2_data,
-                                                 const Shape &output_shape, bool *output_data)
+                                                 const Shape &output_shape, bool *output_data,
+                                                 ruy::Context *ruy_context = nullptr)
 {
-  assert(input1_shape.DimensionsCount() <= 4);
-  assert(input2_shape.DimensionsCount() <= 4);
-  assert(output_shape.DimensionsCount() <= 4);
-
-  int left_shift = params.left_shift;
-  int32_t input1_offset = params.input1_offset;
-  int32_t input1_multiplier = params.input1_multiplier;
-  int input1_shift = params.input1_shift;
-  int32_t input2_offset = params.input2_offset;
-  int32_t input2_multiplier = params.input2_multiplier;
-  int input2_shift = params.input2_shift;
-
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
-
-  for (int b = 0; b < output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < output_shape.Dims(3); ++c)
-        {
-          const int32_t input1_val =
-            input1_offset + input1_data[SubscriptToIndex(desc1, b, y, x, c)];
-          const int32_t input2_val =
-            input2_offset + input2_data[SubscriptToIndex(desc2, b, y, x, c)];
-          const int32_t shifted_input1_val = input1_val * (1 << left_shift);
-          const int32_t shifted_input2_val = input2_val * (1 << left_shift);
-          const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-            shifted_input1_val, input1_multiplier, input1_shift);
-          const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
-            shifted_input2_val, input2_multiplier, input2_shift);
-          output_data[Offset(output_shape, b, y, x, c)] = F(scaled_input1_val, scaled_input2_val);
-        }
-      }
-    }
-  }
+  elementwise::BinaryOp(input1_shape, input1_data, input2_shape, input2_data, output_shape,
+                        output_data, ScaledComparisonFn<T, F>(params), ruy_context);
 }
 
 #define TFLITE_COMPARISON_OP(name)                                                                 \
   template <typename T>                                                                            \
   inline void name(const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,     \
-                   const T *input2_data, const Shape &output_shape, bool *output_data)             \
+                   const T *input2_data, const Shape &output_shape, bool *output_data,             \
+                   ruy::Context *ruy_context = nullptr)                                            \
   {                                                                                                \
     Comparison<name##Fn>(input1_shape, input1_data, input2_shape, input2_data, output_shape,       \
-                         output_data);                                                             \
+                         output_data, ruy_context);                                                \
   }                                                                                                \
   template <typename T>                                                                            \
   inline void name##NoScaling(const Shape &input1_shape, const T *input1_data,                     \
                               const Shape &input2_shape, const T *input2_data,                     \
-                              const Shape &output_shape, bool *output_data)                        \
+                              const Shape &output_shape, bool *output_data,                        \
+                              ruy::Context *ruy_context = nullptr)                                 \
   {                                                                                                \
     ComparisonImpl<T, name##Fn>(input1_shape, input1_data, input2_shape, input2_data,              \
-                                output_shape, output_data);                                        \
+                                output_shape, output_data, ruy_context);                           \
   }                                                                                                \
   template <typename T>                                                                            \
-  inline void name##WithScaling(                                                                   \
-    ComparisonParams &params, const Shape &input1_shape, const T *input1_data,                     \
-    const Shape &input2_shape, const T *input2_data, const Shape &output_shape, bool *output_data) \
+  inline void name##WithScaling(ComparisonParams &params, const Shape &input1_shape,               \
+                                const T *input1_data, const Shape &input2_shape,                   \
+                                const T *input2_data, const Shape &output_shape,                   \
+                                bool *output_data, ruy::Context *ruy_context = nullptr)            \
   {                                                                                                \
     ComparisonWithScaling<T, name##Fn>(params, input1_shape, input1_data, input2_shape,            \
-                                       input2_data, output_shape, output_data);                    \
+                                       input2_data, output_shape, output_data, ruy_context);       \
   }                                                                                                \
   template <typename T>                                                                            \
-  inline void Broadcast4DSlow##name##NoScaling(const Shape &input1_shape, const T *input1_data,    \
-                                               const Shape &input2_shape, const T *input2_data,    \
-                                               const Shape &output_shape, bool *output_data)       \
+  inline void Broadcast4DSlow##name##NoScaling(                                                    \
+    const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,                    \
+    const T *input2_data, const Shape &output_shape, bool *output_data,                            \
+    ruy::Context *ruy_context = nullptr)                                                           \
   {                                                                                                \
     BroadcastComparison4DSlowImpl<T, name##Fn>(input1_shape, input1_data, input2_shape,            \
-                                               input2_data, output_shape, output_data);            \
+                                               input2_data, output_shape, output_data,             \
+                                               ruy_context);                                       \
   }                                                                                                \
   template <typename T>                                                                            \
   inline void Broadcast4DSlow##name(const Shape &input1_shape, const T *input1_data,               \
                                     const Shape &input2_shape, const T *input2_data,               \
-                                    const Shape &output_shape, bool *output_data)                  \
+                                    const Shape &output_shape, bool *output_data,                  \
+                                    ruy::Context *ruy_context = nullptr)                           \
   {                                                                                                \
     BroadcastComparison4DSlow<T, name##Fn>(input1_shape, input1_data, input2_shape, input2_data,   \
-                                           output_shape, output_data);                             \
+                                           output_shape, output_data, ruy_context);                \
   }                                                                                                \
   template <typename T>                                                                            \
   inline void Broadcast4DSlow##name##WithScaling(                                                  \
     ComparisonParams &params, const Shape &input1_shape, const T *input1_data,                     \
-    const Shape &input2_shape, const T *input2_data, const Shape &output_shape, bool *output_data) \
+    const Shape &input2_shape, const T *input2_data, const Shape &output_shape, bool *output_data, \
+    ruy::Context *ruy_context = nullptr)                                                           \
   {                                                                                                \
-    BroadcastComparison4DSlowWithScaling<T, name##Fn>(                                             \
-      params, input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data);    \
+    BroadcastComparison4DSlowWithScaling<T, name##Fn>(params, input1_shape, input1_data,           \
+                                                      input2_shape, input2_data, output_shape,     \
+                                                      output_data, ruy_context);                   \
   }
 
 TFLITE_COMPARISON_OP(Equal);
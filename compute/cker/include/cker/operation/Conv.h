@@ -23,7 +23,9 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace nnfw
@@ -55,22 +57,44 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  // Filter of [input_depth * kernel_height * kernel_width, output_depth] for multithreaded Conv
+  using TransposedFilter = std::shared_ptr<const std::vector<float>>;
 
+public:
+  Conv()
+    : _modified_filter_data(), _prepared_filter_data(), _im2col_shape(4), _need_im2col(false),
+      _prepared(false)
+  {
+  }
+
+  // get_transposed_filter returns the constant filter transposed by TransposeFilter(), which
+  // callers may share among Conv kernels of the same filter. Without it, Conv transposes its own.
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights, uint32_t dilationWidthFactor,
-               uint32_t dilationHeightFactor)
+               uint32_t dilationHeightFactor,
+               const std::function<TransposedFilter()> &get_transposed_filter = nullptr)
   {
     if (!_prepared)
     {
       if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
       {
-        transposeFilter(filter_shape, filter_data, is_replaced_weights);
+        _prepared_filter_data = get_transposed_filter ? get_transposed_filter()
+                                                      : TransposeFilter(filter_shape, filter_data);
+        is_replaced_weights = true;
       }
       _prepared = true;
     }
   }
 
+  static TransposedFilter TransposeFilter(const Shape &filter_shape, const float *filter_data)
+  {
+    const auto output_depth = filter_shape.Dims(0);
+    const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
+    auto transposed = std::make_shared<std::vector<float>>(hwcn_filter_shape.FlatSize());
+    TransposeFloatTensor(filter_data, hwcn_filter_shape, transposed->data());
+    return transposed;
+  }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height, uint32_t dilation_width_factor,
                     uint32_t dilation_height_factor)
@@ -91,14 +115,20 @@ public:
                             params.dilation_height_factor))
     {
       bool transposed_in_execution = false;
+      const float *transposed_filter_data = nullptr;
       if (!_prepared)
       {
         // This means that filter is not constant
         // TODO Apply optimized kernel if multithreaded kernel is slower than optimized kernel by
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
+        transposed_filter_data = _modified_filter_data.data();
+      }
+      else
+      {
+        transposed_filter_data = _prepared_filter_data->data();
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, transposed_filter_data,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -187,7 +217,9 @@ private:
   }
 
 private:
+  // Filter transposed in execution when it is not constant
   std::vector<float> _modified_filter_data;
+  TransposedFilter _prepared_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_ELEMENTWISE_H__
 
 #include "cker/eigen/Utils.h"
+#include "cker/ElementwiseEngine.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <Eigen/Core>
@@ -29,95 +30,79 @@ namespace cker
 {
 
 inline void Sin(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                float *output_data)
+                float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = std::sin(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.sin(); }, ruy_context,
+    elementwise::kMinTranscendentalElementsPerThread);
 }
 
 inline void Cos(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                float *output_data)
+                float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = std::cos(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.cos(); }, ruy_context,
+    elementwise::kMinTranscendentalElementsPerThread);
 }
 
 inline void Abs(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                float *output_data)
+                float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map.array() = input_map.array().abs();
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.abs(); }, ruy_context);
 }
 
 inline void Rsqrt(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = 1.f / std::sqrt(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.sqrt().inverse(); }, ruy_context);
 }
 
 template <typename T>
 inline void Neg(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                T *output_data)
+                T *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = -input_data[i];
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return -x; }, ruy_context);
 }
 
 inline void Log(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                float *output_data)
+                float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = std::log(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.log(); }, ruy_context,
+    elementwise::kMinTranscendentalElementsPerThread);
 }
 
 inline void Floor(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-
-  for (int i = 0; i < flat_size; i++)
-  {
-    output_data[i] = std::floor(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.floor(); }, ruy_context);
 }
 
 inline void Sqrt(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                 float *output_data)
+                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-
-  for (int i = 0; i < flat_size; i++)
-  {
-    output_data[i] = std::sqrt(input_data[i]);
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.sqrt(); }, ruy_context);
 }
 
 inline void Square(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                   float *output_data)
+                   float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-
-  for (int i = 0; i < flat_size; i++)
-  {
-    output_data[i] = input_data[i] * input_data[i];
-  }
+  elementwise::UnaryArrayOp(
+    input_shape, input_data, output_shape, output_data,
+    [](const auto &x) { return x.square(); }, ruy_context);
 }
 
 } // namespace cker
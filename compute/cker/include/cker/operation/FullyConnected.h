@@ -21,6 +21,7 @@
 #include <ruy/context.h>
 #include "cker/operation/FullyConnectedDense16x1.h"
 #include "cker/operation/FullyConnectedSparse16x1.h"
+#include "cker/operation/FullyConnectedSparseBlock.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
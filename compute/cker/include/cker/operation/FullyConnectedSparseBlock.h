@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_SPARSE_BLOCK_H__
+#define __NNFW_CKER_FULLY_CONNECTED_SPARSE_BLOCK_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/TensorUtils.h"
+#include "cker/CpuBackendThreadpool.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace sparse_block
+{
+
+// Weights of block sparsity are stored as CSR of blocks. Blocks of block row i are
+// [w1_segments[i], w1_segments[i + 1]) and w1_indices has the block column of each block.
+// Each block of [block_rows, block_cols] is stored in row major order, so a block row starts at
+// weights_data + w1_segments[i] * block_rows * block_cols.
+struct BlockSparseArgs
+{
+  int batches;
+  int accum_depth;
+  int output_depth;
+  const uint16_t *w1_segments;
+  const uint16_t *w1_indices;
+};
+
+// Multiply-accumulates per thread not to make too small tasks
+constexpr int kMinMacsPerThread = 32768;
+
+template <int R, int C>
+using BlockMap =
+  Eigen::Map<const Eigen::Matrix<float, R, C, (C == 1) ? Eigen::ColMajor : Eigen::RowMajor>>;
+
+template <int R, int C>
+using QuantizedBlockMap =
+  Eigen::Map<const Eigen::Matrix<int8_t, R, C, (C == 1) ? Eigen::ColMajor : Eigen::RowMajor>>;
+
+// output[b, rows of block row] += sum of blocks * input[b, columns of block], with fixed block
+// size which is unrolled and vectorized by Eigen
+template <int R, int C>
+void FloatBlockRows(const BlockSparseArgs &args, const float *input_data,
+                    const float *weights_data, float *output_data, int block_row_start,
+                    int block_row_end)
+{
+  for (int i = block_row_start; i < block_row_end; ++i)
+  {
+    const int start = args.w1_segments[i];
+    const int end = args.w1_segments[i + 1];
+    for (int b = 0; b < args.batches; ++b)
+    {
+      const float *input = input_data + b * args.accum_depth;
+      Eigen::Matrix<float, R, 1> acc = Eigen::Matrix<float, R, 1>::Zero();
+      for (int p = start; p < end; ++p)
+      {
+        const Eigen::Map<const Eigen::Matrix<float, C, 1>> x(input + args.w1_indices[p] * C);
+        acc.noalias() += BlockMap<R, C>(weights_data + p * R * C) * x;
+      }
+      Eigen::Map<Eigen::Matrix<float, R, 1>> y(output_data + b * args.output_depth + i * R);
+      y += acc;
+    }
+  }
+}
+
+// Same with FloatBlockRows for block size only known at runtime
+inline void FloatBlockRows(const BlockSparseArgs &args, int block_rows, int block_cols,
+                           const float *input_data, const float *weights_data,
+                           float *output_data, int block_row_start, int block_row_end)
+{
+  const int block_size = block_rows * block_cols;
+  for (int i = block_row_start; i < block_row_end; ++i)
+  {
+    for (int b = 0; b < args.batches; ++b)
+    {
+      const float *input = input_data + b * args.accum_depth;
+      float *output = output_data + b * args.output_depth + i * block_rows;
+      for (int p = args.w1_segments[i]; p < args.w1_segments[i + 1]; ++p)
+      {
+        const float *block = weights_data + p * block_size;
+        const float *x = input + args.w1_indices[p] * block_cols;
+        for (int r = 0; r < block_rows; ++r)
+        {
+          float acc = 0.f;
+          for (int c = 0; c < block_cols; ++c)
+            acc += block[r * block_cols + c] * x[c];
+          output[r] += acc;
+        }
+      }
+    }
+  }
+}
+
+// acc[b, rows of block row] = sum of blocks * (input[b, columns of block] + input_offset)
+template <int R, int C>
+void QuantizedBlockRows(const BlockSparseArgs &args, int32_t input_offset,
+                        const int8_t *input_data, const int8_t *weights_data, int32_t *acc_data,
+                        int block_row_start, int block_row_end)
+{
+  for (int i = block_row_start; i < block_row_end; ++i)
+  {
+    const int start = args.w1_segments[i];
+    const int end = args.w1_segments[i + 1];
+    for (int b = 0; b < args.batches; ++b)
+    {
+      const int8_t *input = input_data + b * args.accum_depth;
+      Eigen::Matrix<int32_t, R, 1> acc = Eigen::Matrix<int32_t, R, 1>::Zero();
+      for (int p = start; p < end; ++p)
+      {
+        const Eigen::Map<const Eigen::Matrix<int8_t, C, 1>> x(input + args.w1_indices[p] * C);
+        const auto block = QuantizedBlockMap<R, C>(weights_data + p * R * C);
+        acc.noalias() += block.template cast<int32_t>() *
+                         (x.template cast<int32_t>().array() + input_offset).matrix();
+      }
+      Eigen::Map<Eigen::Matrix<int32_t, R, 1>>(acc_data + b * args.output_depth + i * R) = acc;
+    }
+  }
+}
+
+inline void QuantizedBlockRows(const BlockSparseArgs &args, int block_rows, int block_cols,
+                               int32_t input_offset, const int8_t *input_data,
+                               const int8_t *weights_data, int32_t *acc_data,
+                               int block_row_start, int block_row_end)
+{
+  const int block_size = block_rows * block_cols;
+  for (int i = block_row_start; i < block_row_end; ++i)
+  {
+    for (int b = 0; b < args.batches; ++b)
+    {
+      const int8_t *input = input_data + b * args.accum_depth;
+      int32_t *acc = acc_data + b * args.output_depth + i * block_rows;
+      std::fill_n(acc, block_rows, 0);
+      for (int p = args.w1_segments[i]; p < args.w1_segments[i + 1]; ++p)
+      {
+        const int8_t *block = weights_data + p * block_size;
+        const int8_t *x = input + args.w1_indices[p] * block_cols;
+        for (int r = 0; r < block_rows; ++r)
+        {
+          for (int c = 0; c < block_cols; ++c)
+            acc[r] += block[r * block_cols + c] * (x[c] + input_offset);
+        }
+      }
+    }
+  }
+}
+
+// Run fn(block_row_start, block_row_end) over block rows with multi threads
+template <typename Fn> struct BlockRowsWorkerTask : cpu_backend_threadpool::Task
+{
+  BlockRowsWorkerTask(const Fn &fn, int start, int end) : fn_(fn), start_(start), end_(end) {}
+
+  void Run() override { fn_(start_, end_); }
+
+private:
+  const Fn &fn_;
+  int start_;
+  int end_;
+};
+
+template <typename Fn>
+void ParallelBlockRows(int block_rows_count, int64_t macs, ruy::Context *ruy_context, const Fn &fn)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = static_cast<int>(std::max<int64_t>(
+    1, std::min<int64_t>({max_threads, block_rows_count, macs / kMinMacsPerThread})));
+
+  if (thread_count == 1)
+  {
+    fn(0, block_rows_count);
+    return;
+  }
+
+  std::vector<BlockRowsWorkerTask<Fn>> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int end = start + (block_rows_count - start) / (thread_count - i);
+    tasks.emplace_back(fn, start, end);
+    start = end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+inline BlockSparseArgs MakeArgs(const Shape &weights_shape, const Shape &output_shape,
+                                int block_rows, const uint16_t *w1_segments,
+                                const uint16_t *w1_indices, int64_t *macs)
+{
+  assert(weights_shape.DimensionsCount() == 2);
+  const int output_dims_count = output_shape.DimensionsCount();
+  BlockSparseArgs args;
+  args.batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  args.output_depth = MatchingDim(weights_shape, 0, output_shape, output_dims_count - 1);
+  args.accum_depth = weights_shape.Dims(1);
+  args.w1_segments = w1_segments;
+  args.w1_indices = w1_indices;
+  assert(args.output_depth % block_rows == 0);
+
+  const int block_rows_count = args.output_depth / block_rows;
+  *macs = static_cast<int64_t>(w1_segments[block_rows_count]) * args.batches;
+  return args;
+}
+
+} // namespace sparse_block
+
+// FullyConnected with block sparse weights of [block_rows, block_cols], e.g. 16x1, 8x1, 4x4 or
+// 1x16. Common block sizes are unrolled and vectorized, and block rows run with multi threads
+// when ruy_context is given.
+inline void FullyConnectedSparseWeightBlock(
+  const FullyConnectedParams &params, const Shape &input_shape, const float *input_data,
+  const Shape &weights_shape, const float *weights_data, const Shape &bias_shape,
+  const float *bias_data, const Shape &output_shape, float *output_data,
+  const uint16_t *w1_segments, const uint16_t *w1_indices, int block_rows, int block_cols,
+  ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+
+  int64_t macs = 0;
+  const auto args = sparse_block::MakeArgs(weights_shape, output_shape, block_rows, w1_segments,
+                                           w1_indices, &macs);
+  macs *= block_rows * block_cols;
+
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, args.output_depth, args.batches, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, args.batches * args.output_depth);
+  }
+
+  const int block_rows_count = args.output_depth / block_rows;
+  auto run = [&](int start, int end) {
+#define SPARSE_BLOCK_CASE(R, C)                                                              \
+  if (block_rows == R && block_cols == C)                                                    \
+  {                                                                                          \
+    sparse_block::FloatBlockRows<R, C>(args, input_data, weights_data, output_data, start, end); \
+    return;                                                                                  \
+  }
+    SPARSE_BLOCK_CASE(16, 1)
+    SPARSE_BLOCK_CASE(8, 1)
+    SPARSE_BLOCK_CASE(4, 1)
+    SPARSE_BLOCK_CASE(4, 4)
+    SPARSE_BLOCK_CASE(2, 2)
+    SPARSE_BLOCK_CASE(1, 4)
+    SPARSE_BLOCK_CASE(1, 16)
+#undef SPARSE_BLOCK_CASE
+    sparse_block::FloatBlockRows(args, block_rows, block_cols, input_data, weights_data,
+                                 output_data, start, end);
+  };
+  sparse_block::ParallelBlockRows(block_rows_count, macs, ruy_context, run);
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, args.batches * args.output_depth, params.activation,
+                            output_data);
+  }
+}
+
+// Int8 FullyConnected with block sparse weights. Weights are symmetric, and output is
+// requantized with a multiplier for all channels or multipliers of each output channel
+// (per_channel). scratch_data should have the size of output.
+inline void FullyConnectedSparseWeightBlock(
+  const FullyConnectedParams &params, const int32_t *output_multiplier, const int *output_shift,
+  bool per_channel, const Shape &input_shape, const int8_t *input_data,
+  const Shape &weights_shape, const int8_t *weights_data, const Shape &bias_shape,
+  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+  int32_t *scratch_data, const uint16_t *w1_segments, const uint16_t *w1_indices, int block_rows,
+  int block_cols, ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+
+  int64_t macs = 0;
+  const auto args = sparse_block::MakeArgs(weights_shape, output_shape, block_rows, w1_segments,
+                                           w1_indices, &macs);
+  macs *= block_rows * block_cols;
+  const int32_t input_offset = params.input_offset;
+
+  const int block_rows_count = args.output_depth / block_rows;
+  auto run = [&](int start, int end) {
+#define SPARSE_BLOCK_CASE(R, C)                                                         \
+  if (block_rows == R && block_cols == C)                                               \
+  {                                                                                     \
+    sparse_block::QuantizedBlockRows<R, C>(args, input_offset, input_data, weights_data, \
+                                           scratch_data, start, end);                   \
+    return;                                                                             \
+  }
+    SPARSE_BLOCK_CASE(16, 1)
+    SPARSE_BLOCK_CASE(8, 1)
+    SPARSE_BLOCK_CASE(4, 1)
+    SPARSE_BLOCK_CASE(4, 4)
+    SPARSE_BLOCK_CASE(2, 2)
+    SPARSE_BLOCK_CASE(1, 4)
+    SPARSE_BLOCK_CASE(1, 16)
+#undef SPARSE_BLOCK_CASE
+    sparse_block::QuantizedBlockRows(args, block_rows, block_cols, input_offset, input_data,
+                                     weights_data, scratch_data, start, end);
+  };
+  sparse_block::ParallelBlockRows(block_rows_count, macs, ruy_context, run);
+
+  const int flat_size = args.batches * args.output_depth;
+  for (int i = 0; i < flat_size; ++i)
+  {
+    const int channel = i % args.output_depth;
+    int32_t acc = scratch_data[i];
+    if (bias_data != nullptr)
+      acc += bias_data[channel];
+    const int index = per_channel ? channel : 0;
+    acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[index], output_shift[index]);
+    acc += params.output_offset;
+    acc = std::max(acc, params.quantized_activation_min);
+    acc = std::min(acc, params.quantized_activation_max);
+    output_data[i] = static_cast<int8_t>(acc);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_SPARSE_BLOCK_H__
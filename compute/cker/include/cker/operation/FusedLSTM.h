@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FUSED_LSTM_H__
+#define __NNFW_CKER_FUSED_LSTM_H__
+
+#include "cker/TensorUtils.h"
+#include "cker/Types.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/eigen/Utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace fused_lstm
+{
+
+// Number of cells whose gate rows are packed together. Work is split on block boundaries, so
+// that a thread updates the cells of its blocks right after computing their gates.
+constexpr int kCellBlock = 32;
+// Multiply-accumulates per thread not to make too small tasks
+constexpr int kMinMacsPerThread = 65536;
+
+using RowMajorMatrixMap = Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic,
+                                                         Eigen::RowMajor>>;
+using ColMajorMatrixMap =
+  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::OuterStride<>>;
+
+// Weights of all gates packed into a matrix of [num_gates * n_cell, n_input + n_output].
+// Rows are ordered by cell block and then by gate, i.e. the rows of block j are
+//   gate 0 of cells in block j, gate 1 of cells in block j, ...
+// where gates are {input, forget, cell, output}, or {forget, cell, output} with CIFG.
+struct PackedGates
+{
+  int n_cell = 0;
+  int n_input = 0;
+  int n_output = 0;
+  int num_gates = 0;
+  bool use_cifg = false;
+  bool is_hybrid = false;
+  std::vector<float> weights;
+  // Symmetric int8 weights of hybrid LSTM with scales of input and recurrent part of each row
+  std::vector<int8_t> quantized_weights;
+  std::vector<float> input_scales;
+  std::vector<float> recurrent_scales;
+  std::vector<float> bias;
+
+  int depth() const { return n_input + n_output; }
+};
+
+// Buffers of an LSTM step shared by all threads
+struct StepArgs
+{
+  const LSTMParams *params;
+  int n_batch;
+  // [n_batch, n_input + n_output] of input and previous output state
+  const float *concat_input;
+  // Quantized concat_input and its scaling factors of each batch, only for hybrid
+  const int8_t *quantized_concat_input;
+  const float *input_scaling_factors;
+  const float *state_scaling_factors;
+  // Peephole weights, optional
+  const float *cell_to_input_weights;
+  const float *cell_to_forget_weights;
+  const float *cell_to_output_weights;
+  // [n_batch, num_gates * n_cell] scratch of gates, each block is [n_batch, num_gates * block]
+  float *gates;
+  float *cell_state;
+  // Output of cells, [n_batch, hidden_stride]
+  float *hidden;
+  int hidden_stride;
+};
+
+inline int32_t DotProduct(const int8_t *lhs, const int8_t *rhs, int size)
+{
+  int32_t acc = 0;
+  for (int i = 0; i < size; ++i)
+  {
+    acc += static_cast<int32_t>(lhs[i]) * static_cast<int32_t>(rhs[i]);
+  }
+  return acc;
+}
+
+// gates[b, r] = weights[r] * concat_input[b] + bias[r] for rows of a block
+inline void ComputeGates(const PackedGates &packed, const StepArgs &args, int row_start, int rows,
+                         float *gates)
+{
+  const int depth = packed.depth();
+  const int n_batch = args.n_batch;
+
+  if (!packed.is_hybrid)
+  {
+    const RowMajorMatrixMap weights(packed.weights.data() + row_start * depth, rows, depth);
+    const MatrixMap<const float> concat_input(args.concat_input, depth, n_batch);
+    ColMajorMatrixMap result(gates, rows, n_batch, Eigen::OuterStride<>(rows));
+    result.noalias() = weights * concat_input;
+    result.colwise() += VectorMap<const float>(packed.bias.data() + row_start, rows, 1);
+    return;
+  }
+
+  const int n_input = packed.n_input;
+  const int n_output = packed.n_output;
+  for (int r = 0; r < rows; ++r)
+  {
+    const int row = row_start + r;
+    const int8_t *weights = packed.quantized_weights.data() + row * depth;
+    for (int b = 0; b < n_batch; ++b)
+    {
+      const int8_t *input = args.quantized_concat_input + b * depth;
+      const int32_t input_acc = DotProduct(weights, input, n_input);
+      const int32_t state_acc = DotProduct(weights + n_input, input + n_input, n_output);
+      gates[b * rows + r] =
+        input_acc * packed.input_scales[row] * args.input_scaling_factors[b] +
+        state_acc * packed.recurrent_scales[row] * args.state_scaling_factors[b] + packed.bias[row];
+    }
+  }
+}
+
+// Apply activations of gates and update cell state and hidden output of cells in a block.
+// Formulas are same as LstmStepFloat without layer normalization.
+inline void UpdateCells(const PackedGates &packed, const StepArgs &args, int cell_start,
+                        int block_size, float *gates, int batch)
+{
+  const LSTMParams &params = *args.params;
+  float *input_gate = packed.use_cifg ? nullptr : gates;
+  float *forget_gate = gates + (packed.num_gates - 3) * block_size;
+  float *cell_gate = forget_gate + block_size;
+  float *output_gate = cell_gate + block_size;
+  float *cell_state = args.cell_state + batch * packed.n_cell + cell_start;
+
+  if (args.cell_to_forget_weights != nullptr)
+  {
+    for (int c = 0; c < block_size; ++c)
+    {
+      if (input_gate != nullptr && args.cell_to_input_weights != nullptr)
+        input_gate[c] += args.cell_to_input_weights[cell_start + c] * cell_state[c];
+      forget_gate[c] += args.cell_to_forget_weights[cell_start + c] * cell_state[c];
+    }
+  }
+  if (input_gate != nullptr)
+    ApplyActivationToVector(input_gate, block_size, FusedActivationFunctionType::kSigmoid,
+                            input_gate);
+  ApplyActivationToVector(forget_gate, block_size, FusedActivationFunctionType::kSigmoid,
+                          forget_gate);
+  ApplyActivationToVector(cell_gate, block_size, params.activation, cell_gate);
+
+  for (int c = 0; c < block_size; ++c)
+  {
+    const float input_gate_value = input_gate ? input_gate[c] : 1.0f - forget_gate[c];
+    float cell = forget_gate[c] * cell_state[c] + input_gate_value * cell_gate[c];
+    if (params.cell_clip > 0.0f)
+      cell = std::min(std::max(cell, -params.cell_clip), params.cell_clip);
+    cell_state[c] = cell;
+  }
+
+  if (args.cell_to_output_weights != nullptr)
+  {
+    for (int c = 0; c < block_size; ++c)
+      output_gate[c] += args.cell_to_output_weights[cell_start + c] * cell_state[c];
+  }
+  ApplyActivationToVector(output_gate, block_size, FusedActivationFunctionType::kSigmoid,
+                          output_gate);
+
+  // cell_gate is not used anymore, so reuse it for activated cell state
+  ApplyActivationToVector(cell_state, block_size, params.activation, cell_gate);
+  float *hidden = args.hidden + batch * args.hidden_stride + cell_start;
+  for (int c = 0; c < block_size; ++c)
+    hidden[c] = output_gate[c] * cell_gate[c];
+}
+
+inline void RunBlocks(const PackedGates &packed, const StepArgs &args, int block_start,
+                      int block_end)
+{
+  for (int block = block_start; block < block_end; ++block)
+  {
+    const int cell_start = block * kCellBlock;
+    const int block_size = std::min(kCellBlock, packed.n_cell - cell_start);
+    const int row_start = cell_start * packed.num_gates;
+    const int rows = block_size * packed.num_gates;
+    float *gates = args.gates + row_start * args.n_batch;
+
+    ComputeGates(packed, args, row_start, rows, gates);
+    for (int b = 0; b < args.n_batch; ++b)
+      UpdateCells(packed, args, cell_start, block_size, gates + b * rows, b);
+  }
+}
+
+struct FusedLSTMWorkerTask : cpu_backend_threadpool::Task
+{
+  FusedLSTMWorkerTask(const PackedGates &packed, const StepArgs &args, int block_start,
+                      int block_end)
+    : packed_(packed), args_(args), block_start_(block_start), block_end_(block_end)
+  {
+  }
+
+  void Run() override { RunBlocks(packed_, args_, block_start_, block_end_); }
+
+private:
+  const PackedGates &packed_;
+  const StepArgs &args_;
+  int block_start_;
+  int block_end_;
+};
+
+// output_state[b, r] = clip(projection_weights[r] * hidden[b] + projection_bias[r])
+inline void Project(const float *projection_weights, const float *projection_bias, float proj_clip,
+                    const float *hidden, int n_batch, int n_cell, int n_output,
+                    float *output_state, int row_start, int row_end)
+{
+  const int rows = row_end - row_start;
+  const RowMajorMatrixMap weights(projection_weights + row_start * n_cell, rows, n_cell);
+  const MatrixMap<const float> hidden_map(hidden, n_cell, n_batch);
+  ColMajorMatrixMap result(output_state + row_start, rows, n_batch,
+                           Eigen::OuterStride<>(n_output));
+  result.noalias() = weights * hidden_map;
+  if (projection_bias != nullptr)
+    result.colwise() += VectorMap<const float>(projection_bias + row_start, rows, 1);
+  if (proj_clip > 0.0f)
+    result = result.cwiseMax(-proj_clip).cwiseMin(proj_clip);
+}
+
+struct ProjectionWorkerTask : cpu_backend_threadpool::Task
+{
+  ProjectionWorkerTask(const float *projection_weights, const float *projection_bias,
+                       float proj_clip, const float *hidden, int n_batch, int n_cell, int n_output,
+                       float *output_state, int row_start, int row_end)
+    : projection_weights_(projection_weights), projection_bias_(projection_bias),
+      proj_clip_(proj_clip), hidden_(hidden), n_batch_(n_batch), n_cell_(n_cell),
+      n_output_(n_output), output_state_(output_state), row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    Project(projection_weights_, projection_bias_, proj_clip_, hidden_, n_batch_, n_cell_,
+            n_output_, output_state_, row_start_, row_end_);
+  }
+
+private:
+  const float *projection_weights_;
+  const float *projection_bias_;
+  float proj_clip_;
+  const float *hidden_;
+  int n_batch_;
+  int n_cell_;
+  int n_output_;
+  float *output_state_;
+  int row_start_;
+  int row_end_;
+};
+
+inline int ThreadCount(ruy::Context *ruy_context, int units, int64_t macs)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int64_t work_threads = std::max<int64_t>(1, macs / kMinMacsPerThread);
+  return static_cast<int>(std::min<int64_t>({max_threads, units, work_threads}));
+}
+
+template <typename TaskType, typename... Args>
+void SplitAndExecute(int units, int thread_count, ruy::Context *ruy_context, Args &&... args)
+{
+  std::vector<TaskType> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int end = start + (units - start) / (thread_count - i);
+    tasks.emplace_back(std::forward<Args>(args)..., start, end);
+    start = end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace fused_lstm
+
+// LSTM whose four gate weight matrices, for both input and recurrent weights, are packed into a
+// single matrix in advance. A step computes all gates with one matrix multiplication and updates
+// cells in the same pass, and runs with multi threads over cells when ruy_context is given.
+// Float and hybrid (int8 weights with float activations) LSTM are supported, but layer
+// normalization and auxiliary input are not. Use LstmStepFloat for them.
+class FusedLSTM
+{
+public:
+  FusedLSTM() = default;
+
+  // Pack float weights. Each array is for {input, forget, cell, output} gate, and input gate
+  // entries are nullptr with CIFG.
+  void prepare(const float *const input_weights[4], const float *const recurrent_weights[4],
+               const float *const gate_biases[4], int n_cell, int n_input, int n_output)
+  {
+    initialize(input_weights[0] == nullptr, false, n_cell, n_input, n_output, gate_biases);
+
+    auto &packed = _packed;
+    const int depth = packed.depth();
+    packed.weights.resize(static_cast<size_t>(packed.num_gates) * n_cell * depth);
+    forEachRow([&](int row, int gate, int cell) {
+      float *dst = packed.weights.data() + static_cast<size_t>(row) * depth;
+      std::memcpy(dst, input_weights[gate] + cell * n_input, n_input * sizeof(float));
+      std::memcpy(dst + n_input, recurrent_weights[gate] + cell * n_output,
+                  n_output * sizeof(float));
+    });
+  }
+
+  // Pack symmetric int8 weights of hybrid LSTM with scales of each weight tensor
+  void prepare(const int8_t *const input_weights[4], const float input_scales[4],
+               const int8_t *const recurrent_weights[4], const float recurrent_scales[4],
+               const float *const gate_biases[4], int n_cell, int n_input, int n_output)
+  {
+    initialize(input_weights[0] == nullptr, true, n_cell, n_input, n_output, gate_biases);
+
+    auto &packed = _packed;
+    const int depth = packed.depth();
+    const int rows = packed.num_gates * n_cell;
+    packed.quantized_weights.resize(static_cast<size_t>(rows) * depth);
+    packed.input_scales.resize(rows);
+    packed.recurrent_scales.resize(rows);
+    forEachRow([&](int row, int gate, int cell) {
+      int8_t *dst = packed.quantized_weights.data() + static_cast<size_t>(row) * depth;
+      std::memcpy(dst, input_weights[gate] + cell * n_input, n_input);
+      std::memcpy(dst + n_input, recurrent_weights[gate] + cell * n_output, n_output);
+      packed.input_scales[row] = input_scales[gate];
+      packed.recurrent_scales[row] = recurrent_scales[gate];
+    });
+  }
+
+  bool isHybrid() const { return _packed.is_hybrid; }
+
+  // Run a step for n_batch input vectors. output_state and cell_state are contiguous buffers of
+  // [n_batch, n_output] and [n_batch, n_cell], and output has output_batch_leading_dim stride.
+  void operator()(const LSTMParams &params, const float *input, const float *cell_to_input_weights,
+                  const float *cell_to_forget_weights, const float *cell_to_output_weights,
+                  const float *projection_weights, const float *projection_bias, int n_batch,
+                  int output_batch_leading_dim, float *output_state, float *cell_state,
+                  float *output, ruy::Context *ruy_context = nullptr)
+  {
+    const auto &packed = _packed;
+    const int n_cell = packed.n_cell;
+    const int n_input = packed.n_input;
+    const int n_output = packed.n_output;
+    const int depth = packed.depth();
+    const bool use_projection = (projection_weights != nullptr);
+    assert(use_projection || n_cell == n_output);
+
+    // Gather input and previous output state, which is overwritten by this step
+    _concat_input.resize(static_cast<size_t>(n_batch) * depth);
+    for (int b = 0; b < n_batch; ++b)
+    {
+      float *dst = _concat_input.data() + b * depth;
+      std::copy_n(input + b * n_input, n_input, dst);
+      std::copy_n(output_state + b * n_output, n_output, dst + n_input);
+    }
+
+    fused_lstm::StepArgs args;
+    args.params = &params;
+    args.n_batch = n_batch;
+    args.concat_input = _concat_input.data();
+    args.quantized_concat_input = nullptr;
+    args.input_scaling_factors = nullptr;
+    args.state_scaling_factors = nullptr;
+    if (packed.is_hybrid)
+    {
+      quantizeInput(n_batch);
+      args.quantized_concat_input = _quantized_concat_input.data();
+      args.input_scaling_factors = _scaling_factors.data();
+      args.state_scaling_factors = _scaling_factors.data() + n_batch;
+    }
+    args.cell_to_input_weights = cell_to_input_weights;
+    args.cell_to_forget_weights = cell_to_forget_weights;
+    args.cell_to_output_weights = cell_to_output_weights;
+    _gates.resize(static_cast<size_t>(n_batch) * packed.num_gates * n_cell);
+    args.gates = _gates.data();
+    args.cell_state = cell_state;
+    if (use_projection)
+    {
+      _hidden.resize(static_cast<size_t>(n_batch) * n_cell);
+      args.hidden = _hidden.data();
+      args.hidden_stride = n_cell;
+    }
+    else
+    {
+      args.hidden = output_state;
+      args.hidden_stride = n_output;
+    }
+
+    const int num_blocks = (n_cell + fused_lstm::kCellBlock - 1) / fused_lstm::kCellBlock;
+    const int64_t gate_macs = static_cast<int64_t>(packed.num_gates) * n_cell * depth * n_batch;
+    const int thread_count = fused_lstm::ThreadCount(ruy_context, num_blocks, gate_macs);
+    if (thread_count == 1)
+    {
+      fused_lstm::RunBlocks(packed, args, 0, num_blocks);
+    }
+    else
+    {
+      fused_lstm::SplitAndExecute<fused_lstm::FusedLSTMWorkerTask>(
+        num_blocks, thread_count, ruy_context, packed, args);
+    }
+
+    if (use_projection)
+    {
+      const int64_t projection_macs = static_cast<int64_t>(n_output) * n_cell * n_batch;
+      const int projection_threads =
+        fused_lstm::ThreadCount(ruy_context, n_output, projection_macs);
+      if (projection_threads == 1)
+      {
+        fused_lstm::Project(projection_weights, projection_bias, params.proj_clip, _hidden.data(),
+                            n_batch, n_cell, n_output, output_state, 0, n_output);
+      }
+      else
+      {
+        fused_lstm::SplitAndExecute<fused_lstm::ProjectionWorkerTask>(
+          n_output, projection_threads, ruy_context, projection_weights, projection_bias,
+          params.proj_clip, _hidden.data(), n_batch, n_cell, n_output, output_state);
+      }
+    }
+
+    for (int b = 0; b < n_batch; ++b)
+    {
+      std::copy_n(output_state + b * n_output, n_output, output + b * output_batch_leading_dim);
+    }
+  }
+
+private:
+  void initialize(bool use_cifg, bool is_hybrid, int n_cell, int n_input, int n_output,
+                  const float *const gate_biases[4])
+  {
+    auto &packed = _packed;
+    packed.n_cell = n_cell;
+    packed.n_input = n_input;
+    packed.n_output = n_output;
+    packed.use_cifg = use_cifg;
+    packed.is_hybrid = is_hybrid;
+    packed.num_gates = use_cifg ? 3 : 4;
+    packed.bias.resize(packed.num_gates * n_cell);
+    forEachRow([&](int row, int gate, int cell) { packed.bias[row] = gate_biases[gate][cell]; });
+  }
+
+  // Call fn(row, gate, cell) for each row of packed weights
+  template <typename Fn> void forEachRow(Fn fn) const
+  {
+    const auto &packed = _packed;
+    const int first_gate = packed.use_cifg ? 1 : 0;
+    for (int cell_start = 0; cell_start < packed.n_cell; cell_start += fused_lstm::kCellBlock)
+    {
+      const int block_size = std::min(fused_lstm::kCellBlock, packed.n_cell - cell_start);
+      const int row_start = cell_start * packed.num_gates;
+      for (int g = 0; g < packed.num_gates; ++g)
+      {
+        for (int c = 0; c < block_size; ++c)
+          fn(row_start + g * block_size + c, first_gate + g, cell_start + c);
+      }
+    }
+  }
+
+  // Quantize input and output state of each batch separately, since their ranges differ
+  void quantizeInput(int n_batch)
+  {
+    const int n_input = _packed.n_input;
+    const int n_output = _packed.n_output;
+    const int depth = _packed.depth();
+    _quantized_concat_input.resize(static_cast<size_t>(n_batch) * depth);
+    _scaling_factors.resize(2 * n_batch);
+    for (int b = 0; b < n_batch; ++b)
+    {
+      const float *src = _concat_input.data() + b * depth;
+      int8_t *dst = _quantized_concat_input.data() + b * depth;
+      float unused_min, unused_max;
+      SymmetricQuantizeFloats(src, n_input, dst, &unused_min, &unused_max, &_scaling_factors[b]);
+      SymmetricQuantizeFloats(src + n_input, n_output, dst + n_input, &unused_min, &unused_max,
+                              &_scaling_factors[n_batch + b]);
+    }
+  }
+
+private:
+  fused_lstm::PackedGates _packed;
+  std::vector<float> _concat_input;
+  std::vector<int8_t> _quantized_concat_input;
+  std::vector<float> _scaling_factors;
+  std::vector<float> _gates;
+  std::vector<float> _hidden;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FUSED_LSTM_H__
@@ -20,70 +20,192 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
+namespace instance_norm
+{
 
-inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_shape,
-                         const float *input_data, const Shape &gamma_shape, const float *gamma_data,
-                         const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
-                         float *output_data)
+// Sums of a block of pixels are accumulated in float, which is vectorized over channels, and
+// added to double totals per block
+constexpr int kPixelsPerBlock = 64;
+
+// Normalize channels [channel_start, channel_end) of a batch. Mean and variance are computed in
+// one pass over input with sums shifted by the first pixel, which avoids cancellation of
+// E[x^2] - E[x]^2 without the second pass for variance.
+inline void InstanceNormChannels(const InstanceNormParams &params, const float *input_data,
+                                 const float *gamma_data, int gamma_size, const float *beta_data,
+                                 int beta_size, float *output_data, int image_size, int channels,
+                                 int channel_start, int channel_end)
 {
-  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int32_t heights = MatchingDim(input_shape, 1, output_shape, 1);
-  const int32_t widths = MatchingDim(input_shape, 2, output_shape, 2);
-  const int32_t channels = MatchingDim(input_shape, 3, output_shape, 3);
-  const float output_activation_min = params.float_activation_min;
-  const float output_activation_max = params.float_activation_max;
+  const int depth = channel_end - channel_start;
+  const float *input = input_data + channel_start;
+  float *output = output_data + channel_start;
 
-  UNUSED_RELEASE(gamma_shape);
-  UNUSED_RELEASE(beta_shape);
-  assert(output_activation_min <= output_activation_max);
+  std::vector<float> shift(input, input + depth);
+  std::vector<float> block_sum(depth);
+  std::vector<float> block_square_sum(depth);
+  std::vector<double> sum(depth, 0.0);
+  std::vector<double> square_sum(depth, 0.0);
 
-  for (int32_t batch = 0; batch < batches; batch++)
+  for (int block_start = 0; block_start < image_size; block_start += kPixelsPerBlock)
   {
-    for (int32_t channel = 0; channel < channels; channel++)
+    const int block_end = std::min(block_start + kPixelsPerBlock, image_size);
+    std::fill(block_sum.begin(), block_sum.end(), 0.f);
+    std::fill(block_square_sum.begin(), block_square_sum.end(), 0.f);
+    for (int i = block_start; i < block_end; ++i)
     {
-      double sum = 0.0f;
-      double square_sum = 0.0f;
-      int32_t size = heights * widths;
-
-      for (int32_t height = 0; height < heights; height++)
+      const float *pixel = input + i * channels;
+      for (int c = 0; c < depth; ++c)
       {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-          sum += input_val;
-          square_sum += (input_val * input_val);
-        }
+        const float value = pixel[c] - shift[c];
+        block_sum[c] += value;
+        block_square_sum[c] += value * value;
       }
+    }
+    for (int c = 0; c < depth; ++c)
+    {
+      sum[c] += block_sum[c];
+      square_sum[c] += block_square_sum[c];
+    }
+  }
 
-      double mean = sum / size;
-      double var = square_sum / size - mean * mean;
+  // Fold normalization, gamma and beta into output = input * a + b
+  std::vector<float> a(depth);
+  std::vector<float> b(depth);
+  for (int c = 0; c < depth; ++c)
+  {
+    const double shifted_mean = sum[c] / image_size;
+    const double var = std::max(0.0, square_sum[c] / image_size - shifted_mean * shifted_mean);
+    const double mean = shifted_mean + shift[c];
+    const double gamma = gamma_data[gamma_size == 1 ? 0 : channel_start + c];
+    const double beta = beta_data[beta_size == 1 ? 0 : channel_start + c];
+    // A constant channel without epsilon is normalized to 0, rather than 0 / 0
+    const double denominator = std::sqrt(var + params.epsilon);
+    const double scale = denominator > 0.0 ? gamma / denominator : 0.0;
+    a[c] = static_cast<float>(scale);
+    b[c] = static_cast<float>(beta - mean * scale);
+  }
 
-      double gamma = gamma_data[channel];
-      double beta = beta_data[channel];
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+  for (int i = 0; i < image_size; ++i)
+  {
+    const float *input_pixel = input + i * channels;
+    float *output_pixel = output + i * channels;
+    for (int c = 0; c < depth; ++c)
+    {
+      const float value = input_pixel[c] * a[c] + b[c];
+      output_pixel[c] = std::min(std::max(value, output_activation_min), output_activation_max);
+    }
+  }
+}
 
-      double a = gamma / (std::sqrt(var + params.epsilon));
-      double b = -mean * a + beta;
+// Unit of work is a block of channels in a batch
+struct InstanceNormWorkerTask : cpu_backend_threadpool::Task
+{
+  InstanceNormWorkerTask(const InstanceNormParams &params, const float *input_data,
+                         const float *gamma_data, int gamma_size, const float *beta_data,
+                         int beta_size, float *output_data, int image_size, int channels,
+                         int blocks_per_batch, int unit_start, int unit_end)
+    : params_(params), input_data_(input_data), gamma_data_(gamma_data), gamma_size_(gamma_size),
+      beta_data_(beta_data), beta_size_(beta_size), output_data_(output_data),
+      image_size_(image_size), channels_(channels), blocks_per_batch_(blocks_per_batch),
+      unit_start_(unit_start), unit_end_(unit_end)
+  {
+  }
 
-      for (int32_t height = 0; height < heights; height++)
-      {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          double input_value = input_data[Offset(output_shape, batch, height, width, channel)];
-          double output_value = input_value * a + b;
-          output_data[Offset(output_shape, batch, height, width, channel)] =
-            ActivationFunctionWithMinMax((float)output_value, output_activation_min,
-                                         output_activation_max);
-        }
-      }
+  void Run() override
+  {
+    for (int unit = unit_start_; unit < unit_end_; ++unit)
+    {
+      const int batch = unit / blocks_per_batch_;
+      const int block = unit % blocks_per_batch_;
+      const int channel_start = block * channels_ / blocks_per_batch_;
+      const int channel_end = (block + 1) * channels_ / blocks_per_batch_;
+      const int batch_offset = batch * image_size_ * channels_;
+      InstanceNormChannels(params_, input_data_ + batch_offset, gamma_data_, gamma_size_,
+                           beta_data_, beta_size_, output_data_ + batch_offset, image_size_,
+                           channels_, channel_start, channel_end);
     }
   }
+
+private:
+  const InstanceNormParams &params_;
+  const float *input_data_;
+  const float *gamma_data_;
+  int gamma_size_;
+  const float *beta_data_;
+  int beta_size_;
+  float *output_data_;
+  int image_size_;
+  int channels_;
+  int blocks_per_batch_;
+  int unit_start_;
+  int unit_end_;
+};
+
+} // namespace instance_norm
+
+// InstanceNorm normalizes each channel of each batch over height and width.
+// Gamma and beta have one element or one element per channel. Batches and blocks of channels are
+// distributed over threads when ruy_context is given.
+inline void InstanceNorm(const InstanceNormParams &params, const Shape &input_shape,
+                         const float *input_data, const Shape &gamma_shape, const float *gamma_data,
+                         const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
+                         float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t heights = MatchingDim(input_shape, 1, output_shape, 1);
+  const int32_t widths = MatchingDim(input_shape, 2, output_shape, 2);
+  const int32_t channels = MatchingDim(input_shape, 3, output_shape, 3);
+  const int gamma_size = gamma_shape.FlatSize();
+  const int beta_size = beta_shape.FlatSize();
+  const int image_size = heights * widths;
+
+  assert(params.float_activation_min <= params.float_activation_max);
+  assert(gamma_size == 1 || gamma_size == channels);
+  assert(beta_size == 1 || beta_size == channels);
+  if (batches * image_size * channels == 0)
+    return;
+
+  // Split channels only as much as needed to use all threads, not to make too small tasks
+  constexpr int kMinElementsPerThread = 16384;
+  constexpr int kMinChannelsPerBlock = 8;
+  const int flat_size = batches * image_size * channels;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_limit = std::max(1, std::min(max_threads, flat_size / kMinElementsPerThread));
+  const int blocks_per_batch =
+    std::max(1, std::min((thread_limit + batches - 1) / batches, channels / kMinChannelsPerBlock));
+  const int num_units = batches * blocks_per_batch;
+  const int thread_count = std::min(thread_limit, num_units);
+
+  std::vector<instance_norm::InstanceNormWorkerTask> tasks;
+  tasks.reserve(thread_count);
+  int unit_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int unit_end = unit_start + (num_units - unit_start) / (thread_count - i);
+    tasks.emplace_back(params, input_data, gamma_data, gamma_size, beta_data, beta_size,
+                       output_data, image_size, channels, blocks_per_batch, unit_start, unit_end);
+    unit_start = unit_end;
+  }
+
+  if (thread_count == 1)
+  {
+    tasks.front().Run();
+  }
+  else
+  {
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
 }
 
 } // namespace cker
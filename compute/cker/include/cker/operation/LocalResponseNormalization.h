@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+#define __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/eigen/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace lrn
+{
+
+// Normalize pixels [pixel_start, pixel_end). Sum of squares over [c - range, c + range] is
+// computed with sliding window, and the power is evaluated by vectorized Eigen functions.
+inline void LocalResponseNormalizationPixels(const LocalResponseNormalizationParams &params,
+                                             const float *input_data, float *output_data,
+                                             int depth, int pixel_start, int pixel_end)
+{
+  const int range = params.range;
+  std::vector<float> squares(depth);
+  std::vector<float> scales(depth);
+  for (int i = pixel_start; i < pixel_end; ++i)
+  {
+    const float *input = input_data + i * depth;
+    float *output = output_data + i * depth;
+
+    for (int c = 0; c < depth; ++c)
+      squares[c] = input[c] * input[c];
+
+    float window_sum = 0.f;
+    for (int c = 0; c < std::min(range, depth); ++c)
+      window_sum += squares[c];
+    for (int c = 0; c < depth; ++c)
+    {
+      if (c + range < depth)
+        window_sum += squares[c + range];
+      scales[c] = window_sum;
+      if (c - range >= 0)
+        window_sum -= squares[c - range];
+    }
+
+    VectorMap<float> scales_map(scales.data(), depth, 1);
+    const VectorMap<const float> input_map(input, depth, 1);
+    VectorMap<float> output_map(output, depth, 1);
+    auto base = (scales_map.array() * params.alpha + params.bias);
+    if (params.beta == 0.5f)
+    {
+      output_map.array() = input_map.array() * base.rsqrt();
+    }
+    else
+    {
+      output_map.array() = input_map.array() * (base.log() * -params.beta).exp();
+    }
+  }
+}
+
+struct LocalResponseNormalizationWorkerTask : cpu_backend_threadpool::Task
+{
+  LocalResponseNormalizationWorkerTask(const LocalResponseNormalizationParams &params,
+                                       const float *input_data, float *output_data, int depth,
+                                       int pixel_start, int pixel_end)
+    : params_(params), input_data_(input_data), output_data_(output_data), depth_(depth),
+      pixel_start_(pixel_start), pixel_end_(pixel_end)
+  {
+  }
+
+  void Run() override
+  {
+    LocalResponseNormalizationPixels(params_, input_data_, output_data_, depth_, pixel_start_,
+                                     pixel_end_);
+  }
+
+private:
+  const LocalResponseNormalizationParams &params_;
+  const float *input_data_;
+  float *output_data_;
+  int depth_;
+  int pixel_start_;
+  int pixel_end_;
+};
+
+} // namespace lrn
+
+// LocalResponseNormalization over the last dimension
+//   output = input / (bias + alpha * sum(input[c - range .. c + range] ^ 2)) ^ beta
+// Pixels are distributed over threads when ruy_context is given.
+inline void LocalResponseNormalization(const LocalResponseNormalizationParams &params,
+                                       const Shape &input_shape, const float *input_data,
+                                       const Shape &output_shape, float *output_data,
+                                       ruy::Context *ruy_context = nullptr)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  if (depth == 0)
+    return;
+  const int num_pixels = flat_size / depth;
+
+  // Split pixels not to make too small tasks
+  constexpr int kMinElementsPerThread = 8192;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count =
+    std::max(1, std::min({max_threads, num_pixels, flat_size / kMinElementsPerThread}));
+
+  if (thread_count == 1)
+  {
+    lrn::LocalResponseNormalizationPixels(params, input_data, output_data, depth, 0, num_pixels);
+  }
+  else
+  {
+    std::vector<lrn::LocalResponseNormalizationWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int pixel_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int pixel_end = pixel_start + (num_pixels - pixel_start) / (thread_count - i);
+      tasks.emplace_back(params, input_data, output_data, depth, pixel_start, pixel_end);
+      pixel_start = pixel_end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOCAL_RESPONSE_NORMALIZATION_H__
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_PRELU_H__
+#define __NNFW_CKER_PRELU_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/eigen/Utils.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace prelu
+{
+
+// Return size of alpha which is repeated over input, or 0 if alpha is not broadcast in this way
+inline int RepeatedAlphaSize(const Shape &input_shape, const Shape &alpha_shape,
+                             const Shape &output_shape)
+{
+  if (input_shape != output_shape || alpha_shape.DimensionsCount() > input_shape.DimensionsCount())
+    return 0;
+
+  const int rank = input_shape.DimensionsCount();
+  const auto extended_alpha_shape = Shape::ExtendedShape(rank, alpha_shape);
+
+  // Leading dims of alpha are 1 and the rest are same as input
+  int i = 0;
+  while (i < rank && extended_alpha_shape.Dims(i) == 1)
+    ++i;
+  for (int j = i; j < rank; ++j)
+  {
+    if (extended_alpha_shape.Dims(j) != input_shape.Dims(j))
+      return 0;
+  }
+  return alpha_shape.FlatSize();
+}
+
+inline void PReLUElements(const float *input_data, const float *alpha_data, int alpha_size,
+                          float *output_data, int start, int end)
+{
+  if (alpha_size == 1)
+  {
+    const float alpha = alpha_data[0];
+    const VectorMap<const float> input_map(input_data + start, end - start, 1);
+    VectorMap<float> output_map(output_data + start, end - start, 1);
+    output_map = input_map.cwiseMax(0.f) + alpha * input_map.cwiseMin(0.f);
+    return;
+  }
+
+  int i = start;
+  while (i < end)
+  {
+    const int alpha_offset = i % alpha_size;
+    const int size = std::min(end - i, alpha_size - alpha_offset);
+    const VectorMap<const float> input_map(input_data + i, size, 1);
+    const VectorMap<const float> alpha_map(alpha_data + alpha_offset, size, 1);
+    VectorMap<float> output_map(output_data + i, size, 1);
+    output_map = input_map.cwiseMax(0.f) + alpha_map.cwiseProduct(input_map.cwiseMin(0.f));
+    i += size;
+  }
+}
+
+struct PReLUWorkerTask : cpu_backend_threadpool::Task
+{
+  PReLUWorkerTask(const float *input_data, const float *alpha_data, int alpha_size,
+                  float *output_data, int start, int end)
+    : input_data_(input_data), alpha_data_(alpha_data), alpha_size_(alpha_size),
+      output_data_(output_data), start_(start), end_(end)
+  {
+  }
+
+  void Run() override
+  {
+    PReLUElements(input_data_, alpha_data_, alpha_size_, output_data_, start_, end_);
+  }
+
+private:
+  const float *input_data_;
+  const float *alpha_data_;
+  int alpha_size_;
+  float *output_data_;
+  int start_;
+  int end_;
+};
+
+inline void BroadcastPReLU4D(const Shape &input_shape, const float *input_data,
+                             const Shape &alpha_shape, const float *alpha_data,
+                             const Shape &output_shape, float *output_data)
+{
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input_shape, alpha_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const float input = input_data[SubscriptToIndex(desc1, b, y, x, c)];
+          const float alpha = alpha_data[SubscriptToIndex(desc2, b, y, x, c)];
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+            input >= 0.f ? input : input * alpha;
+        }
+      }
+    }
+  }
+}
+
+} // namespace prelu
+
+// PReLU computes input >= 0 ? input : alpha * input, where alpha is broadcast to input.
+// Alpha repeated over leading dims (e.g. per channel) is vectorized and runs with multi threads
+// when ruy_context is given. Other broadcasts are supported up to 4D.
+inline void PReLU(const Shape &input_shape, const float *input_data, const Shape &alpha_shape,
+                  const float *alpha_data, const Shape &output_shape, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
+{
+  const int alpha_size = prelu::RepeatedAlphaSize(input_shape, alpha_shape, output_shape);
+  if (alpha_size == 0)
+  {
+    if (output_shape.DimensionsCount() > 4)
+      throw std::runtime_error("cker::PReLU: broadcast of rank > 4 is not supported");
+    prelu::BroadcastPReLU4D(input_shape, input_data, alpha_shape, alpha_data, output_shape,
+                            output_data);
+    return;
+  }
+
+  const int flat_size = output_shape.FlatSize();
+
+  // Split elements not to make too small tasks
+  constexpr int kMinElementsPerThread = 16384;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = std::max(1, std::min(max_threads, flat_size / kMinElementsPerThread));
+
+  if (thread_count == 1)
+  {
+    prelu::PReLUElements(input_data, alpha_data, alpha_size, output_data, 0, flat_size);
+  }
+  else
+  {
+    std::vector<prelu::PReLUWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int end = start + (flat_size - start) / (thread_count - i);
+      tasks.emplace_back(input_data, alpha_data, alpha_size, output_data, start, end);
+      start = end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+// Quantized PReLU, which is up to 4D with broadcast of alpha
+inline void PReLU(const PReLUParams &params, const Shape &input_shape, const uint8_t *input_data,
+                  const Shape &alpha_shape, const uint8_t *alpha_data, const Shape &output_shape,
+                  uint8_t *output_data)
+{
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error("cker::PReLU: rank > 4 is not supported for quantized type");
+
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input_shape, alpha_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          const int32_t input_value =
+            params.input_offset + input_data[SubscriptToIndex(desc1, b, y, x, c)];
+          int32_t output_value;
+          if (input_value >= 0)
+          {
+            output_value = MultiplyByQuantizedMultiplier(input_value, params.output_multiplier_1,
+                                                         params.output_shift_1);
+          }
+          else
+          {
+            const int32_t alpha_value =
+              params.alpha_offset + alpha_data[SubscriptToIndex(desc2, b, y, x, c)];
+            output_value = MultiplyByQuantizedMultiplier(
+              input_value * alpha_value, params.output_multiplier_2, params.output_shift_2);
+          }
+          output_value += params.output_offset;
+          output_data[Offset(extended_output_shape, b, y, x, c)] =
+            static_cast<uint8_t>(std::max(0, std::min(255, output_value)));
+        }
+      }
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PRELU_H__
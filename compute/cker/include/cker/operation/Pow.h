@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_POW_H__
 #define __NNFW_CKER_POW_H__
 
+#include "cker/ElementwiseEngine.h"
 #include "cker/Shape.h"
 
 #include <cmath>
@@ -29,13 +30,15 @@ namespace cker
 
 template <typename T>
 inline void powImpl(const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,
-                    const T *input2_data, const Shape &output_shape, T *output_data)
+                    const T *input2_data, const Shape &output_shape, T *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   const int flat_size = MatchingFlatSize(input1_shape, input2_shape, output_shape);
-  for (int i = 0; i < flat_size; ++i)
-  {
-    output_data[i] = std::pow(input1_data[i], input2_data[i]);
-  }
+  const Shape flat_shape{flat_size};
+  elementwise::BinaryOp(
+    flat_shape, input1_data, flat_shape, input2_data, flat_shape, output_data,
+    [](T a, T b) -> T { return std::pow(a, b); }, ruy_context,
+    elementwise::kMinTranscendentalElementsPerThread);
 }
 
 } // namespace cker
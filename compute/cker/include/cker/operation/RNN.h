@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/Shape.h"
+#include "cker/TensorUtils.h"
+#include "cker/Types.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/eigen/Utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace rnn
+{
+
+using RowMajorMatrixMap = Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic,
+                                                         Eigen::RowMajor>>;
+using ColMajorMatrixMap =
+  Eigen::Map<Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic>, 0, Eigen::OuterStride<>>;
+
+struct RNNArgs
+{
+  FusedActivationFunctionType activation;
+  int n_batch;
+  int n_input;
+  int n_units;
+  const float *input;
+  const float *weights;
+  const float *recurrent_weights;
+  const float *bias;
+  const float *hidden_state_in;
+  float *hidden_state_out;
+};
+
+// Compute hidden state of units in [start, end) for all batches
+inline void RNNUnits(const RNNArgs &args, int start, int end)
+{
+  const int rows = end - start;
+  const RowMajorMatrixMap weights(args.weights + start * args.n_input, rows, args.n_input);
+  const RowMajorMatrixMap recurrent_weights(args.recurrent_weights + start * args.n_units, rows,
+                                            args.n_units);
+  const MatrixMap<const float> input(args.input, args.n_input, args.n_batch);
+  const MatrixMap<const float> hidden_state_in(args.hidden_state_in, args.n_units, args.n_batch);
+  ColMajorMatrixMap result(args.hidden_state_out + start, rows, args.n_batch,
+                           Eigen::OuterStride<>(args.n_units));
+
+  result.noalias() = weights * input;
+  result.noalias() += recurrent_weights * hidden_state_in;
+  result.colwise() += VectorMap<const float>(args.bias + start, rows, 1);
+
+  for (int b = 0; b < args.n_batch; ++b)
+  {
+    float *hidden = args.hidden_state_out + b * args.n_units + start;
+    ApplyActivationToVector(hidden, rows, args.activation, hidden);
+  }
+}
+
+struct RNNWorkerTask : cpu_backend_threadpool::Task
+{
+  RNNWorkerTask(const RNNArgs &args, int start, int end) : args_(args), start_(start), end_(end) {}
+
+  void Run() override { RNNUnits(args_, start_, end_); }
+
+private:
+  const RNNArgs &args_;
+  int start_;
+  int end_;
+};
+
+} // namespace rnn
+
+// Basic RNN cell, which computes
+//   output = hidden_state_out =
+//     activation(weights * input + recurrent_weights * hidden_state_in + bias)
+// with multi threads over units when ruy_context is given.
+// hidden_state_in and hidden_state_out must not overlap.
+inline void RNN(FusedActivationFunctionType activation, const Shape &input_shape,
+                const float *input_data, const Shape &weights_shape, const float *weights_data,
+                const Shape &recurrent_weights_shape, const float *recurrent_weights_data,
+                const Shape &bias_shape, const float *bias_data,
+                const Shape &hidden_state_in_shape, const float *hidden_state_in_data,
+                const Shape &output_shape, float *output_data, float *hidden_state_out_data,
+                ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(hidden_state_in_shape);
+  assert(input_shape.DimensionsCount() == 2);
+  assert(weights_shape.DimensionsCount() == 2);
+
+  rnn::RNNArgs args;
+  args.activation = activation;
+  args.n_batch = input_shape.Dims(0);
+  args.n_input = MatchingDim(input_shape, 1, weights_shape, 1);
+  args.n_units = MatchingDim(weights_shape, 0, recurrent_weights_shape, 0);
+  assert(bias_shape.FlatSize() == args.n_units);
+  assert(hidden_state_in_shape.FlatSize() == args.n_batch * args.n_units);
+  assert(output_shape.FlatSize() == args.n_batch * args.n_units);
+  args.input = input_data;
+  args.weights = weights_data;
+  args.recurrent_weights = recurrent_weights_data;
+  args.bias = bias_data;
+  args.hidden_state_in = hidden_state_in_data;
+  args.hidden_state_out = hidden_state_out_data;
+
+  // Split units not to make too small tasks
+  constexpr int kMinMacsPerThread = 65536;
+  const int64_t macs =
+    static_cast<int64_t>(args.n_batch) * args.n_units * (args.n_input + args.n_units);
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = static_cast<int>(std::max<int64_t>(
+    1, std::min<int64_t>({max_threads, args.n_units, macs / kMinMacsPerThread})));
+
+  if (thread_count == 1)
+  {
+    rnn::RNNUnits(args, 0, args.n_units);
+  }
+  else
+  {
+    std::vector<rnn::RNNWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int end = start + (args.n_units - start) / (thread_count - i);
+      tasks.emplace_back(args, start, end);
+      start = end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+
+  std::copy_n(hidden_state_out_data, output_shape.FlatSize(), output_data);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/ReduceEngine.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -114,10 +115,10 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 }
 #endif // NEON
 
-template <typename In, typename Out>
+template <typename In, typename Out, typename Reducer>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       const Reducer &reducer, Out *output_data)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -269,6 +270,36 @@ public:
                             num_resolved_axis, temp_index_data(), reducer, output_data);
   }
 
+  // Same as above with a reducer of reduce::SumReducer, reduce::MaxReducer, etc. Reductions
+  // along adjacent axes run on the threads of ruy_context.
+  template <typename T, typename Reducer>
+  inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
+                            const Shape &output_shape, T *output_data, const std::vector<int> &axes,
+                            bool, const Reducer &reducer, ruy::Context *ruy_context)
+  {
+    // Resolve axis.
+    int num_resolved_axis = 0;
+    if (!ResolveAxis(input_shape.DimensionsCount(), axes, resolved_axis_data(), &num_resolved_axis))
+    {
+      return false;
+    }
+
+    if (reduce::ReduceAxes<T, T>(input_shape, input_data, resolved_axis_data(), num_resolved_axis,
+                                 reducer, output_data, ruy_context))
+    {
+      return true;
+    }
+
+    // Reset output data.
+    if (!InitTensorDataForReduce(output_shape, Reducer::Identity(), output_data))
+    {
+      return false;
+    }
+
+    return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
+                            num_resolved_axis, temp_index_data(), reducer, output_data);
+  }
+
   // Computes the mean of elements across dimensions given in axis.
   // It does so in two stages, first calculates the sum of elements along the axis
   // then divides it by the number of element in axis for quantized values.
@@ -278,7 +309,8 @@ public:
                                  int32_t output_zero_point, float output_scale,
                                  const Shape &output_shape, const std::vector<int> &axes,
                                  bool /*keep_dims*/, U *temp_sum, bool compute_sum,
-                                 U reducer(const U current, const T in))
+                                 U reducer(const U current, const T in),
+                                 ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     size_t num_outputs = 1;
@@ -305,7 +337,11 @@ public:
       return false;
     }
 
-    if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
+    // reducer sums up inputs, which the engine does with reduce::SumReducer
+    if (!reduce::ReduceAxes<T, U>(input_shape, input_data, resolved_axis_data(),
+                                  num_resolved_axis, reduce::SumReducer<T, U>(), temp_sum,
+                                  ruy_context) &&
+        !ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
                           num_resolved_axis, temp_index_data(), reducer, temp_sum))
     {
       return false;
@@ -151,7 +151,8 @@ public:
   template <typename In, typename Out>
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, const Shape &output_shape,
                        Out *output_data, const std::vector<int> &axes, bool, Out init_value,
-                       Out reducer(const Out current, const Out in, int normalizer))
+                       Out reducer(const Out current, const Out in, int normalizer),
+                       ruy::Context *ruy_context = nullptr)
   {
     int num_resolved_axis;
     num_resolved_axis = PrepareforReduce(input_shape, output_shape, axes, output_data, init_value);
@@ -159,6 +160,21 @@ public:
     {
       return false;
     }
+
+    // Sum up along adjacent axes first, and then divide
+    if (reduce::ReduceAxes<In, Out>(input_shape, input_data, resolved_axis_data(),
+                                    num_resolved_axis, reduce::SumReducer<In, Out>(), output_data,
+                                    ruy_context))
+    {
+      const int normalizer = ReducedSize(input_shape, num_resolved_axis);
+      const int num_outputs = output_shape.FlatSize();
+      for (int idx = 0; idx < num_outputs; idx++)
+      {
+        output_data[idx] = output_data[idx] / normalizer;
+      }
+      return true;
+    }
+
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
                                    temp_index_data(), reducer, output_data);
   }
@@ -167,7 +183,8 @@ public:
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, float input_scale,
                        int32_t input_offset, const Shape &output_shape, Out *output_data,
                        float output_scale, int32_t output_offset, const std::vector<int> &axes,
-                       bool, Out init_value, int reducer(const int current, const In in))
+                       bool, Out init_value, int reducer(const int current, const In in),
+                       ruy::Context *ruy_context = nullptr)
   {
     size_t num_outputs = 1;
     auto output_dims = output_shape.DimsData();
@@ -184,9 +201,19 @@ public:
       return false;
     }
 
-    size_t normalizer =
-      ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                             temp_index_data(), reducer, _temp_sum.data());
+    size_t normalizer;
+    if (reduce::ReduceAxes<In, int>(input_shape, input_data, resolved_axis_data(),
+                                    num_resolved_axis, reduce::SumReducer<In, int>(),
+                                    _temp_sum.data(), ruy_context))
+    {
+      normalizer = ReducedSize(input_shape, num_resolved_axis);
+    }
+    else
+    {
+      normalizer =
+        ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                               temp_index_data(), reducer, _temp_sum.data());
+    }
     if (num_outputs > 0)
     {
       float scale = input_scale / output_scale;
@@ -204,41 +231,67 @@ public:
   }
 
 private:
+  // Number of input elements reduced to an output element
+  int ReducedSize(const Shape &input_shape, int num_resolved_axis)
+  {
+    int size = 1;
+    for (int idx = 0; idx < num_resolved_axis; ++idx)
+    {
+      size *= input_shape.Dims(resolved_axis_data()[idx]);
+    }
+    return size;
+  }
+
   std::vector<int> _temp_sum;
 };
 
 template <typename In, typename Out>
 void Mean(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-          Out *output_data, const std::vector<int> &axes)
+          Out *output_data, const std::vector<int> &axes, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() > 0);
   ReduceMean m_obj;
   m_obj.ReduceOp<In, Out>(input_shape, input_data, output_shape, output_data, axes, true, (Out)0,
-                          mean_reducer);
+                          mean_reducer, ruy_context);
 }
 
 template <typename In, typename Out>
 void MeanQ8Asymm(const Shape &input_shape, const In *input_data, float input_scale,
                  int32_t input_offset, const Shape &output_shape, Out *output_data,
-                 float output_scale, int32_t output_offset, const std::vector<int> &axes)
+                 float output_scale, int32_t output_offset, const std::vector<int> &axes,
+                 ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() > 0);
   ReduceMean m_obj;
   m_obj.ReduceOp<In, Out>(input_shape, input_data, input_scale, input_offset, output_shape,
                           output_data, output_scale, output_offset, axes, true, (Out)0,
-                          sum_reducer);
+                          sum_reducer, ruy_context);
 }
 
 template <typename In, typename Out>
 void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-                   Out *output_data)
+                   Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() == 4);
   assert(output_shape.DimensionsCount() == 4);
 
+  // Global average pooling of NHWC sums up rows of depth over height and width
+  const int axis[] = {1, 2};
+  if (reduce::ReduceAxes<In, Out>(input_shape, input_data, axis, 2, reduce::SumReducer<In, Out>(),
+                                  output_data, ruy_context))
+  {
+    const int normalizer = input_shape.Dims(1) * input_shape.Dims(2);
+    const int num_outputs = output_shape.FlatSize();
+    for (int idx = 0; idx < num_outputs; idx++)
+    {
+      output_data[idx] = output_data[idx] / normalizer;
+    }
+    return;
+  }
+
   const int output_batch = output_shape.Dims(0);
   const int output_depth = output_shape.Dims(3);
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+#define __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace resize_nearest_neighbor
+{
+
+inline int32_t GetNearestNeighbor(const int input_value, const int32_t input_size,
+                                  const int32_t output_size, const bool align_corners,
+                                  const bool half_pixel_centers)
+{
+  const float scale = (align_corners && output_size > 1)
+                        ? (input_size - 1) / static_cast<float>(output_size - 1)
+                        : input_size / static_cast<float>(output_size);
+  const float offset = half_pixel_centers ? 0.5f : 0.0f;
+  int32_t output_value =
+    std::min(align_corners ? static_cast<int32_t>(std::round((input_value + offset) * scale))
+                           : static_cast<int32_t>(std::floor((input_value + offset) * scale)),
+             input_size - 1);
+  if (half_pixel_centers)
+  {
+    output_value = std::max(static_cast<int32_t>(0), output_value);
+  }
+  return output_value;
+}
+
+// Resize rows [row_start, row_end) of batch * output_height rows. Pixels are copied with memcpy
+// of depth elements, and an output row is copied as a whole when it has the same source row as
+// the previous one.
+template <typename T>
+void ResizeNearestNeighborRows(const T *input_data, int input_height, int input_width, int depth,
+                               T *output_data, int output_height, int output_width,
+                               const std::vector<int32_t> &input_ys,
+                               const std::vector<int32_t> &input_xs, int row_start, int row_end)
+{
+  const int input_row_size = input_width * depth;
+  const int output_row_size = output_width * depth;
+  for (int row = row_start; row < row_end; ++row)
+  {
+    const int b = row / output_height;
+    const int y = row % output_height;
+    T *output_row = output_data + row * output_row_size;
+    if (row > row_start && y > 0 && input_ys[y] == input_ys[y - 1])
+    {
+      std::memcpy(output_row, output_row - output_row_size, output_row_size * sizeof(T));
+      continue;
+    }
+
+    const T *input_row = input_data + (b * input_height + input_ys[y]) * input_row_size;
+    for (int x = 0; x < output_width; ++x)
+    {
+      std::memcpy(output_row + x * depth, input_row + input_xs[x] * depth, depth * sizeof(T));
+    }
+  }
+}
+
+template <typename T> struct ResizeNearestNeighborWorkerTask : cpu_backend_threadpool::Task
+{
+  ResizeNearestNeighborWorkerTask(const T *input_data, int input_height, int input_width,
+                                  int depth, T *output_data, int output_height, int output_width,
+                                  const std::vector<int32_t> &input_ys,
+                                  const std::vector<int32_t> &input_xs, int row_start,
+                                  int row_end)
+    : input_data_(input_data), input_height_(input_height), input_width_(input_width),
+      depth_(depth), output_data_(output_data), output_height_(output_height),
+      output_width_(output_width), input_ys_(input_ys), input_xs_(input_xs),
+      row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    ResizeNearestNeighborRows(input_data_, input_height_, input_width_, depth_, output_data_,
+                              output_height_, output_width_, input_ys_, input_xs_, row_start_,
+                              row_end_);
+  }
+
+private:
+  const T *input_data_;
+  int input_height_;
+  int input_width_;
+  int depth_;
+  T *output_data_;
+  int output_height_;
+  int output_width_;
+  const std::vector<int32_t> &input_ys_;
+  const std::vector<int32_t> &input_xs_;
+  int row_start_;
+  int row_end_;
+};
+
+} // namespace resize_nearest_neighbor
+
+// ResizeNearestNeighbor of NHWC input. Source indices are computed once per row and column, and
+// output rows are distributed over threads when ruy_context is given.
+template <typename T>
+void ResizeNearestNeighbor(const ResizeNearestNeighborParams &params, const Shape &input_shape,
+                           const T *input_data, const Shape &output_shape, T *output_data,
+                           ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int32_t output_height = params.output_height;
+  const int32_t output_width = params.output_width;
+  assert(output_shape.Dims(1) == output_height);
+  assert(output_shape.Dims(2) == output_width);
+
+  std::vector<int32_t> input_ys(output_height);
+  for (int y = 0; y < output_height; ++y)
+  {
+    input_ys[y] = resize_nearest_neighbor::GetNearestNeighbor(
+      y, input_height, output_height, params.align_corners, params.half_pixel_centers);
+  }
+  std::vector<int32_t> input_xs(output_width);
+  for (int x = 0; x < output_width; ++x)
+  {
+    input_xs[x] = resize_nearest_neighbor::GetNearestNeighbor(
+      x, input_width, output_width, params.align_corners, params.half_pixel_centers);
+  }
+
+  const int num_rows = batches * output_height;
+
+  // Split rows not to make too small tasks
+  constexpr int kMinElementsPerThread = 16384;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int row_size = std::max(1, output_width * depth);
+  const int thread_count = std::max(
+    1, std::min({max_threads, num_rows, num_rows * row_size / kMinElementsPerThread}));
+
+  if (thread_count == 1)
+  {
+    resize_nearest_neighbor::ResizeNearestNeighborRows(input_data, input_height, input_width,
+                                                       depth, output_data, output_height,
+                                                       output_width, input_ys, input_xs, 0,
+                                                       num_rows);
+  }
+  else
+  {
+    std::vector<resize_nearest_neighbor::ResizeNearestNeighborWorkerTask<T>> tasks;
+    tasks.reserve(thread_count);
+    int row_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int row_end = row_start + (num_rows - row_start) / (thread_count - i);
+      tasks.emplace_back(input_data, input_height, input_width, depth, output_data,
+                         output_height, output_width, input_ys, input_xs, row_start, row_end);
+      row_start = row_end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RESIZE_NEAREST_NEIGHBOR_H__
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_REDUCESQDIFF_H__
 #define __NNFW_CKER_REDUCESQDIFF_H__
 
+#include "cker/ElementwiseEngine.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 
@@ -26,71 +27,18 @@ namespace nnfw
 namespace cker
 {
 
-#define SQDIFF(N)                                                                        \
-  do                                                                                     \
-  {                                                                                      \
-    NdArrayDesc<N> input1_desc;                                                          \
-    NdArrayDesc<N> input2_desc;                                                          \
-    NdArrayDesc<N> output_desc;                                                          \
-    SqDiffImpl<T, N>(input1_shape, input1_data, input2_shape, input2_data, output_shape, \
-                     output_data, &input1_desc, &input2_desc, &output_desc);             \
-  } while (0);
-
-template <typename T, int N>
-void SqDiffImpl(const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,
-                const T *input2_data, const Shape &output_shape, T *output_data,
-                NdArrayDesc<N> *desc1_in, NdArrayDesc<N> *desc2_in, NdArrayDesc<N> *desc_out)
-{
-  std::vector<int> input_iter;
-  input_iter.resize(N);
-  const auto output_dims = output_shape.DimsData();
-
-  // Copy dims to desc, calculating strides.
-  CopyDimsToDesc<N>(output_shape, desc_out);
-  NdArrayDescsForElementwiseBroadcast<N>(input1_shape, input2_shape, desc1_in, desc2_in);
-
-  do
-  {
-    int input1_indx = SubscriptToIndexGeneric(desc1_in, input_iter.data());
-    int input2_indx = SubscriptToIndexGeneric(desc2_in, input_iter.data());
-    int output_indx = SubscriptToIndexGeneric(desc_out, input_iter.data());
-    output_data[output_indx] = (input1_data[input1_indx] - input2_data[input2_indx]) *
-                               (input1_data[input1_indx] - input2_data[input2_indx]);
-  } while (NextIndex(N, output_dims, input_iter.data()));
-}
-
 template <typename T>
 void SqDiff(const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,
-            const T *input2_data, const Shape &output_shape, T *output_data)
+            const T *input2_data, const Shape &output_shape, T *output_data,
+            ruy::Context *ruy_context = nullptr)
 {
-  UNUSED_RELEASE(output_shape);
   assert(input1_shape.DimensionsCount() > 0 && input2_shape.DimensionsCount() > 0 &&
          output_shape.DimensionsCount() > 0);
-  int outRank = output_shape.DimensionsCount();
-
-  switch (outRank)
-  {
-    case 4:
-      SQDIFF(4);
-      break;
-
-    case 3:
-      SQDIFF(3);
-      break;
-
-    case 2:
-      SQDIFF(2);
-      break;
-
-    case 1:
-      SQDIFF(1);
-      break;
-
-    default:
-      throw std::runtime_error("Support up to 4-D tensors at present");
-      break;
-  }
+  elementwise::BinaryOp(
+    input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
+    [](T a, T b) -> T { return (a - b) * (a - b); }, ruy_context);
 }
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TOPK_V2_H__
+#define __NNFW_CKER_TOPK_V2_H__
+
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/operation/ArgMinMax.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace topk
+{
+
+template <typename T> using Entry = std::pair<T, int32_t>;
+
+// Whether a is ranked before b. Larger values come first, and smaller indices on ties.
+template <typename T> inline bool Precedes(const Entry<T> &a, const Entry<T> &b)
+{
+  return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+// Rows are scanned by chunks, and chunks whose maximum is not above the current k-th value are
+// skipped with a vectorized reduction
+constexpr int kChunkSize = 64;
+
+// Use nth_element instead of heap when k is not much smaller than row
+constexpr int kHeapRowToKRatio = 16;
+
+// Select top k of a row with min-heap of k entries, without sorting the whole row
+template <typename T>
+void TopKRowWithHeap(const T *row, int row_size, int k, std::vector<Entry<T>> &heap)
+{
+  heap.clear();
+  for (int i = 0; i < k; ++i)
+  {
+    heap.emplace_back(row[i], i);
+  }
+  // The worst entry is on the top
+  std::make_heap(heap.begin(), heap.end(), Precedes<T>);
+  T threshold = heap.front().first;
+
+  for (int chunk_start = k; chunk_start < row_size; chunk_start += kChunkSize)
+  {
+    const int chunk_end = std::min(chunk_start + kChunkSize, row_size);
+    if (!(argminmax::ReduceMinMax<true>(row + chunk_start, chunk_end - chunk_start) > threshold))
+      continue;
+
+    // Entries of heap have smaller indices, so an equal value can not replace them
+    for (int i = chunk_start; i < chunk_end; ++i)
+    {
+      if (row[i] > threshold)
+      {
+        std::pop_heap(heap.begin(), heap.end(), Precedes<T>);
+        heap.back() = Entry<T>(row[i], i);
+        std::push_heap(heap.begin(), heap.end(), Precedes<T>);
+        threshold = heap.front().first;
+      }
+    }
+  }
+
+  std::sort_heap(heap.begin(), heap.end(), Precedes<T>);
+}
+
+template <typename T>
+void TopKRowWithNthElement(const T *row, int row_size, int k, std::vector<Entry<T>> &entries)
+{
+  entries.resize(row_size);
+  for (int i = 0; i < row_size; ++i)
+  {
+    entries[i] = Entry<T>(row[i], i);
+  }
+  std::nth_element(entries.begin(), entries.begin() + (k - 1), entries.end(), Precedes<T>);
+  std::sort(entries.begin(), entries.begin() + k, Precedes<T>);
+}
+
+template <typename T>
+void TopKRows(const T *input_data, int row_size, int k, T *values_data, int32_t *indices_data,
+              int row_start, int row_end)
+{
+  std::vector<Entry<T>> entries;
+  entries.reserve(k);
+  for (int r = row_start; r < row_end; ++r)
+  {
+    const T *row = input_data + r * row_size;
+    if (k * kHeapRowToKRatio <= row_size)
+    {
+      TopKRowWithHeap(row, row_size, k, entries);
+    }
+    else
+    {
+      TopKRowWithNthElement(row, row_size, k, entries);
+    }
+
+    for (int i = 0; i < k; ++i)
+    {
+      values_data[r * k + i] = entries[i].first;
+      indices_data[r * k + i] = entries[i].second;
+    }
+  }
+}
+
+template <typename T> struct TopKWorkerTask : cpu_backend_threadpool::Task
+{
+  TopKWorkerTask(const T *input_data, int row_size, int k, T *values_data, int32_t *indices_data,
+                 int row_start, int row_end)
+    : input_data_(input_data), row_size_(row_size), k_(k), values_data_(values_data),
+      indices_data_(indices_data), row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    TopKRows(input_data_, row_size_, k_, values_data_, indices_data_, row_start_, row_end_);
+  }
+
+private:
+  const T *input_data_;
+  int row_size_;
+  int k_;
+  T *values_data_;
+  int32_t *indices_data_;
+  int row_start_;
+  int row_end_;
+};
+
+} // namespace topk
+
+// TopKV2 finds k largest elements of the last dimension with their indices. Outputs are sorted
+// in descending order, and a smaller index comes first on ties.
+// Rows are distributed over threads when ruy_context is given.
+template <typename T>
+void TopKV2(const Shape &input_shape, const T *input_data, int32_t k, const Shape &output_shape,
+            T *values_data, int32_t *indices_data, ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(output_shape);
+  const int dims_count = input_shape.DimensionsCount();
+  assert(dims_count >= 1);
+  assert(output_shape.DimensionsCount() == dims_count);
+  const int row_size = input_shape.Dims(dims_count - 1);
+  assert(k >= 0 && k <= row_size);
+  assert(output_shape.Dims(dims_count - 1) == k);
+  if (k == 0)
+    return;
+
+  const int num_rows = input_shape.FlatSize() / row_size;
+
+  // Split rows not to make too small tasks
+  constexpr int kMinElementsPerThread = 16384;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = std::max(
+    1, std::min({max_threads, num_rows,
+                 static_cast<int>(static_cast<int64_t>(num_rows) * row_size /
+                                  kMinElementsPerThread)}));
+
+  if (thread_count == 1)
+  {
+    topk::TopKRows(input_data, row_size, k, values_data, indices_data, 0, num_rows);
+  }
+  else
+  {
+    std::vector<topk::TopKWorkerTask<T>> tasks;
+    tasks.reserve(thread_count);
+    int row_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      int row_end = row_start + (num_rows - row_start) / (thread_count - i);
+      tasks.emplace_back(input_data, row_size, k, values_data, indices_data, row_start, row_end);
+      row_start = row_end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TOPK_V2_H__
@@ -21,89 +21,131 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/reference/TransposeConv.h"
+#include "cker/operation/optimized/TransposeConv.h"
+
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
-inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
-                          const float *input_data, const Shape &filter_shape,
-                          const float *filter_data, const Shape &output_shape, float *output_data)
+class TransposeConv
 {
+public:
+  TransposeConv() : _hwoi_filter_shape(4), _col2im_shape(1), _prepared(false) {}
+
+  // Transpose constant filter to HWOI once, so that it is not transposed on every run and
+  // ruy can cache its packed form
+  template <typename T> void prepare(const Shape &filter_shape, const T *filter_data)
+  {
+    if (!_prepared)
+    {
+      transposeFilter(filter_shape, filter_data);
+      _prepared = true;
+    }
+  }
+
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                  float *output_data, ruy::Context *ruy_context)
+  {
+    if (!_prepared)
+    {
+      // This means that filter is not constant
+      transposeFilter(filter_shape, filter_data);
+    }
+    std::vector<float> &col2im_data = prepareCol2im(_col2im_float, input_shape, output_shape);
+
+    optimized::TransposeConv(params, input_shape, input_data, _hwoi_filter_shape,
+                             reinterpret_cast<const float *>(_hwoi_filter_data.data()), bias_shape,
+                             bias_data, output_shape, output_data, _col2im_shape,
+                             col2im_data.data(), _prepared, ruy_context);
+  }
 
-  const int stride_width = params.stride_width;
-  const int stride_height = params.stride_height;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
-
-  assert(input_shape.DimensionsCount() == 4);
-  assert(filter_shape.DimensionsCount() == 4);
-  assert(output_shape.DimensionsCount() == 4);
-
-  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
-  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
-  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
-  const int filter_height = filter_shape.Dims(1);
-  const int filter_width = filter_shape.Dims(2);
-  const int output_height = output_shape.Dims(1);
-  const int output_width = output_shape.Dims(2);
-
-  // Although transpose convolution simplifies to convolution with transposed
-  // weights for strides of 1, non-unitary striding complicates matters. To
-  // keep this reference implementation as clear as possible, we use a
-  // "scatter" access pattern, where we loop through all the input elements,
-  // computing their influence on the output, rather than looping through the
-  // output elements in the typical "gather" access pattern of a conv. We
-  // therefore must initialize the output array to zero.
-  const int num_elements = output_shape.FlatSize();
-  for (int i = 0; i < num_elements; i++)
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const uint8_t *input_data, const Shape &filter_shape,
+                  const uint8_t *filter_data, const Shape &bias_shape, const int32_t *bias_data,
+                  const Shape &output_shape, uint8_t *output_data, ruy::Context *ruy_context)
   {
-    output_data[i] = 0.0f;
+    if (!_prepared)
+    {
+      transposeFilter(filter_shape, filter_data);
+    }
+    std::vector<int32_t> &col2im_data = prepareCol2im(_col2im_int32, input_shape, output_shape);
+    _scratch_int32.resize(output_shape.FlatSize());
+
+    optimized::TransposeConvQuant(
+      params, &params.output_multiplier, &params.output_shift, false, input_shape, input_data,
+      _hwoi_filter_shape, _hwoi_filter_data.data(), bias_shape, bias_data, output_shape,
+      output_data, _col2im_shape, col2im_data.data(), _scratch_int32.data(), _prepared,
+      ruy_context);
   }
 
-  // Loop through input elements one at a time.
-  for (int batch = 0; batch < batches; ++batch)
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const int8_t *input_data, const Shape &filter_shape, const int8_t *filter_data,
+                  const Shape &bias_shape, const int32_t *bias_data, const Shape &output_shape,
+                  int8_t *output_data, ruy::Context *ruy_context)
   {
-    for (int in_y = 0; in_y < input_height; ++in_y)
+    assert(_per_channel_output_multiplier.size() == static_cast<size_t>(output_shape.Dims(3)));
+    if (!_prepared)
     {
-      for (int in_x = 0; in_x < input_width; ++in_x)
-      {
-        for (int in_channel = 0; in_channel < input_depth; ++in_channel)
-        {
-          // Loop through the output elements it will influence
-          const int out_x_origin = (in_x * stride_width) - pad_width;
-          const int out_y_origin = (in_y * stride_height) - pad_height;
-          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
-          {
-            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
-            {
-              for (int out_channel = 0; out_channel < output_depth; ++out_channel)
-              {
-                // Compute output element location
-                const int out_x = out_x_origin + filter_x;
-                const int out_y = out_y_origin + filter_y;
-                // We cannot accumulate out of bounds
-                if ((out_x >= 0) && (out_x < output_width) && (out_y >= 0) &&
-                    (out_y < output_height))
-                {
-                  float input_value =
-                    input_data[Offset(input_shape, batch, in_y, in_x, in_channel)];
-                  float filter_value =
-                    filter_data[Offset(filter_shape, out_channel, filter_y, filter_x, in_channel)];
-                  output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] +=
-                    input_value * filter_value;
-                }
-              }
-            }
-          }
-        }
-      }
+      transposeFilter(filter_shape, filter_data);
     }
+    std::vector<int32_t> &col2im_data = prepareCol2im(_col2im_int32, input_shape, output_shape);
+    _scratch_int32.resize(output_shape.FlatSize());
+
+    optimized::TransposeConvQuant(
+      params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(), true,
+      input_shape, input_data, _hwoi_filter_shape,
+      reinterpret_cast<const int8_t *>(_hwoi_filter_data.data()), bias_shape, bias_data,
+      output_shape, output_data, _col2im_shape, col2im_data.data(), _scratch_int32.data(),
+      _prepared, ruy_context);
+  }
+
+  std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
+  std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
+
+private:
+  template <typename T> void transposeFilter(const Shape &filter_shape, const T *filter_data)
+  {
+    assert(filter_shape.DimensionsCount() == 4);
+    _hwoi_filter_shape.SetDim(0, filter_shape.Dims(1));
+    _hwoi_filter_shape.SetDim(1, filter_shape.Dims(2));
+    _hwoi_filter_shape.SetDim(2, filter_shape.Dims(0));
+    _hwoi_filter_shape.SetDim(3, filter_shape.Dims(3));
+    _hwoi_filter_data.resize(filter_shape.FlatSize() * sizeof(T));
+    optimized::TransposeFilterToHWOI(filter_shape, filter_data,
+                                     reinterpret_cast<T *>(_hwoi_filter_data.data()));
+  }
+
+  // Reuse col2im buffer over runs, it is reallocated only when shapes grow
+  template <typename T>
+  std::vector<T> &prepareCol2im(std::vector<T> &col2im_data, const Shape &input_shape,
+                                const Shape &output_shape)
+  {
+    const int col2im_size = _hwoi_filter_shape.Dims(0) * _hwoi_filter_shape.Dims(1) *
+                            output_shape.Dims(3) * input_shape.Dims(1) * input_shape.Dims(2);
+    _col2im_shape.SetDim(0, col2im_size);
+    if (col2im_data.size() < static_cast<size_t>(col2im_size))
+      col2im_data.resize(col2im_size);
+    return col2im_data;
   }
-}
+
+private:
+  Shape _hwoi_filter_shape;
+  std::vector<uint8_t> _hwoi_filter_data;
+  Shape _col2im_shape;
+  std::vector<float> _col2im_float;
+  std::vector<int32_t> _col2im_int32;
+  std::vector<int32_t> _scratch_int32;
+  bool _prepared;
+  // Per channel output multiplier and shift.
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+};
 
 } // namespace cker
 } // namespace nnfw
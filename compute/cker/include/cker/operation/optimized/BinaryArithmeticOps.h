@@ -839,8 +839,7 @@ inline void BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Sh
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
-    const std::function<float(const float &, const float &)> fn =
-      [](const float &a, const float &b) -> float { return a + b; };
+    auto fn = [](const float &a, const float &b) -> float { return a + b; };
     reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                                input2_data, output_shape, output_data, fn);
   }
@@ -884,8 +883,7 @@ inline void BroadcastSubDispatch(const BinaryArithmeticOpParam &params, const Sh
   }
   else
   {
-    const std::function<float(const float &, const float &)> fn =
-      [](const float &a, const float &b) -> float { return a - b; };
+    auto fn = [](const float &a, const float &b) -> float { return a - b; };
     reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                                input2_data, output_shape, output_data, fn);
   }
@@ -1204,8 +1202,7 @@ inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Sh
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
     // TODO: Use GetBinaryArithmeticFn
-    const std::function<float(const float &, const float &)> fn =
-      [](const float &a, const float &b) -> float { return a * b; };
+    auto fn = [](const float &a, const float &b) -> float { return a * b; };
     reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                                input2_data, output_shape, output_data, fn);
     return;
@@ -1224,8 +1221,7 @@ inline void Div(const BinaryArithmeticOpParam &params, const Shape &input1_shape
   auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncDivFloat>(params);
   (*implFuncs.first)(flat_size, params, input1_data, input2_data, output_data);
 #else
-  const std::function<float(const float &, const float &)> fn =
-    [](const float &a, const float &b) -> float { return a / b; };
+  auto fn = [](const float &a, const float &b) -> float { return a / b; };
   reference::BinaryArithmeticOp(params, input1_shape, input1_data, input2_shape, input2_data,
                                 output_shape, output_data, fn);
 #endif // __aarch64__
@@ -1253,8 +1249,7 @@ inline void BroadcastDivDispatch(const BinaryArithmeticOpParam &params, const Sh
   else
 #endif // __aarch64__
   {
-    const std::function<float(const float &, const float &)> fn =
-      [](const float &a, const float &b) -> float { return a / b; };
+    auto fn = [](const float &a, const float &b) -> float { return a / b; };
     reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                                input2_data, output_shape, output_data, fn);
   }
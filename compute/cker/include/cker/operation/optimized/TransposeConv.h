@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+#include <ruy/ruy.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Transpose filter from [output_depth, filter_height, filter_width, input_depth] (OHWI) to
+// [filter_height, filter_width, output_depth, input_depth] (HWOI), which is the lhs of GEMM
+template <typename T>
+inline void TransposeFilterToHWOI(const Shape &filter_shape, const T *filter_data,
+                                  T *hwoi_filter_data)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+
+  for (int o = 0; o < output_depth; ++o)
+  {
+    for (int h = 0; h < filter_height; ++h)
+    {
+      for (int w = 0; w < filter_width; ++w)
+      {
+        const T *src = filter_data + ((o * filter_height + h) * filter_width + w) * input_depth;
+        T *dst = hwoi_filter_data + ((h * filter_width + w) * output_depth + o) * input_depth;
+        std::memcpy(dst, src, sizeof(T) * input_depth);
+      }
+    }
+  }
+}
+
+// Accumulate columns of [filter_height * filter_width * depth, input_height * input_width] into
+// image of [height, width, depth]
+template <typename T>
+inline void Col2im(const T *col_data, int depth, int height, int width, int filter_height,
+                   int filter_width, int pad_top, int pad_left, int stride_height,
+                   int stride_width, int input_height, int input_width, T *im_data)
+{
+  int h_pad = -pad_top;
+  for (int h = 0; h < input_height; ++h)
+  {
+    int w_pad = -pad_left;
+    for (int w = 0; w < input_width; ++w)
+    {
+      for (int ih = h_pad; ih < h_pad + filter_height; ++ih)
+      {
+        for (int iw = w_pad; iw < w_pad + filter_width; ++iw)
+        {
+          if (ih >= 0 && ih < height && iw >= 0 && iw < width)
+          {
+            T *im_patch_data = im_data + (ih * width + iw) * depth;
+            for (int i = 0; i < depth; ++i)
+            {
+              im_patch_data[i] += col_data[i];
+            }
+          }
+          col_data += depth;
+        }
+      }
+      w_pad += stride_width;
+    }
+    h_pad += stride_height;
+  }
+}
+
+// col[hwo, hw_in] = hwoi_filter[hwo, i] * input[i, hw_in] for a batch
+template <typename InputT, typename AccumT>
+inline void TransposeConvGemm(const InputT *hwoi_filter_data, InputT filter_zero_point,
+                              const InputT *input_data, InputT input_zero_point, int hwo_size,
+                              int input_depth, int input_image_size, AccumT *col2im_data,
+                              bool is_filter_constant, ruy::Context *ruy_context)
+{
+  MatrixParams<InputT> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = hwo_size;
+  lhs_params.cols = input_depth;
+  lhs_params.zero_point = filter_zero_point;
+  // Constant filter is packed only once by ruy
+  lhs_params.cache_policy =
+    is_filter_constant ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+
+  MatrixParams<InputT> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_depth;
+  rhs_params.cols = input_image_size;
+  rhs_params.zero_point = input_zero_point;
+
+  MatrixParams<AccumT> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = hwo_size;
+  dst_params.cols = input_image_size;
+
+  ruy::Matrix<InputT> ruy_lhs;
+  ruy::Matrix<InputT> ruy_rhs;
+  ruy::Matrix<AccumT> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, hwoi_filter_data, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, col2im_data, &ruy_dst);
+
+  ruy::MulParams<AccumT, AccumT> ruy_mul_params;
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+// TransposeConv with GEMM and col2im, filter should be transposed to HWOI by
+// TransposeFilterToHWOI in advance
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &hwoi_filter_shape,
+                          const float *hwoi_filter_data, const Shape &bias_shape,
+                          const float *bias_data, const Shape &output_shape, float *output_data,
+                          const Shape &col2im_shape, float *col2im_data,
+                          bool is_filter_constant, ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(col2im_shape);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(hwoi_filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = MatchingDim(input_shape, 3, hwoi_filter_shape, 3);
+  const int filter_height = hwoi_filter_shape.Dims(0);
+  const int filter_width = hwoi_filter_shape.Dims(1);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = MatchingDim(hwoi_filter_shape, 2, output_shape, 3);
+
+  const int input_image_size = input_height * input_width;
+  const int output_image_size = output_height * output_width;
+  const int hwo_size = filter_height * filter_width * output_depth;
+  assert(col2im_shape.FlatSize() == hwo_size * input_image_size);
+
+  const int input_offset = input_image_size * input_depth;
+  const int output_offset = output_image_size * output_depth;
+
+  std::fill_n(output_data, output_shape.FlatSize(), 0.f);
+  for (int b = 0; b < batch_size; ++b)
+  {
+    TransposeConvGemm<float, float>(hwoi_filter_data, 0.f, input_data + b * input_offset, 0.f,
+                                    hwo_size, input_depth, input_image_size, col2im_data,
+                                    is_filter_constant, ruy_context);
+
+    Col2im(col2im_data, output_depth, output_height, output_width, filter_height, filter_width,
+           params.padding_values.height, params.padding_values.width, params.stride_height,
+           params.stride_width, input_height, input_width, output_data + b * output_offset);
+  }
+
+  const int flat_size = output_shape.FlatSize();
+  for (int i = 0; i < flat_size; ++i)
+  {
+    float value = output_data[i];
+    if (bias_data != nullptr)
+      value += bias_data[i % output_depth];
+    output_data[i] = ActivationFunctionWithMinMax(value, params.float_activation_min,
+                                                  params.float_activation_max);
+  }
+}
+
+// Quantized TransposeConv. Accumulators are requantized with a multiplier for all channels
+// (uint8) or multipliers of each output channel (int8).
+template <typename T>
+inline void TransposeConvQuant(const TransposeConvParams &params,
+                               const int32_t *output_multiplier, const int *output_shift,
+                               bool per_channel, const Shape &input_shape, const T *input_data,
+                               const Shape &hwoi_filter_shape, const T *hwoi_filter_data,
+                               const Shape &bias_shape, const int32_t *bias_data,
+                               const Shape &output_shape, T *output_data,
+                               const Shape &col2im_shape, int32_t *col2im_data,
+                               int32_t *scratch_data, bool is_filter_constant,
+                               ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(bias_shape);
+  UNUSED_RELEASE(col2im_shape);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(hwoi_filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batch_size = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = MatchingDim(input_shape, 3, hwoi_filter_shape, 3);
+  const int filter_height = hwoi_filter_shape.Dims(0);
+  const int filter_width = hwoi_filter_shape.Dims(1);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = MatchingDim(hwoi_filter_shape, 2, output_shape, 3);
+
+  const int input_image_size = input_height * input_width;
+  const int output_image_size = output_height * output_width;
+  const int hwo_size = filter_height * filter_width * output_depth;
+  assert(col2im_shape.FlatSize() == hwo_size * input_image_size);
+
+  const int input_offset = input_image_size * input_depth;
+  const int output_offset = output_image_size * output_depth;
+
+  // NOTE input_offset and weights_offset of params are negative zero points
+  const T input_zero_point = static_cast<T>(-params.input_offset);
+  const T filter_zero_point = static_cast<T>(-params.weights_offset);
+
+  std::fill_n(scratch_data, output_shape.FlatSize(), 0);
+  for (int b = 0; b < batch_size; ++b)
+  {
+    TransposeConvGemm<T, int32_t>(hwoi_filter_data, filter_zero_point,
+                                  input_data + b * input_offset, input_zero_point, hwo_size,
+                                  input_depth, input_image_size, col2im_data,
+                                  is_filter_constant, ruy_context);
+
+    Col2im(col2im_data, output_depth, output_height, output_width, filter_height, filter_width,
+           params.padding_values.height, params.padding_values.width, params.stride_height,
+           params.stride_width, input_height, input_width, scratch_data + b * output_offset);
+  }
+
+  const int flat_size = output_shape.FlatSize();
+  for (int i = 0; i < flat_size; ++i)
+  {
+    const int channel = i % output_depth;
+    int32_t acc = scratch_data[i];
+    if (bias_data != nullptr)
+      acc += bias_data[channel];
+    const int index = per_channel ? channel : 0;
+    acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[index], output_shift[index]);
+    acc += params.output_offset;
+    acc = std::max(acc, params.quantized_activation_min);
+    acc = std::min(acc, params.quantized_activation_max);
+    output_data[i] = static_cast<T>(acc);
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
@@ -18,11 +18,13 @@
 #ifndef __NNFW_CKER_REFERENCE_BINARYARITHMETICOPS_H__
 #define __NNFW_CKER_REFERENCE_BINARYARITHMETICOPS_H__
 
+#include "cker/ElementwiseEngine.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
 #include <cmath>
+#include <functional>
 
 namespace nnfw
 {
@@ -31,147 +33,70 @@ namespace cker
 namespace reference
 {
 
+inline void GetActivationMinMax(const BinaryArithmeticOpParam &params, float *activation_min,
+                                float *activation_max)
+{
+  *activation_min = params.float_activation_min;
+  *activation_max = params.float_activation_max;
+}
+
 template <typename T>
-inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                               const T *input1_data, const Shape &input2_shape,
-                               const T *input2_data, const Shape &output_shape, T *output_data,
-                               const std::function<T(const T &, const T &)> &fn)
+inline void GetActivationMinMax(const BinaryArithmeticOpParam &params, T *activation_min,
+                                T *activation_max)
 {
-  const int32_t flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
-  for (int i = 0; i < flat_size; ++i)
-  {
-    output_data[i] = ActivationFunctionWithMinMax(fn(input1_data[i], input2_data[i]),
-                                                  params.quantized_activation_min,
-                                                  params.quantized_activation_max);
-  }
+  *activation_min = static_cast<T>(params.quantized_activation_min);
+  *activation_max = static_cast<T>(params.quantized_activation_max);
 }
 
-template <>
+template <typename T, typename Fn>
 inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
-                               const float *input1_data, const Shape &input2_shape,
-                               const float *input2_data, const Shape &output_shape,
-                               float *output_data,
-                               const std::function<float(const float &, const float &)> &fn)
+                               const T *input1_data, const Shape &input2_shape,
+                               const T *input2_data, const Shape &output_shape, T *output_data,
+                               const Fn &fn, ruy::Context *ruy_context = nullptr)
 {
+  T activation_min, activation_max;
+  GetActivationMinMax(params, &activation_min, &activation_max);
   const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = ActivationFunctionWithMinMax(
-      fn(input1_data[i], input2_data[i]), params.float_activation_min, params.float_activation_max);
-  }
+  const Shape flat_shape{size};
+  elementwise::BinaryOp(
+    flat_shape, input1_data, flat_shape, input2_data, flat_shape, output_data,
+    [&](const T &a, const T &b) {
+      return ActivationFunctionWithMinMax<T>(fn(a, b), activation_min, activation_max);
+    },
+    ruy_context);
 }
 
 template <typename T>
 inline typename std::enable_if_t<is_quant8<T>::value> BroadcastBinaryArithmeticOpSlow(
   const BinaryArithmeticOpParam &params, const Shape &input1_shape, const T *input1_data,
   const Shape &input2_shape, const T *input2_data, const Shape &output_shape, T *output_data,
-  const std::function<T(const BinaryArithmeticOpParam &params, const T &, const T &)> &fn)
+  const std::function<T(const BinaryArithmeticOpParam &params, const T &, const T &)> &fn,
+  ruy::Context *ruy_context = nullptr)
 {
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
-  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
-
-  // Comment from tensorflow lite:
-  //
-  // In Tensorflow, the dimensions are canonically named (batch_number, row,
-  // col, channel), with extents (batches, height, width, depth), with the
-  // trailing dimension changing most rapidly (channels has the smallest stride,
-  // typically 1 element).
-  //
-  // In generated C code, we store arrays with the dimensions reversed. The
-  // first dimension has smallest stride.
-  //
-  // We name our variables by their Tensorflow convention, but generate C code
-  // nesting loops such that the innermost loop has the smallest stride for the
-  // best cache behavior.
-  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
-        {
-          output_data[Offset(extended_output_shape, b, y, x, c)] = ActivationFunctionWithMinMax<T>(
-            fn(params, input1_data[SubscriptToIndex(desc1, b, y, x, c)],
-               input2_data[SubscriptToIndex(desc2, b, y, x, c)]),
-            params.quantized_activation_min, params.quantized_activation_max);
-        }
-      }
-    }
-  }
+  elementwise::BinaryOp(
+    input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
+    [&](const T &a, const T &b) {
+      return ActivationFunctionWithMinMax<T>(fn(params, a, b), params.quantized_activation_min,
+                                             params.quantized_activation_max);
+    },
+    ruy_context);
 }
-template <typename T>
+
+template <typename T, typename Fn>
 inline void BroadcastBinaryArithmeticOpSlow(const BinaryArithmeticOpParam &params,
                                             const Shape &input1_shape, const T *input1_data,
                                             const Shape &input2_shape, const T *input2_data,
                                             const Shape &output_shape, T *output_data,
-                                            const std::function<T(const T &, const T &)> &fn)
-{
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
-  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
-
-  // Comment from tensorflow lite:
-  //
-  // In Tensorflow, the dimensions are canonically named (batch_number, row,
-  // col, channel), with extents (batches, height, width, depth), with the
-  // trailing dimension changing most rapidly (channels has the smallest stride,
-  // typically 1 element).
-  //
-  // In generated C code, we store arrays with the dimensions reversed. The
-  // first dimension has smallest stride.
-  //
-  // We name our variables by their Tensorflow convention, but generate C code
-  // nesting loops such that the innermost loop has the smallest stride for the
-  // best cache behavior.
-  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
-        {
-          output_data[Offset(extended_output_shape, b, y, x, c)] = ActivationFunctionWithMinMax<T>(
-            fn(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
-               input2_data[SubscriptToIndex(desc2, b, y, x, c)]),
-            params.quantized_activation_min, params.quantized_activation_max);
-        }
-      }
-    }
-  }
-}
-
-template <>
-inline void BroadcastBinaryArithmeticOpSlow(
-  const BinaryArithmeticOpParam &params, const Shape &input1_shape, const float *input1_data,
-  const Shape &input2_shape, const float *input2_data, const Shape &output_shape,
-  float *output_data, const std::function<float(const float &, const float &)> &fn)
+                                            const Fn &fn, ruy::Context *ruy_context = nullptr)
 {
-  NdArrayDesc<4> desc1;
-  NdArrayDesc<4> desc2;
-  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
-  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
-
-  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
-  {
-    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
-    {
-      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
-      {
-        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
-        {
-          output_data[Offset(extended_output_shape, b, y, x, c)] =
-            ActivationFunctionWithMinMax(fn(input1_data[SubscriptToIndex(desc1, b, y, x, c)],
-                                            input2_data[SubscriptToIndex(desc2, b, y, x, c)]),
-                                         params.float_activation_min, params.float_activation_max);
-        }
-      }
-    }
-  }
+  T activation_min, activation_max;
+  GetActivationMinMax(params, &activation_min, &activation_max);
+  elementwise::BinaryOp(
+    input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
+    [&](const T &a, const T &b) {
+      return ActivationFunctionWithMinMax<T>(fn(a, b), activation_min, activation_max);
+    },
+    ruy_context);
 }
 
 } // namespace reference
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ArgMinMax.h>
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+template <typename T>
+void VerifyArgMinMax(const std::vector<T> &input, const nnfw::cker::Shape &input_shape,
+                     const nnfw::cker::Shape &output_shape, int axis, bool is_arg_max)
+{
+  std::vector<int32_t> output(output_shape.FlatSize());
+  std::vector<int32_t> expected(output_shape.FlatSize());
+
+  nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, output.data(), axis, is_arg_max);
+  if (is_arg_max)
+    nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, expected.data(), axis,
+                          std::greater<T>());
+  else
+    nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, expected.data(), axis,
+                          std::less<T>());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_EQ(output[i], expected[i]);
+}
+
+} // namespace
+
+TEST(CKer_Operation, ArgMinMax)
+{
+  nnfw::cker::Shape input_shape{3, 37, 5};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>((i * 13) % 17);
+
+  for (bool is_arg_max : {true, false})
+  {
+    // Last axis is reduced contiguously, others are reduced slice by slice
+    VerifyArgMinMax(input, input_shape, nnfw::cker::Shape{3, 37}, 2, is_arg_max);
+    VerifyArgMinMax(input, input_shape, nnfw::cker::Shape{3, 5}, 1, is_arg_max);
+    VerifyArgMinMax(input, input_shape, nnfw::cker::Shape{37, 5}, 0, is_arg_max);
+  }
+
+  // Long row with the largest value repeated
+  nnfw::cker::Shape row_shape{1, 1000};
+  std::vector<uint8_t> row(1000);
+  for (size_t i = 0; i < row.size(); ++i)
+    row[i] = static_cast<uint8_t>((i * 7) % 251);
+  VerifyArgMinMax(row, row_shape, nnfw::cker::Shape{1}, -1, true);
+  VerifyArgMinMax(row, row_shape, nnfw::cker::Shape{1}, -1, false);
+}
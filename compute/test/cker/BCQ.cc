@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQ.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Random BCQ weights with their dequantized values as reference
+struct BCQWeights
+{
+  BCQWeights(const std::vector<int32_t> &clusters, int hidden_size) : clusters{clusters}
+  {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> alpha_dist(0.1f, 1.f);
+    std::uniform_int_distribution<uint32_t> bits_dist;
+
+    const int num_words = (hidden_size + 31) / 32;
+    for (size_t c = 0; c < clusters.size() / 2; ++c)
+    {
+      const int qbits = clusters[c * 2];
+      const int rows = clusters[c * 2 + 1];
+      for (int r = 0; r < rows; ++r)
+      {
+        std::vector<float> row(hidden_size, 0.f);
+        for (int k = 0; k < qbits; ++k)
+        {
+          const float a = alpha_dist(gen);
+          alpha.push_back(a);
+          for (int w = 0; w < num_words; ++w)
+          {
+            const uint32_t word = bits_dist(gen);
+            binary.push_back(static_cast<int32_t>(word));
+            for (int j = 0; j < 32 && w * 32 + j < hidden_size; ++j)
+              row[w * 32 + j] += ((word >> j) & 1u) ? a : -a;
+          }
+        }
+        weights.push_back(row);
+      }
+    }
+
+    alpha_shape.ReplaceWith({static_cast<int>(alpha.size())});
+    binary_shape.ReplaceWith({static_cast<int>(alpha.size()), num_words});
+    clusters_shape.ReplaceWith({static_cast<int>(clusters.size() / 2), 2});
+  }
+
+  std::vector<int32_t> clusters;
+  std::vector<float> alpha;
+  std::vector<int32_t> binary;
+  std::vector<std::vector<float>> weights;
+  nnfw::cker::Shape alpha_shape;
+  nnfw::cker::Shape binary_shape;
+  nnfw::cker::Shape clusters_shape;
+};
+
+} // namespace
+
+TEST(CKer_Operation, BCQFullyConnected)
+{
+  const int hidden_size = 70;
+  const int batch_size = 3;
+  BCQWeights bcq({3, 5, 2, 4}, hidden_size);
+  const int num_rows = static_cast<int>(bcq.weights.size());
+
+  std::vector<float> input(hidden_size * batch_size);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 7) * 0.25f - 0.5f;
+  std::vector<float> bias(num_rows);
+  for (int o = 0; o < num_rows; ++o)
+    bias[o] = o * 0.1f;
+
+  nnfw::cker::BCQFullyConnectedParams params;
+  std::vector<float> output(num_rows * batch_size);
+  nnfw::cker::BCQFullyConnected(
+    params, nnfw::cker::Shape{hidden_size, batch_size}, input.data(), bcq.alpha_shape,
+    bcq.alpha.data(), bcq.binary_shape, bcq.binary.data(), bcq.clusters_shape, bcq.clusters.data(),
+    nnfw::cker::Shape{num_rows}, bias.data(), nnfw::cker::Shape{num_rows, batch_size},
+    output.data());
+
+  for (int o = 0; o < num_rows; ++o)
+  {
+    for (int b = 0; b < batch_size; ++b)
+    {
+      float expected = bias[o];
+      for (int h = 0; h < hidden_size; ++h)
+        expected += bcq.weights[o][h] * input[h * batch_size + b];
+      EXPECT_NEAR(output[o * batch_size + b], expected, 1e-4f);
+    }
+  }
+}
+
+TEST(CKer_Operation, BCQFullyConnectedMultiThreads)
+{
+  const int hidden_size = 100;
+  const int batch_size = 2;
+  BCQWeights bcq({2, 50, 3, 30}, hidden_size);
+  const int num_rows = static_cast<int>(bcq.weights.size());
+
+  std::vector<float> input(hidden_size * batch_size);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 5) * 0.5f - 1.f;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  nnfw::cker::BCQFullyConnectedParams params;
+  std::vector<float> output(num_rows * batch_size);
+  nnfw::cker::BCQFullyConnected(params, nnfw::cker::Shape{hidden_size, batch_size}, input.data(),
+                                bcq.alpha_shape, bcq.alpha.data(), bcq.binary_shape,
+                                bcq.binary.data(), bcq.clusters_shape, bcq.clusters.data(),
+                                nnfw::cker::Shape{}, nullptr,
+                                nnfw::cker::Shape{num_rows, batch_size}, output.data(),
+                                &ruy_context);
+
+  for (int o = 0; o < num_rows; ++o)
+  {
+    for (int b = 0; b < batch_size; ++b)
+    {
+      float expected = 0.f;
+      for (int h = 0; h < hidden_size; ++h)
+        expected += bcq.weights[o][h] * input[h * batch_size + b];
+      EXPECT_NEAR(output[o * batch_size + b], expected, 1e-4f);
+    }
+  }
+}
+
+TEST(CKer_Operation, BCQFullyConnectedRelu)
+{
+  const int hidden_size = 32;
+  const int batch_size = 1;
+  BCQWeights bcq({1, 8}, hidden_size);
+  const int num_rows = static_cast<int>(bcq.weights.size());
+
+  std::vector<float> input(hidden_size, 1.f);
+
+  nnfw::cker::BCQFullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  std::vector<float> output(num_rows);
+  nnfw::cker::BCQFullyConnected(params, nnfw::cker::Shape{hidden_size, batch_size}, input.data(),
+                                bcq.alpha_shape, bcq.alpha.data(), bcq.binary_shape,
+                                bcq.binary.data(), bcq.clusters_shape, bcq.clusters.data(),
+                                nnfw::cker::Shape{}, nullptr,
+                                nnfw::cker::Shape{num_rows, batch_size}, output.data());
+
+  for (int o = 0; o < num_rows; ++o)
+  {
+    float expected = 0.f;
+    for (int h = 0; h < hidden_size; ++h)
+      expected += bcq.weights[o][h];
+    EXPECT_NEAR(output[o], std::max(0.f, expected), 1e-4f);
+  }
+}
+
+TEST(CKer_Operation, BCQGather)
+{
+  const int hidden_size = 40;
+  BCQWeights bcq({2, 3, 4, 2}, hidden_size);
+  const int num_rows = static_cast<int>(bcq.weights.size());
+
+  // Gather rows
+  {
+    std::vector<int32_t> coords = {4, 0, 2};
+    nnfw::cker::BCQGatherParams params{0, hidden_size};
+    std::vector<float> output(coords.size() * hidden_size);
+    nnfw::cker::BCQGather(params, bcq.alpha_shape, bcq.alpha.data(), bcq.binary_shape,
+                          bcq.binary.data(), nnfw::cker::Shape{3}, coords.data(),
+                          bcq.clusters_shape, bcq.clusters.data(),
+                          nnfw::cker::Shape{3, hidden_size}, output.data());
+
+    for (size_t i = 0; i < coords.size(); ++i)
+      for (int h = 0; h < hidden_size; ++h)
+        EXPECT_NEAR(output[i * hidden_size + h], bcq.weights[coords[i]][h], 1e-5f);
+  }
+
+  // Gather columns
+  {
+    std::vector<int32_t> coords = {39, 1};
+    nnfw::cker::BCQGatherParams params{1, hidden_size};
+    std::vector<float> output(num_rows * coords.size());
+    nnfw::cker::BCQGather(params, bcq.alpha_shape, bcq.alpha.data(), bcq.binary_shape,
+                          bcq.binary.data(), nnfw::cker::Shape{2}, coords.data(),
+                          bcq.clusters_shape, bcq.clusters.data(),
+                          nnfw::cker::Shape{num_rows, 2}, output.data());
+
+    for (int o = 0; o < num_rows; ++o)
+      for (size_t i = 0; i < coords.size(); ++i)
+        EXPECT_NEAR(output[o * coords.size() + i], bcq.weights[o][coords[i]], 1e-5f);
+  }
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Comparison.h>
+#include <cker/operation/Elementwise.h>
+#include <cker/operation/Select.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+// Offset of an element of a broadcast input from the multi-dimensional output index
+int BroadcastOffset(const nnfw::cker::Shape &input_shape, const nnfw::cker::Shape &output_shape,
+                    const std::vector<int> &index)
+{
+  const int offset = output_shape.DimensionsCount() - input_shape.DimensionsCount();
+  int result = 0;
+  for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+  {
+    const int dim = input_shape.Dims(i);
+    result = result * dim + ((dim == 1) ? 0 : index[i + offset]);
+  }
+  return result;
+}
+
+std::vector<float> Iota(int size, float scale)
+{
+  std::vector<float> v(size);
+  for (int i = 0; i < size; ++i)
+    v[i] = scale * (i % 13 - 6);
+  return v;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ElementwiseEngine_Binary)
+{
+  const nnfw::cker::Shape output_shape{2, 3, 64, 5, 40};
+  // Broadcast patterns which collapse to different ranks, and an input of lower rank
+  const std::vector<std::pair<nnfw::cker::Shape, nnfw::cker::Shape>> shapes{
+    {output_shape, output_shape},
+    {output_shape, nnfw::cker::Shape{1}},
+    {nnfw::cker::Shape{2, 1, 64, 1, 40}, nnfw::cker::Shape{1, 3, 1, 5, 1}},
+    {nnfw::cker::Shape{2, 3, 1, 1, 40}, nnfw::cker::Shape{64, 5, 40}},
+    {nnfw::cker::Shape{1, 1, 1, 1, 1}, nnfw::cker::Shape{2, 3, 64, 5, 1}}};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  for (const auto &shape : shapes)
+  {
+    const auto input1 = Iota(shape.first.FlatSize(), 0.5f);
+    const auto input2 = Iota(shape.second.FlatSize(), 0.25f);
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<int> index(output_shape.DimensionsCount(), 0);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      int remain = i;
+      for (int d = output_shape.DimensionsCount() - 1; d >= 0; --d)
+      {
+        index[d] = remain % output_shape.Dims(d);
+        remain /= output_shape.Dims(d);
+      }
+      expected[i] = input1[BroadcastOffset(shape.first, output_shape, index)] *
+                    input2[BroadcastOffset(shape.second, output_shape, index)];
+    }
+
+    for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      std::vector<float> output(expected.size());
+      nnfw::cker::elementwise::BinaryOp(
+        shape.first, input1.data(), shape.second, input2.data(), output_shape, output.data(),
+        [](float a, float b) { return a * b; }, ctx);
+      ASSERT_EQ(output, expected);
+
+      std::vector<bool> expected_less(expected.size());
+      for (size_t i = 0; i < expected.size(); ++i)
+        expected_less[i] = expected[i] < 0.f;
+      std::unique_ptr<bool[]> less(new bool[expected.size()]);
+      // Compare with a zero scalar of output rank
+      const float zero = 0.f;
+      nnfw::cker::Broadcast4DSlowLess(output_shape, expected.data(),
+                                      nnfw::cker::Shape{1, 1, 1, 1, 1}, &zero, output_shape,
+                                      less.get(), ctx);
+      for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(less[i], expected_less[i]);
+    }
+  }
+}
+
+TEST(CKer_Operation, ElementwiseEngine_BinaryArithmetic)
+{
+  const nnfw::cker::Shape input1_shape{4, 1, 3, 1};
+  const nnfw::cker::Shape input2_shape{1, 5, 1, 2};
+  const nnfw::cker::Shape output_shape{4, 5, 3, 2};
+  const auto input1 = Iota(input1_shape.FlatSize(), 1.f);
+  const auto input2 = Iota(input2_shape.FlatSize(), 2.f);
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 6.f;
+  ASSERT_TRUE(nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params));
+
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
+    params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape,
+    output.data());
+
+  for (int n = 0; n < 4; ++n)
+    for (int h = 0; h < 5; ++h)
+      for (int w = 0; w < 3; ++w)
+        for (int c = 0; c < 2; ++c)
+        {
+          const float expected = std::min(6.f, std::max(0.f, input1[n * 3 + w] - input2[h * 2 + c]));
+          ASSERT_EQ(output[((n * 5 + h) * 3 + w) * 2 + c], expected);
+        }
+
+  // Same shaped inputs split over threads
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  const nnfw::cker::Shape flat_shape{100000};
+  const auto flat_input1 = Iota(flat_shape.FlatSize(), 1.f);
+  const auto flat_input2 = Iota(flat_shape.FlatSize(), 0.5f);
+  std::vector<float> flat_output(flat_shape.FlatSize());
+  nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::ADD>(
+    params, flat_shape, flat_input1.data(), flat_shape, flat_input2.data(), flat_shape,
+    flat_output.data(), &ruy_context);
+  for (int i = 0; i < flat_shape.FlatSize(); ++i)
+    ASSERT_EQ(flat_output[i], std::min(6.f, std::max(0.f, flat_input1[i] + flat_input2[i])));
+}
+
+TEST(CKer_Operation, ElementwiseEngine_Select)
+{
+  const nnfw::cker::Shape cond_shape{3, 1};
+  const nnfw::cker::Shape x_shape{3, 4};
+  const nnfw::cker::Shape y_shape{1, 4};
+  const bool cond[3] = {true, false, true};
+  const auto x = Iota(x_shape.FlatSize(), 1.f);
+  const auto y = Iota(y_shape.FlatSize(), -1.f);
+
+  std::vector<float> output(x_shape.FlatSize());
+  nnfw::cker::BroadcastSelect4DSlow(cond_shape, cond, x_shape, x.data(), y_shape, y.data(),
+                                    x_shape, output.data());
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      ASSERT_EQ(output[i * 4 + j], cond[i] ? x[i * 4 + j] : y[j]);
+}
+
+TEST(CKer_Operation, ElementwiseEngine_Unary)
+{
+  const nnfw::cker::Shape shape{3, 10000};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 0.001f * i + 0.01f;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<float> output(input.size());
+    nnfw::cker::Sin(shape, input.data(), shape, output.data(), ctx);
+    for (size_t i = 0; i < input.size(); ++i)
+      ASSERT_NEAR(output[i], std::sin(input[i]), 1e-5f);
+
+    nnfw::cker::Log(shape, input.data(), shape, output.data(), ctx);
+    for (size_t i = 0; i < input.size(); ++i)
+      ASSERT_NEAR(output[i], std::log(input[i]), 1e-5f);
+
+    nnfw::cker::Rsqrt(shape, input.data(), shape, output.data(), ctx);
+    for (size_t i = 0; i < input.size(); ++i)
+      ASSERT_FLOAT_EQ(output[i], 1.f / std::sqrt(input[i]));
+  }
+}
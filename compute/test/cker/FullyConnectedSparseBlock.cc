@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Dense weights of which about half of blocks are zero, and its block sparse form
+template <typename T> struct BlockSparseWeights
+{
+  BlockSparseWeights(int rows, int cols, int block_rows, int block_cols)
+    : dense(rows * cols, 0), segments{0}
+  {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> value_dist(-100, 100);
+    std::bernoulli_distribution keep_dist(0.5);
+    for (int i = 0; i < rows / block_rows; ++i)
+    {
+      for (int j = 0; j < cols / block_cols; ++j)
+      {
+        if (!keep_dist(gen))
+          continue;
+        indices.push_back(j);
+        for (int r = 0; r < block_rows; ++r)
+        {
+          for (int c = 0; c < block_cols; ++c)
+          {
+            const T value = static_cast<T>(value_dist(gen)) / (sizeof(T) == 1 ? 1 : 100);
+            dense[(i * block_rows + r) * cols + j * block_cols + c] = value;
+            sparse.push_back(value);
+          }
+        }
+      }
+      segments.push_back(indices.size());
+    }
+  }
+
+  std::vector<T> dense;
+  std::vector<T> sparse;
+  std::vector<uint16_t> segments;
+  std::vector<uint16_t> indices;
+};
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedSparseBlock)
+{
+  const int batches = 3;
+  const int rows = 64;
+  const int cols = 48;
+
+  std::vector<float> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 0.01f * (static_cast<int>(i % 17) - 8);
+  std::vector<float> bias(rows);
+  for (int i = 0; i < rows; ++i)
+    bias[i] = 0.1f * (i % 5);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+  const nnfw::cker::Shape input_shape{batches, cols};
+  const nnfw::cker::Shape weights_shape{rows, cols};
+  const nnfw::cker::Shape bias_shape{rows};
+  const nnfw::cker::Shape output_shape{batches, rows};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Unrolled block sizes and a block size only known at runtime
+  const std::vector<std::pair<int, int>> block_sizes{{16, 1}, {8, 1}, {4, 4}, {1, 16}, {2, 3}};
+  for (const auto &block_size : block_sizes)
+  {
+    BlockSparseWeights<float> weights(rows, cols, block_size.first, block_size.second);
+
+    std::vector<float> expected(batches * rows);
+    for (int b = 0; b < batches; ++b)
+    {
+      for (int r = 0; r < rows; ++r)
+      {
+        float acc = bias[r];
+        for (int c = 0; c < cols; ++c)
+          acc += weights.dense[r * cols + c] * input[b * cols + c];
+        expected[b * rows + r] = acc;
+      }
+    }
+
+    for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      std::vector<float> output(batches * rows);
+      nnfw::cker::FullyConnectedSparseWeightBlock(
+        params, input_shape, input.data(), weights_shape, weights.sparse.data(), bias_shape,
+        bias.data(), output_shape, output.data(), weights.segments.data(),
+        weights.indices.data(), block_size.first, block_size.second, ctx);
+      for (size_t i = 0; i < output.size(); ++i)
+        ASSERT_NEAR(output[i], expected[i], 1e-4f);
+    }
+  }
+}
+
+TEST(CKer_Operation, FullyConnectedSparseBlock_Int8)
+{
+  const int batches = 2;
+  const int rows = 32;
+  const int cols = 64;
+
+  std::vector<int8_t> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int8_t>(static_cast<int>(i * 37 % 255) - 127);
+  std::vector<int32_t> bias(rows);
+  for (int i = 0; i < rows; ++i)
+    bias[i] = 100 * (i % 7) - 300;
+
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = 3; // input zero point is -3
+  params.output_offset = -5;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  // Different output scales of each channel
+  std::vector<int32_t> multipliers(rows);
+  std::vector<int> shifts(rows);
+  for (int i = 0; i < rows; ++i)
+  {
+    multipliers[i] = (1 << 30) + i * (1 << 24);
+    shifts[i] = -10 - (i % 2);
+  }
+
+  const nnfw::cker::Shape input_shape{batches, cols};
+  const nnfw::cker::Shape weights_shape{rows, cols};
+  const nnfw::cker::Shape bias_shape{rows};
+  const nnfw::cker::Shape output_shape{batches, rows};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const std::vector<std::pair<int, int>> block_sizes{{16, 1}, {4, 4}, {1, 16}, {2, 8}};
+  for (const auto &block_size : block_sizes)
+  {
+    BlockSparseWeights<int8_t> weights(rows, cols, block_size.first, block_size.second);
+
+    std::vector<int8_t> expected(batches * rows);
+    for (int b = 0; b < batches; ++b)
+    {
+      for (int r = 0; r < rows; ++r)
+      {
+        int32_t acc = bias[r];
+        for (int c = 0; c < cols; ++c)
+          acc += weights.dense[r * cols + c] * (input[b * cols + c] + params.input_offset);
+        acc = nnfw::cker::MultiplyByQuantizedMultiplier(acc, multipliers[r], shifts[r]);
+        acc += params.output_offset;
+        expected[b * rows + r] = static_cast<int8_t>(std::min(127, std::max(-128, acc)));
+      }
+    }
+
+    for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      std::vector<int8_t> output(batches * rows);
+      std::vector<int32_t> scratch(batches * rows);
+      nnfw::cker::FullyConnectedSparseWeightBlock(
+        params, multipliers.data(), shifts.data(), true, input_shape, input.data(), weights_shape,
+        weights.sparse.data(), bias_shape, bias.data(), output_shape, output.data(),
+        scratch.data(), weights.segments.data(), weights.indices.data(), block_size.first,
+        block_size.second, ctx);
+      ASSERT_EQ(output, expected);
+    }
+  }
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FusedLSTM.h>
+#include <cker/operation/LSTM.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct LSTMWeights
+{
+  LSTMWeights(int n_cell, int n_input, int n_output, bool use_cifg, bool use_peephole,
+              bool use_projection)
+  {
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    auto fill = [&](std::vector<float> &v, size_t size) {
+      v.resize(size);
+      for (auto &e : v)
+        e = dist(gen);
+    };
+    for (int g = 0; g < 4; ++g)
+    {
+      if (g == 0 && use_cifg)
+        continue;
+      fill(input_weights[g], n_cell * n_input);
+      fill(recurrent_weights[g], n_cell * n_output);
+      fill(biases[g], n_cell);
+      if (use_peephole)
+        fill(peephole[g], n_cell);
+    }
+    if (use_projection)
+    {
+      fill(projection_weights, n_output * n_cell);
+      fill(projection_bias, n_output);
+    }
+  }
+
+  const float *ptr(const std::vector<float> &v) const { return v.empty() ? nullptr : v.data(); }
+
+  // {input, forget, cell, output} gates
+  std::vector<float> input_weights[4];
+  std::vector<float> recurrent_weights[4];
+  std::vector<float> biases[4];
+  std::vector<float> peephole[4];
+  std::vector<float> projection_weights;
+  std::vector<float> projection_bias;
+};
+
+void runLstmStep(const LSTMWeights &w, const nnfw::cker::LSTMParams &params,
+                 const std::vector<float> &input, int n_batch, int n_cell, int n_input,
+                 int n_output, std::vector<float> &output_state, std::vector<float> &cell_state,
+                 std::vector<float> &output)
+{
+  std::vector<float> scratch(4 * n_batch * n_cell);
+  nnfw::cker::LstmStepFloat(
+    input.data(), w.ptr(w.input_weights[0]), w.ptr(w.input_weights[1]),
+    w.ptr(w.input_weights[2]), w.ptr(w.input_weights[3]), nullptr, nullptr, nullptr, nullptr,
+    nullptr, w.ptr(w.recurrent_weights[0]), w.ptr(w.recurrent_weights[1]),
+    w.ptr(w.recurrent_weights[2]), w.ptr(w.recurrent_weights[3]), w.ptr(w.peephole[0]),
+    w.ptr(w.peephole[1]), w.ptr(w.peephole[3]), nullptr, nullptr, nullptr, nullptr,
+    w.ptr(w.biases[0]), w.ptr(w.biases[1]), w.ptr(w.biases[2]), w.ptr(w.biases[3]),
+    w.ptr(w.projection_weights), w.ptr(w.projection_bias), &params, n_batch, n_cell, n_input, 0,
+    n_output, n_output, output_state.data(), cell_state.data(), scratch.data(),
+    scratch.data() + n_batch * n_cell, scratch.data() + 2 * n_batch * n_cell,
+    scratch.data() + 3 * n_batch * n_cell, output.data());
+}
+
+void runFusedLstmStep(nnfw::cker::FusedLSTM &lstm, const LSTMWeights &w,
+                      const nnfw::cker::LSTMParams &params, const std::vector<float> &input,
+                      int n_batch, int n_output, std::vector<float> &output_state,
+                      std::vector<float> &cell_state, std::vector<float> &output,
+                      ruy::Context *ruy_context = nullptr)
+{
+  lstm(params, input.data(), w.ptr(w.peephole[0]), w.ptr(w.peephole[1]), w.ptr(w.peephole[3]),
+       w.ptr(w.projection_weights), w.ptr(w.projection_bias), n_batch, n_output,
+       output_state.data(), cell_state.data(), output.data(), ruy_context);
+}
+
+void testFloat(int n_cell, int n_input, int n_output, bool use_cifg, bool use_peephole,
+               bool use_projection)
+{
+  const int n_batch = 3;
+  const LSTMWeights w(n_cell, n_input, n_output, use_cifg, use_peephole, use_projection);
+
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 3.0f;
+  params.proj_clip = use_projection ? 0.8f : 0.0f;
+
+  const float *input_weights[4];
+  const float *recurrent_weights[4];
+  const float *biases[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    input_weights[g] = w.ptr(w.input_weights[g]);
+    recurrent_weights[g] = w.ptr(w.recurrent_weights[g]);
+    biases[g] = w.ptr(w.biases[g]);
+  }
+  nnfw::cker::FusedLSTM lstm;
+  lstm.prepare(input_weights, recurrent_weights, biases, n_cell, n_input, n_output);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  std::vector<float> expected_output_state(n_batch * n_output, 0.f);
+  std::vector<float> expected_cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> expected_output(n_batch * n_output);
+  std::vector<float> output_state(expected_output_state);
+  std::vector<float> cell_state(expected_cell_state);
+  std::vector<float> output(expected_output.size());
+
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> input(n_batch * n_input);
+  for (int t = 0; t < 4; ++t)
+  {
+    for (auto &e : input)
+      e = dist(gen);
+    runLstmStep(w, params, input, n_batch, n_cell, n_input, n_output, expected_output_state,
+                expected_cell_state, expected_output);
+    runFusedLstmStep(lstm, w, params, input, n_batch, n_output, output_state, cell_state, output,
+                     &ruy_context);
+
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+      ASSERT_NEAR(output[i], expected_output[i], 1e-4f);
+      ASSERT_NEAR(output_state[i], expected_output_state[i], 1e-4f);
+    }
+    for (size_t i = 0; i < cell_state.size(); ++i)
+      ASSERT_NEAR(cell_state[i], expected_cell_state[i], 1e-4f);
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, FusedLSTM)
+{
+  // Basic LSTM with cells of multiple blocks
+  testFloat(80, 24, 80, false, false, false);
+  // CIFG with peephole
+  testFloat(40, 16, 40, true, true, false);
+  // Peephole and projection, which is split over threads
+  testFloat(300, 32, 260, false, true, true);
+}
+
+TEST(CKer_Operation, FusedLSTM_Hybrid)
+{
+  const int n_batch = 2;
+  const int n_cell = 48;
+  const int n_input = 20;
+  const int n_output = 48;
+  const LSTMWeights w(n_cell, n_input, n_output, false, false, false);
+
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.0f;
+  params.proj_clip = 0.0f;
+
+  // Quantize weights symmetrically and use dequantized weights for the float reference
+  LSTMWeights dequantized = w;
+  std::vector<int8_t> quantized[2][4];
+  float scales[2][4];
+  const float *biases[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    std::vector<float> *src[2] = {&dequantized.input_weights[g],
+                                  &dequantized.recurrent_weights[g]};
+    for (int k = 0; k < 2; ++k)
+    {
+      float min, max;
+      quantized[k][g].resize(src[k]->size());
+      nnfw::cker::SymmetricQuantizeFloats(src[k]->data(), src[k]->size(), quantized[k][g].data(),
+                                          &min, &max, &scales[k][g]);
+      for (size_t i = 0; i < src[k]->size(); ++i)
+        (*src[k])[i] = quantized[k][g][i] * scales[k][g];
+    }
+    biases[g] = w.ptr(w.biases[g]);
+  }
+  const int8_t *input_weights[4];
+  const int8_t *recurrent_weights[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    input_weights[g] = quantized[0][g].data();
+    recurrent_weights[g] = quantized[1][g].data();
+  }
+
+  nnfw::cker::FusedLSTM lstm;
+  lstm.prepare(input_weights, scales[0], recurrent_weights, scales[1], biases, n_cell, n_input,
+               n_output);
+  ASSERT_TRUE(lstm.isHybrid());
+
+  std::vector<float> expected_output_state(n_batch * n_output, 0.f);
+  std::vector<float> expected_cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> expected_output(n_batch * n_output);
+  std::vector<float> output_state(expected_output_state);
+  std::vector<float> cell_state(expected_cell_state);
+  std::vector<float> output(expected_output.size());
+
+  std::vector<float> input(n_batch * n_input);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = std::sin(0.3f * i);
+  for (int t = 0; t < 3; ++t)
+  {
+    runLstmStep(dequantized, params, input, n_batch, n_cell, n_input, n_output,
+                expected_output_state, expected_cell_state, expected_output);
+    runFusedLstmStep(lstm, w, params, input, n_batch, n_output, output_state, cell_state,
+                     output);
+
+    // Only activations are quantized additionally
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_NEAR(output[i], expected_output[i], 0.05f);
+  }
+}
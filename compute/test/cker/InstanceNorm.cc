@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/InstanceNorm.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST(CKer_Operation, InstanceNorm)
+{
+  const int batches = 2, image_size = 300, channels = 40;
+  nnfw::cker::Shape shape{batches, 15, 20, channels};
+  nnfw::cker::Shape param_shape{channels};
+
+  // Large mean against variance
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 1000.f + static_cast<float>((i * 37) % 101) * 0.01f;
+  std::vector<float> gamma(channels);
+  std::vector<float> beta(channels);
+  for (int c = 0; c < channels; ++c)
+  {
+    gamma[c] = 1.f + 0.1f * c;
+    beta[c] = -0.5f * c;
+  }
+
+  nnfw::cker::InstanceNormParams params;
+  params.epsilon = 1e-5f;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  std::vector<float> output(input.size());
+  nnfw::cker::InstanceNorm(params, shape, input.data(), param_shape, gamma.data(), param_shape,
+                           beta.data(), shape, output.data(), &ruy_context);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int c = 0; c < channels; ++c)
+    {
+      double mean = 0.0;
+      for (int i = 0; i < image_size; ++i)
+        mean += input[(b * image_size + i) * channels + c];
+      mean /= image_size;
+      double var = 0.0;
+      for (int i = 0; i < image_size; ++i)
+      {
+        const double diff = input[(b * image_size + i) * channels + c] - mean;
+        var += diff * diff;
+      }
+      var /= image_size;
+
+      for (int i = 0; i < image_size; ++i)
+      {
+        const int index = (b * image_size + i) * channels + c;
+        const double expected =
+          (input[index] - mean) / std::sqrt(var + params.epsilon) * gamma[c] + beta[c];
+        ASSERT_NEAR(output[index], expected, 1e-2);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, InstanceNormConstantWithoutEpsilon)
+{
+  nnfw::cker::Shape shape{1, 2, 2, 1};
+  nnfw::cker::Shape param_shape{1};
+  std::vector<float> input{1.f, 1.f, 1.f, 1.f};
+  std::vector<float> gamma{1.f};
+  std::vector<float> beta{2.f};
+
+  nnfw::cker::InstanceNormParams params;
+  params.epsilon = 0.f;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> output(input.size());
+  nnfw::cker::InstanceNorm(params, shape, input.data(), param_shape, gamma.data(), param_shape,
+                           beta.data(), shape, output.data());
+  for (auto value : output)
+    ASSERT_FLOAT_EQ(value, 2.f);
+}
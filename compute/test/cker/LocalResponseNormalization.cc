@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/LocalResponseNormalization.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, LocalResponseNormalization)
+{
+  const int num_pixels = 6, depth = 11;
+  nnfw::cker::Shape shape{1, 2, 3, depth};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i % 13) - 6) * 0.3f;
+
+  for (float beta : {0.5f, 0.75f})
+  {
+    nnfw::cker::LocalResponseNormalizationParams params;
+    params.range = 2;
+    params.bias = 1.f;
+    params.alpha = 0.2f;
+    params.beta = beta;
+
+    std::vector<float> output(input.size());
+    nnfw::cker::LocalResponseNormalization(params, shape, input.data(), shape, output.data());
+
+    for (int p = 0; p < num_pixels; ++p)
+    {
+      for (int c = 0; c < depth; ++c)
+      {
+        float sum = 0.f;
+        for (int i = std::max(0, c - params.range); i <= std::min(depth - 1, c + params.range);
+             ++i)
+          sum += input[p * depth + i] * input[p * depth + i];
+        const float expected =
+          input[p * depth + c] / std::pow(params.bias + params.alpha * sum, params.beta);
+        ASSERT_NEAR(output[p * depth + c], expected, 1e-5f);
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/PReLU.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, PReLU)
+{
+  nnfw::cker::Shape input_shape{2, 3, 4, 5};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i % 9) - 4);
+
+  // Per channel, per pixel and scalar alpha are repeated over leading dims
+  for (auto dims : {std::vector<int>{5}, std::vector<int>{1, 4, 5}, std::vector<int>{1}})
+  {
+    nnfw::cker::Shape alpha_shape(dims.size());
+    for (size_t i = 0; i < dims.size(); ++i)
+      alpha_shape.SetDim(i, dims[i]);
+    std::vector<float> alpha(alpha_shape.FlatSize());
+    for (size_t i = 0; i < alpha.size(); ++i)
+      alpha[i] = 0.1f * (i + 1);
+
+    std::vector<float> output(input.size());
+    nnfw::cker::PReLU(input_shape, input.data(), alpha_shape, alpha.data(), input_shape,
+                      output.data());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+      const float expected = input[i] >= 0 ? input[i] : input[i] * alpha[i % alpha.size()];
+      ASSERT_FLOAT_EQ(output[i], expected);
+    }
+  }
+
+  // Alpha broadcast in the middle
+  {
+    nnfw::cker::Shape alpha_shape{1, 3, 1, 1};
+    std::vector<float> alpha{0.1f, 0.2f, 0.3f};
+    std::vector<float> output(input.size());
+    nnfw::cker::PReLU(input_shape, input.data(), alpha_shape, alpha.data(), input_shape,
+                      output.data());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+      const float a = alpha[(i / 20) % 3];
+      ASSERT_FLOAT_EQ(output[i], input[i] >= 0 ? input[i] : input[i] * a);
+    }
+  }
+}
+
+TEST(CKer_Operation, PReLUQuant8)
+{
+  // input: scale 0.25, zero point 128, alpha: scale 0.25, zero point 50,
+  // output: scale 0.5, zero point 120
+  nnfw::cker::Shape input_shape{1, 2, 2, 3};
+  std::vector<uint8_t> input{128, 128, 128, 132, 132, 132, 124, 124, 124, 120, 120, 120};
+  nnfw::cker::Shape alpha_shape{1, 1, 3};
+  std::vector<uint8_t> alpha{50, 54, 58};
+  std::vector<uint8_t> expected{120, 120, 120, 122, 122, 122, 120, 118, 116, 120, 116, 112};
+
+  nnfw::cker::PReLUParams params;
+  params.input_offset = -128;
+  params.alpha_offset = -50;
+  params.output_offset = 120;
+  nnfw::cker::QuantizeMultiplier(0.25 / 0.5, &params.output_multiplier_1, &params.output_shift_1);
+  nnfw::cker::QuantizeMultiplier(0.25 * 0.25 / 0.5, &params.output_multiplier_2,
+                                 &params.output_shift_2);
+
+  std::vector<uint8_t> output(input.size());
+  nnfw::cker::PReLU(params, input_shape, input.data(), alpha_shape, alpha.data(), input_shape,
+                    output.data());
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(output[i], expected[i]);
+}
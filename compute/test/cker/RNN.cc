@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/RNN.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST(CKer_Operation, RNN)
+{
+  const int n_batch = 2;
+  const int n_input = 40;
+  const int n_units = 300;
+
+  std::vector<float> input(n_batch * n_input);
+  std::vector<float> weights(n_units * n_input);
+  std::vector<float> recurrent_weights(n_units * n_units);
+  std::vector<float> bias(n_units);
+  std::vector<float> hidden_state_in(n_batch * n_units);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = std::sin(0.1f * i);
+  for (size_t i = 0; i < weights.size(); ++i)
+    weights[i] = 0.05f * std::cos(0.7f * i);
+  for (size_t i = 0; i < recurrent_weights.size(); ++i)
+    recurrent_weights[i] = 0.01f * std::sin(0.3f * i);
+  for (size_t i = 0; i < bias.size(); ++i)
+    bias[i] = 0.01f * (static_cast<int>(i % 7) - 3);
+  for (size_t i = 0; i < hidden_state_in.size(); ++i)
+    hidden_state_in[i] = std::cos(0.2f * i);
+
+  std::vector<float> expected(n_batch * n_units);
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int u = 0; u < n_units; ++u)
+    {
+      float acc = bias[u];
+      for (int i = 0; i < n_input; ++i)
+        acc += weights[u * n_input + i] * input[b * n_input + i];
+      for (int i = 0; i < n_units; ++i)
+        acc += recurrent_weights[u * n_units + i] * hidden_state_in[b * n_units + i];
+      expected[b * n_units + u] = std::max(acc, 0.f);
+    }
+  }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<float> output(n_batch * n_units);
+    std::vector<float> hidden_state_out(n_batch * n_units);
+    nnfw::cker::RNN(nnfw::cker::FusedActivationFunctionType::kRelu,
+                    nnfw::cker::Shape{n_batch, n_input}, input.data(),
+                    nnfw::cker::Shape{n_units, n_input}, weights.data(),
+                    nnfw::cker::Shape{n_units, n_units}, recurrent_weights.data(),
+                    nnfw::cker::Shape{n_units}, bias.data(), nnfw::cker::Shape{n_batch, n_units},
+                    hidden_state_in.data(), nnfw::cker::Shape{n_batch, n_units}, output.data(),
+                    hidden_state_out.data(), ctx);
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      ASSERT_NEAR(output[i], expected[i], 1e-4f);
+      ASSERT_EQ(output[i], hidden_state_out[i]);
+    }
+  }
+}
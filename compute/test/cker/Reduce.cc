@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+// Reduce by visiting input elements in order, of which output offset drops reduced dims
+template <typename T, typename Fn>
+std::vector<T> NaiveReduce(const nnfw::cker::Shape &shape, const std::vector<T> &input,
+                           const std::vector<int> &axes, T init_value, Fn fn)
+{
+  const int rank = shape.DimensionsCount();
+  int num_outputs = 1;
+  for (int d = 0; d < rank; ++d)
+    if (std::find(axes.begin(), axes.end(), d) == axes.end())
+      num_outputs *= shape.Dims(d);
+
+  std::vector<T> output(num_outputs, init_value);
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    int remain = i;
+    int offset = 0;
+    int stride = 1;
+    for (int d = rank - 1; d >= 0; --d)
+    {
+      const int index = remain % shape.Dims(d);
+      remain /= shape.Dims(d);
+      if (std::find(axes.begin(), axes.end(), d) != axes.end())
+        continue;
+      offset += index * stride;
+      stride *= shape.Dims(d);
+    }
+    output[offset] = fn(output[offset], input[i]);
+  }
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ReduceGeneric)
+{
+  const nnfw::cker::Shape input_shape{6, 70, 1, 300};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 0.01f * static_cast<float>(static_cast<int>(i * 7919 % 1000) - 500);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Inner, outer and middle axes, all axes, and axes left to the generic iteration
+  const std::vector<std::vector<int>> axes_list{{3}, {0}, {1}, {1, 2}, {0, 1, 2, 3}, {0, 3}, {}};
+  for (const auto &axes : axes_list)
+  {
+    const auto expected_sum =
+      NaiveReduce<float>(input_shape, input, axes, 0.f, [](float a, float b) { return a + b; });
+    const auto expected_max = NaiveReduce<float>(
+      input_shape, input, axes, std::numeric_limits<float>::lowest(),
+      [](float a, float b) { return std::max(a, b); });
+
+    for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      nnfw::cker::Reduce reduce_kernel;
+      reduce_kernel.prepare(input_shape.DimensionsCount(), axes.size());
+      const nnfw::cker::Shape output_shape{static_cast<int>(expected_sum.size())};
+
+      std::vector<float> output(expected_sum.size());
+      ASSERT_TRUE(reduce_kernel.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                                     output.data(), axes, false,
+                                                     nnfw::cker::reduce::SumReducer<float>(), ctx));
+      for (size_t i = 0; i < output.size(); ++i)
+        ASSERT_NEAR(output[i], expected_sum[i], 1e-2f);
+
+      ASSERT_TRUE(reduce_kernel.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                                     output.data(), axes, false,
+                                                     nnfw::cker::reduce::MaxReducer<float>(), ctx));
+      ASSERT_EQ(output, expected_max);
+    }
+  }
+}
+
+TEST(CKer_Operation, ReduceSumAccuracy)
+{
+  // Sequential float accumulation of 0.1 drifts far away from 2^20 * 0.1 at this size
+  const nnfw::cker::Shape input_shape{1 << 20};
+  const std::vector<float> input(input_shape.FlatSize(), 0.1f);
+  const std::vector<int> axes{0};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    nnfw::cker::Reduce reduce_kernel;
+    reduce_kernel.prepare(1, 1);
+    float output = 0.f;
+    ASSERT_TRUE(reduce_kernel.ReduceGeneric<float>(input_shape, input.data(),
+                                                   nnfw::cker::Shape{1}, &output, axes, false,
+                                                   nnfw::cker::reduce::SumReducer<float>(), ctx));
+    EXPECT_NEAR(output, 0.1 * (1 << 20), 1e-5 * (1 << 20));
+  }
+}
+
+TEST(CKer_Operation, Mean)
+{
+  const nnfw::cker::Shape input_shape{2, 17, 23, 40};
+  const nnfw::cker::Shape output_shape{2, 1, 1, 40};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = std::sin(0.01f * i);
+  const std::vector<int> axes{1, 2};
+  auto expected =
+    NaiveReduce<float>(input_shape, input, axes, 0.f, [](float a, float b) { return a + b; });
+  for (auto &value : expected)
+    value /= 17 * 23;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<float> output(output_shape.FlatSize());
+    nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, output.data(), ctx);
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_NEAR(output[i], expected[i], 1e-5f);
+
+    std::fill(output.begin(), output.end(), 0.f);
+    nnfw::cker::Mean(input_shape, input.data(), output_shape, output.data(), axes, ctx);
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_NEAR(output[i], expected[i], 1e-5f);
+  }
+}
+
+TEST(CKer_Operation, MeanQuant8)
+{
+  const nnfw::cker::Shape input_shape{3, 50, 64};
+  const nnfw::cker::Shape output_shape{3, 64};
+  std::vector<int8_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int8_t>(static_cast<int>(i * 31 % 256) - 128);
+  const std::vector<int> axes{1};
+  const float input_scale = 0.5f;
+  const int32_t input_offset = -3;
+  const float output_scale = 0.25f;
+  const int32_t output_offset = 7;
+
+  const auto sums = NaiveReduce<int>(
+    input_shape, std::vector<int>(input.begin(), input.end()), axes, 0,
+    [](int a, int b) { return a + b; });
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (auto ctx : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<int8_t> output(output_shape.FlatSize());
+    nnfw::cker::MeanQ8Asymm(input_shape, input.data(), input_scale, input_offset, output_shape,
+                            output.data(), output_scale, output_offset, axes, ctx);
+    const float scale = input_scale / output_scale;
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+      const float mean = static_cast<float>(sums[i]) / 50;
+      float expected =
+        nnfw::cker::round_nearest(mean * scale - input_offset * scale + output_offset);
+      expected = std::min(127.f, std::max(-128.f, expected));
+      ASSERT_EQ(output[i], static_cast<int8_t>(expected));
+    }
+  }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cker/operation/ResizeNearestNeighbor.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, ResizeNearestNeighbor)
+{
+  nnfw::cker::Shape input_shape{2, 2, 3, 2};
+  std::vector<int32_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int32_t>(i);
+
+  nnfw::cker::ResizeNearestNeighborParams params;
+  params.output_height = 4;
+  params.output_width = 5;
+  params.align_corners = false;
+  params.half_pixel_centers = false;
+  nnfw::cker::Shape output_shape{2, 4, 5, 2};
+  std::vector<int32_t> output(output_shape.FlatSize());
+
+  nnfw::cker::ResizeNearestNeighbor(params, input_shape, input.data(), output_shape,
+                                    output.data());
+
+  // Source of y is floor(y * 2 / 4) and source of x is floor(x * 3 / 5)
+  const int input_xs[] = {0, 0, 1, 1, 2};
+  for (int b = 0; b < 2; ++b)
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 5; ++x)
+        for (int c = 0; c < 2; ++c)
+        {
+          const int in_index = ((b * 2 + y / 2) * 3 + input_xs[x]) * 2 + c;
+          const int out_index = ((b * 4 + y) * 5 + x) * 2 + c;
+          ASSERT_EQ(output[out_index], input[in_index]);
+        }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TopKV2.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+// Indices of row sorted by value in descending order, smaller index first on ties
+template <typename T> std::vector<int32_t> SortedIndices(const T *row, int row_size)
+{
+  std::vector<int32_t> indices(row_size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::stable_sort(indices.begin(), indices.end(),
+                   [row](int32_t a, int32_t b) { return row[a] > row[b]; });
+  return indices;
+}
+
+template <typename T>
+void VerifyTopKV2(const std::vector<T> &input, int num_rows, int row_size, int k,
+                  ruy::Context *ruy_context)
+{
+  nnfw::cker::Shape input_shape{num_rows, row_size};
+  nnfw::cker::Shape output_shape{num_rows, k};
+  std::vector<T> values(num_rows * k);
+  std::vector<int32_t> indices(num_rows * k);
+
+  nnfw::cker::TopKV2(input_shape, input.data(), k, output_shape, values.data(), indices.data(),
+                     ruy_context);
+
+  for (int r = 0; r < num_rows; ++r)
+  {
+    const T *row = input.data() + r * row_size;
+    const auto expected = SortedIndices(row, row_size);
+    for (int i = 0; i < k; ++i)
+    {
+      ASSERT_EQ(indices[r * k + i], expected[i]);
+      ASSERT_EQ(values[r * k + i], row[expected[i]]);
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, TopKV2)
+{
+  // Heap for small k, nth_element for large k
+  for (int k : {1, 5, 100, 1000})
+  {
+    const int num_rows = 3;
+    const int row_size = 1000;
+    std::vector<float> input(num_rows * row_size);
+    for (size_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<float>((i * 7919) % 1009) * 0.5f;
+    VerifyTopKV2(input, num_rows, row_size, k, nullptr);
+  }
+
+  // Ties and ascending row which updates heap for every chunk
+  {
+    std::vector<int32_t> input(300);
+    for (size_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<int32_t>(i / 3);
+    VerifyTopKV2(input, 1, 300, 10, nullptr);
+  }
+  {
+    std::vector<uint8_t> input(2 * 500);
+    for (size_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<uint8_t>((i * 31) % 200);
+    VerifyTopKV2(input, 2, 500, 7, nullptr);
+  }
+}
+
+TEST(CKer_Operation, TopKV2_MultiThread)
+{
+  const int num_rows = 8;
+  const int row_size = 50000;
+  std::vector<float> input(num_rows * row_size);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>((i * 104729) % 65521) * 0.01f;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  VerifyTopKV2(input, num_rows, row_size, 16, &ruy_context);
+}
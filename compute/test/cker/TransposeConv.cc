@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+// Expected quantized output from accumulators of float reference with zero-point-free values,
+// which are exact as they are small integers
+template <typename T>
+std::vector<T> quantizedExpected(const nnfw::cker::TransposeConvParams &params,
+                                 const nnfw::cker::Shape &input_shape,
+                                 const std::vector<T> &input,
+                                 const nnfw::cker::Shape &filter_shape,
+                                 const std::vector<T> &filter, const std::vector<int32_t> &bias,
+                                 const std::vector<int32_t> &multipliers,
+                                 const std::vector<int> &shifts,
+                                 const nnfw::cker::Shape &output_shape)
+{
+  std::vector<float> input_float(input.size());
+  std::vector<float> filter_float(filter.size());
+  for (size_t i = 0; i < input.size(); ++i)
+    input_float[i] = static_cast<float>(input[i] + params.input_offset);
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter_float[i] = static_cast<float>(filter[i] + params.weights_offset);
+
+  std::vector<float> acc(output_shape.FlatSize());
+  nnfw::cker::reference::TransposeConv(params, input_shape, input_float.data(), filter_shape,
+                                       filter_float.data(), output_shape, acc.data());
+
+  const int output_depth = output_shape.Dims(3);
+  std::vector<T> expected(acc.size());
+  for (size_t i = 0; i < acc.size(); ++i)
+  {
+    const int channel = i % output_depth;
+    const int index = multipliers.size() == 1 ? 0 : channel;
+    int32_t value = static_cast<int32_t>(acc[i]) + bias[channel];
+    value = nnfw::cker::MultiplyByQuantizedMultiplier(value, multipliers[index], shifts[index]);
+    value += params.output_offset;
+    value = std::max(value, params.quantized_activation_min);
+    value = std::min(value, params.quantized_activation_max);
+    expected[i] = static_cast<T>(value);
+  }
+  return expected;
+}
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConv)
+{
+  const int batch = 2, input_height = 4, input_width = 5, input_depth = 3;
+  const int output_depth = 4, filter_height = 3, filter_width = 3;
+
+  for (int stride : {1, 2, 3})
+  {
+    for (int pad : {0, 1})
+    {
+      const int output_height = (input_height - 1) * stride + filter_height - 2 * pad;
+      const int output_width = (input_width - 1) * stride + filter_width - 2 * pad;
+      nnfw::cker::Shape input_shape{batch, input_height, input_width, input_depth};
+      nnfw::cker::Shape filter_shape{output_depth, filter_height, filter_width, input_depth};
+      nnfw::cker::Shape output_shape{batch, output_height, output_width, output_depth};
+
+      std::vector<float> input(input_shape.FlatSize());
+      std::vector<float> filter(filter_shape.FlatSize());
+      for (size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<float>(i % 11) * 0.1f - 0.5f;
+      for (size_t i = 0; i < filter.size(); ++i)
+        filter[i] = static_cast<float>(i % 7) * 0.2f - 0.6f;
+
+      nnfw::cker::TransposeConvParams params;
+      params.stride_width = stride;
+      params.stride_height = stride;
+      params.padding_values.width = pad;
+      params.padding_values.height = pad;
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+
+      std::vector<float> expected(output_shape.FlatSize());
+      nnfw::cker::reference::TransposeConv(params, input_shape, input.data(), filter_shape,
+                                           filter.data(), output_shape, expected.data());
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(2);
+
+      // Filter is transposed in execution
+      {
+        nnfw::cker::TransposeConv kernel;
+        std::vector<float> output(output_shape.FlatSize());
+        kernel(params, input_shape, input.data(), filter_shape, filter.data(),
+               nnfw::cker::Shape{}, nullptr, output_shape, output.data(), &ruy_context);
+        for (size_t i = 0; i < output.size(); ++i)
+          ASSERT_NEAR(output[i], expected[i], 1e-4f);
+      }
+
+      // Filter is transposed in advance
+      {
+        nnfw::cker::TransposeConv kernel;
+        kernel.prepare(filter_shape, filter.data());
+        std::vector<float> output(output_shape.FlatSize());
+        kernel(params, input_shape, input.data(), filter_shape, filter.data(),
+               nnfw::cker::Shape{}, nullptr, output_shape, output.data(), &ruy_context);
+        for (size_t i = 0; i < output.size(); ++i)
+          ASSERT_NEAR(output[i], expected[i], 1e-4f);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeConvUint8)
+{
+  const int batch = 2, input_height = 4, input_width = 5, input_depth = 3;
+  const int output_depth = 4, filter_height = 3, filter_width = 3;
+  const float input_scale = 0.05f, filter_scale = 0.02f, output_scale = 0.1f;
+
+  for (int stride : {1, 2, 3})
+  {
+    for (int pad : {0, 1})
+    {
+      const int output_height = (input_height - 1) * stride + filter_height - 2 * pad;
+      const int output_width = (input_width - 1) * stride + filter_width - 2 * pad;
+      nnfw::cker::Shape input_shape{batch, input_height, input_width, input_depth};
+      nnfw::cker::Shape filter_shape{output_depth, filter_height, filter_width, input_depth};
+      nnfw::cker::Shape bias_shape{output_depth};
+      nnfw::cker::Shape output_shape{batch, output_height, output_width, output_depth};
+
+      std::vector<uint8_t> input(input_shape.FlatSize());
+      std::vector<uint8_t> filter(filter_shape.FlatSize());
+      std::vector<int32_t> bias{-300, 0, 150, 700};
+      for (size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<uint8_t>((i * 37) % 256);
+      for (size_t i = 0; i < filter.size(); ++i)
+        filter[i] = static_cast<uint8_t>((i * 53) % 256);
+
+      nnfw::cker::TransposeConvParams params;
+      params.stride_width = stride;
+      params.stride_height = stride;
+      params.padding_values.width = pad;
+      params.padding_values.height = pad;
+      // Offsets are negative zero points of input and filter, and zero point of output
+      params.input_offset = -130;
+      params.weights_offset = -120;
+      params.output_offset = 125;
+      params.quantized_activation_min = std::numeric_limits<uint8_t>::min();
+      params.quantized_activation_max = std::numeric_limits<uint8_t>::max();
+      nnfw::cker::QuantizeMultiplier(input_scale * filter_scale / output_scale,
+                                     &params.output_multiplier, &params.output_shift);
+
+      const auto expected = quantizedExpected(
+        params, input_shape, input, filter_shape, filter, bias, {params.output_multiplier},
+        {params.output_shift}, output_shape);
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(2);
+
+      // Filter is transposed in execution
+      {
+        nnfw::cker::TransposeConv kernel;
+        std::vector<uint8_t> output(output_shape.FlatSize());
+        kernel(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+               bias.data(), output_shape, output.data(), &ruy_context);
+        for (size_t i = 0; i < output.size(); ++i)
+          ASSERT_EQ(output[i], expected[i]);
+      }
+
+      // Filter is transposed in advance
+      {
+        nnfw::cker::TransposeConv kernel;
+        kernel.prepare(filter_shape, filter.data());
+        std::vector<uint8_t> output(output_shape.FlatSize());
+        kernel(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+               bias.data(), output_shape, output.data(), &ruy_context);
+        for (size_t i = 0; i < output.size(); ++i)
+          ASSERT_EQ(output[i], expected[i]);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeConvInt8PerChannel)
+{
+  const int batch = 2, input_height = 4, input_width = 5, input_depth = 3;
+  const int output_depth = 4, filter_height = 3, filter_width = 3;
+  const float input_scale = 0.05f, output_scale = 0.2f;
+  const std::vector<float> filter_scales{0.01f, 0.02f, 0.005f, 0.04f};
+
+  for (int stride : {1, 2, 3})
+  {
+    for (int pad : {0, 1})
+    {
+      const int output_height = (input_height - 1) * stride + filter_height - 2 * pad;
+      const int output_width = (input_width - 1) * stride + filter_width - 2 * pad;
+      nnfw::cker::Shape input_shape{batch, input_height, input_width, input_depth};
+      nnfw::cker::Shape filter_shape{output_depth, filter_height, filter_width, input_depth};
+      nnfw::cker::Shape bias_shape{output_depth};
+      nnfw::cker::Shape output_shape{batch, output_height, output_width, output_depth};
+
+      std::vector<int8_t> input(input_shape.FlatSize());
+      std::vector<int8_t> filter(filter_shape.FlatSize());
+      std::vector<int32_t> bias{500, -250, 0, 1000};
+      for (size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 256) - 128);
+      for (size_t i = 0; i < filter.size(); ++i)
+        filter[i] = static_cast<int8_t>(static_cast<int>((i * 53) % 255) - 127);
+
+      nnfw::cker::TransposeConvParams params;
+      params.stride_width = stride;
+      params.stride_height = stride;
+      params.padding_values.width = pad;
+      params.padding_values.height = pad;
+      // Filter of int8 is symmetric per channel
+      params.input_offset = 3;
+      params.weights_offset = 0;
+      params.output_offset = -5;
+      params.quantized_activation_min = std::numeric_limits<int8_t>::min();
+      params.quantized_activation_max = std::numeric_limits<int8_t>::max();
+
+      nnfw::cker::TransposeConv kernel;
+      auto &multipliers = kernel.per_channel_output_multiplier();
+      auto &shifts = kernel.per_channel_output_shift();
+      multipliers.resize(output_depth);
+      shifts.resize(output_depth);
+      for (int c = 0; c < output_depth; ++c)
+        nnfw::cker::QuantizeMultiplier(input_scale * filter_scales[c] / output_scale,
+                                       &multipliers[c], &shifts[c]);
+
+      const auto expected = quantizedExpected(params, input_shape, input, filter_shape, filter,
+                                              bias, multipliers, shifts, output_shape);
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(2);
+
+      // Filter is transposed in execution, and then in advance
+      for (int run = 0; run < 2; ++run)
+      {
+        if (run == 1)
+          kernel.prepare(filter_shape, filter.data());
+        std::vector<int8_t> output(output_shape.FlatSize());
+        kernel(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+               bias.data(), output_shape, output.data(), &ruy_context);
+        for (size_t i = 0; i < output.size(); ++i)
+          ASSERT_EQ(output[i], expected[i]);
+      }
+    }
+  }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Block sparse FullyConnected benchmark to find sparsity where it is faster than dense one
+ *
+ * Run with a range of sparsity, e.g. "-p SPARSITY:0:10:90" with nonius, and compare with
+ * "Eigen(dense float)". Sparse kernel begins to win over dense GEMV at about 30~40% of zero blocks
+ * for 16x1, 8x1 and 1x16 blocks, at about 50% for 4x4 and at about 75% for 1x4.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/FullyConnected.h>
+
+#include <Eigen/Core>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(ROWS, 1024);
+NONIUS_PARAM(COLS, 1024);
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(BLOCK_ROWS, 16);
+NONIUS_PARAM(BLOCK_COLS, 1);
+// Percentage of zero blocks
+NONIUS_PARAM(SPARSITY, 80);
+NONIUS_PARAM(THREADS, 1);
+
+namespace
+{
+
+template <typename T> struct BlockSparseWeights
+{
+  std::vector<T> values;
+  std::vector<uint16_t> segments;
+  std::vector<uint16_t> indices;
+};
+
+template <typename T>
+BlockSparseWeights<T> make_weights(int rows, int cols, int block_rows, int block_cols,
+                                   int sparsity)
+{
+  std::mt19937 gen(0);
+  std::bernoulli_distribution keep_dist(1.0 - sparsity / 100.0);
+
+  BlockSparseWeights<T> weights;
+  weights.segments.push_back(0);
+  for (int i = 0; i < rows / block_rows; ++i)
+  {
+    for (int j = 0; j < cols / block_cols; ++j)
+    {
+      if (!keep_dist(gen))
+        continue;
+      weights.indices.push_back(j);
+      weights.values.insert(weights.values.end(), block_rows * block_cols, static_cast<T>(1));
+    }
+    weights.segments.push_back(weights.indices.size());
+  }
+  return weights;
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Eigen(dense float)", [](nonius::chronometer meter) {
+  auto rows = meter.param<ROWS>();
+  auto cols = meter.param<COLS>();
+  auto batch = meter.param<BATCH>();
+
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  RowMajorMatrix weights = RowMajorMatrix::Constant(rows, cols, 0.01f);
+  Eigen::MatrixXf input = Eigen::MatrixXf::Constant(cols, batch, 0.5f);
+  Eigen::MatrixXf output(rows, batch);
+
+  meter.measure([&](int) {
+    // Run!
+    output.noalias() = weights * input;
+  });
+})
+
+NONIUS_BENCHMARK("cker::FullyConnectedSparseWeightBlock(float)", [](nonius::chronometer meter) {
+  auto rows = meter.param<ROWS>();
+  auto cols = meter.param<COLS>();
+  auto batch = meter.param<BATCH>();
+  auto block_rows = meter.param<BLOCK_ROWS>();
+  auto block_cols = meter.param<BLOCK_COLS>();
+  auto threads = meter.param<THREADS>();
+
+  auto weights = make_weights<float>(rows, cols, block_rows, block_cols, meter.param<SPARSITY>());
+  std::vector<float> input(batch * cols, 0.5f);
+  std::vector<float> output(batch * rows);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::FullyConnectedSparseWeightBlock(
+      params, nnfw::cker::Shape{batch, cols}, input.data(), nnfw::cker::Shape{rows, cols},
+      weights.values.data(), nnfw::cker::Shape{rows}, nullptr, nnfw::cker::Shape{batch, rows},
+      output.data(), weights.segments.data(), weights.indices.data(), block_rows, block_cols,
+      &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::FullyConnectedSparseWeightBlock(int8)", [](nonius::chronometer meter) {
+  auto rows = meter.param<ROWS>();
+  auto cols = meter.param<COLS>();
+  auto batch = meter.param<BATCH>();
+  auto block_rows = meter.param<BLOCK_ROWS>();
+  auto block_cols = meter.param<BLOCK_COLS>();
+  auto threads = meter.param<THREADS>();
+
+  auto weights =
+    make_weights<int8_t>(rows, cols, block_rows, block_cols, meter.param<SPARSITY>());
+  std::vector<int8_t> input(batch * cols, 1);
+  std::vector<int8_t> output(batch * rows);
+  std::vector<int32_t> scratch(batch * rows);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = 0;
+  params.output_offset = 0;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  const int32_t output_multiplier = 1 << 30;
+  const int output_shift = -8;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::FullyConnectedSparseWeightBlock(
+      params, &output_multiplier, &output_shift, false, nnfw::cker::Shape{batch, cols},
+      input.data(), nnfw::cker::Shape{rows, cols}, weights.values.data(), nnfw::cker::Shape{rows},
+      nullptr, nnfw::cker::Shape{batch, rows}, output.data(), scratch.data(),
+      weights.segments.data(), weights.indices.data(), block_rows, block_cols, &ruy_context);
+  });
+})
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TopKV2 and ArgMax benchmark over vocabulary sized rows
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/ArgMinMax.h>
+#include <cker/operation/TopKV2.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(VOCAB, 50000);
+NONIUS_PARAM(ROWS, 1);
+NONIUS_PARAM(K, 10);
+NONIUS_PARAM(THREADS, 1);
+
+namespace
+{
+
+std::vector<float> make_logits(int size)
+{
+  std::mt19937 gen(0);
+  std::normal_distribution<float> dist(0.0f, 3.0f);
+
+  std::vector<float> logits(size);
+  for (auto &logit : logits)
+    logit = dist(gen);
+
+  return logits;
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("std::partial_sort(float)", [](nonius::chronometer meter) {
+  auto vocab = meter.param<VOCAB>();
+  auto rows = meter.param<ROWS>();
+  auto k = meter.param<K>();
+
+  auto input = make_logits(vocab * rows);
+  std::vector<int32_t> indices(vocab);
+
+  meter.measure([&](int) {
+    // Baseline which sorts indices of each row partially
+    for (int r = 0; r < rows; ++r)
+    {
+      const float *row = input.data() + r * vocab;
+      std::iota(indices.begin(), indices.end(), 0);
+      std::partial_sort(indices.begin(), indices.begin() + k, indices.end(),
+                        [row](int32_t a, int32_t b) { return row[a] > row[b]; });
+    }
+  });
+})
+
+NONIUS_BENCHMARK("cker::TopKV2(float)", [](nonius::chronometer meter) {
+  auto vocab = meter.param<VOCAB>();
+  auto rows = meter.param<ROWS>();
+  auto k = meter.param<K>();
+  auto threads = meter.param<THREADS>();
+
+  nnfw::cker::Shape input_shape{rows, vocab};
+  nnfw::cker::Shape output_shape{rows, k};
+
+  auto input = make_logits(vocab * rows);
+  std::vector<float> values(rows * k);
+  std::vector<int32_t> indices(rows * k);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::TopKV2(input_shape, input.data(), k, output_shape, values.data(), indices.data(),
+                       &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::ArgMinMax(float)", [](nonius::chronometer meter) {
+  auto vocab = meter.param<VOCAB>();
+  auto rows = meter.param<ROWS>();
+
+  nnfw::cker::Shape input_shape{rows, vocab};
+  nnfw::cker::Shape output_shape{rows};
+
+  auto input = make_logits(vocab * rows);
+  std::vector<int32_t> output(rows);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::ArgMinMax(input_shape, input.data(), output_shape, output.data(), 1, true);
+  });
+})
@@ -19,5 +19,7 @@
 
 #include "benchmark/Phases.h"
 #include "benchmark/Result.h"
+#include "benchmark/LoadMonitor.h"
+#include "benchmark/LoadResult.h"
 
 #endif // __NNFW_BENCHMARK_H__
@@ -35,6 +35,9 @@ public:
   void write(double val);
   void write(uint32_t val);
   void write(char val);
+  /**
+   * @brief Check whether the header and at least one row are written completely
+   */
   bool done();
 
 public:
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_LOAD_MONITOR_H__
+#define __NNFW_BENCHMARK_LOAD_MONITOR_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace benchmark
+{
+
+// Figures of the process sampled periodically during a load test
+struct LoadSample
+{
+  // Seconds since the load started
+  double time;
+  // Requests completed per second since the previous sample
+  double qps;
+  // CPU time of the process over wall time since the previous sample, 100% per busy core
+  double cpu_utilization;
+  uint32_t rss;
+};
+
+// Sampler of throughput, CPU utilization and RSS while a load runs
+class LoadMonitor
+{
+public:
+  LoadMonitor(std::chrono::milliseconds interval = std::chrono::milliseconds(100));
+  virtual ~LoadMonitor();
+
+  void start();
+  void stop();
+  // Count a completed request, which is safe to call from any thread
+  void complete() { _completed.fetch_add(1, std::memory_order_relaxed); }
+  const std::vector<LoadSample> &samples() const { return _samples; }
+
+private:
+  void process();
+  void sample();
+
+private:
+  std::chrono::milliseconds _interval;
+  std::thread _thread;
+  std::atomic<uint64_t> _completed;
+  std::vector<LoadSample> _samples;
+
+  std::chrono::steady_clock::time_point _start_time;
+  std::chrono::steady_clock::time_point _prev_time;
+  double _prev_cpu_time;
+  uint64_t _prev_completed;
+
+  std::mutex _mutex;
+  std::condition_variable _cond_var;
+  bool _term;
+};
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_LOAD_MONITOR_H__
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_LOAD_RESULT_H__
+#define __NNFW_BENCHMARK_LOAD_RESULT_H__
+
+#include "Types.h"
+#include "LoadMonitor.h"
+
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+// Data class of a load test between runner(nnpackage_run) and libbenchmark
+class LoadResult
+{
+public:
+  LoadResult(std::vector<uint64_t> latencies_us, double duration_s,
+             const std::vector<LoadSample> &samples);
+
+  // Description of the load given by runner
+  std::string mode;
+  uint32_t num_sessions = 1;
+  double target_qps = 0.0;
+
+  uint32_t num_requests;
+  // Seconds from the first request to the last completion
+  double duration;
+  double qps;
+  // Latencies in ms
+  double latency[LatencyType::END_OF_LATENCY_TYPE];
+  double latency_mean;
+  double latency_max;
+  double cpu_utilization;
+  uint32_t peak_rss;
+  std::vector<LoadSample> samples;
+};
+
+void printLoadResult(const LoadResult &result);
+
+// Write {exec}-{model}-{backend}-load.csv of figures and {exec}-{model}-{backend}-timeline.csv
+// of samples
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_LOAD_RESULT_H__
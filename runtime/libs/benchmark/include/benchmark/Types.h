@@ -128,6 +128,40 @@ inline std::string getFigureTypeString(int type)
   return getFigureTypeString(static_cast<FigureType>(type));
 }
 
+enum LatencyType
+{
+  P50,
+  P90,
+  P99,
+  P999,
+  END_OF_LATENCY_TYPE
+};
+
+inline std::string getLatencyTypeString(LatencyType type)
+{
+  switch (type)
+  {
+    case P50:
+      return "P50";
+    case P90:
+      return "P90";
+    case P99:
+      return "P99";
+    case P999:
+      return "P99.9";
+    default:
+      return "END_OF_LATENCY_TYPE";
+  }
+}
+
+inline std::string getLatencyTypeString(int type)
+{
+  return getLatencyTypeString(static_cast<LatencyType>(type));
+}
+
+// Percentile of each LatencyType
+const double gLatencyPercentiles[LatencyType::END_OF_LATENCY_TYPE]{50.0, 90.0, 99.0, 99.9};
+
 } // namespace benchmark
 
 #endif // __NNFW_BENCHMARK_TYPES_H__
@@ -94,7 +94,7 @@ void CsvWriter::write(char val)
   postWrite();
 }
 
-bool CsvWriter::done() { return (_col_idx == 0) && (_row_idx == 2); }
+bool CsvWriter::done() { return (_col_idx == 0) && (_row_idx >= 2); }
 
 CsvWriter &operator<<(CsvWriter &csvw, const std::string &val)
 {
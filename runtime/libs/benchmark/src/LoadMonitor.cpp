@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/LoadMonitor.h"
+#include "benchmark/MemoryInfo.h"
+
+#include <sys/resource.h>
+#include <sys/time.h>
+
+namespace
+{
+
+// Seconds of user and system CPU time of all threads of the process
+double getCpuTime()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0.0;
+  auto seconds = [](const struct timeval &tv) { return tv.tv_sec + tv.tv_usec / 1e6; };
+  return seconds(usage.ru_utime) + seconds(usage.ru_stime);
+}
+
+double getSeconds(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+LoadMonitor::LoadMonitor(std::chrono::milliseconds interval)
+  : _interval(interval), _completed(0), _prev_cpu_time(0.0), _prev_completed(0), _term(true)
+{
+  // DO NOTHING
+}
+
+LoadMonitor::~LoadMonitor() { stop(); }
+
+void LoadMonitor::start()
+{
+  if (!_term)
+    return;
+
+  _samples.clear();
+  _completed = 0;
+  _prev_completed = 0;
+  _start_time = _prev_time = std::chrono::steady_clock::now();
+  _prev_cpu_time = getCpuTime();
+  _term = false;
+  _thread = std::thread{&LoadMonitor::process, this};
+}
+
+void LoadMonitor::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_term)
+      return;
+    _term = true;
+  }
+  _cond_var.notify_all();
+  _thread.join();
+
+  // Cover the tail since the last sample
+  sample();
+}
+
+void LoadMonitor::process()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (!_cond_var.wait_for(lock, _interval, [this]() { return _term; }))
+  {
+    sample();
+  }
+}
+
+void LoadMonitor::sample()
+{
+  const auto now = std::chrono::steady_clock::now();
+  const auto cpu_time = getCpuTime();
+  const uint64_t completed = _completed.load(std::memory_order_relaxed);
+  const double elapsed = getSeconds(now - _prev_time);
+  if (elapsed <= 0.0)
+    return;
+
+  LoadSample load_sample;
+  load_sample.time = getSeconds(now - _start_time);
+  load_sample.qps = (completed - _prev_completed) / elapsed;
+  load_sample.cpu_utilization = (cpu_time - _prev_cpu_time) / elapsed * 100.0;
+  load_sample.rss = getVmRSS();
+  _samples.emplace_back(load_sample);
+
+  _prev_time = now;
+  _prev_cpu_time = cpu_time;
+  _prev_completed = completed;
+}
+
+} // namespace benchmark
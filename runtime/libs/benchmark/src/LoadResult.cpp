@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/LoadResult.h"
+#include "benchmark/CsvWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+
+const std::vector<std::string> csv_load_header{
+#include "benchmark/CsvLoadHeader.lst"
+};
+
+const std::vector<std::string> csv_load_timeline_header{
+#include "benchmark/CsvLoadTimelineHeader.lst"
+};
+
+// Nearest-rank percentile of sorted values
+uint64_t percentile(const std::vector<uint64_t> &sorted, double p)
+{
+  if (sorted.empty())
+    return 0;
+  auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+  return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+LoadResult::LoadResult(std::vector<uint64_t> latencies_us, double duration_s,
+                       const std::vector<LoadSample> &samples)
+  : num_requests(latencies_us.size()), duration(duration_s), samples(samples)
+{
+  std::sort(latencies_us.begin(), latencies_us.end());
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+  {
+    latency[i] = percentile(latencies_us, gLatencyPercentiles[i]) / 1e3;
+  }
+  latency_mean = latencies_us.empty() ? 0.0
+                                      : std::accumulate(latencies_us.begin(), latencies_us.end(),
+                                                        0.0) /
+                                          latencies_us.size() / 1e3;
+  latency_max = latencies_us.empty() ? 0.0 : latencies_us.back() / 1e3;
+  qps = (duration > 0.0) ? num_requests / duration : 0.0;
+
+  // Average over time, of which samples may have different intervals
+  double prev_time = 0.0;
+  double cpu_time = 0.0;
+  peak_rss = 0;
+  for (const auto &sample : samples)
+  {
+    cpu_time += sample.cpu_utilization * (sample.time - prev_time);
+    prev_time = sample.time;
+    peak_rss = std::max(peak_rss, sample.rss);
+  }
+  cpu_utilization = (prev_time > 0.0) ? cpu_time / prev_time : 0.0;
+}
+
+void printLoadResult(const LoadResult &result)
+{
+  std::cout << "===================================" << std::endl;
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  std::cout << "LOAD " << result.mode << " with " << result.num_sessions << " session(s)";
+  if (result.target_qps > 0.0)
+    std::cout << " at target " << result.target_qps << " qps";
+  std::cout << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "REQUESTS"
+            << ":  " << result.num_requests << " in " << result.duration << " s" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "QPS"
+            << ":  " << result.qps << std::endl;
+  std::cout << "LATENCY" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "MEAN"
+            << ":  " << result.latency_mean << " ms" << std::endl;
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+  {
+    std::cout << "- " << std::setw(9) << std::left << getLatencyTypeString(i) << ":  "
+              << result.latency[i] << " ms" << std::endl;
+  }
+  std::cout << "- " << std::setw(9) << std::left << "MAX"
+            << ":  " << result.latency_max << " ms" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "CPU"
+            << ":  " << result.cpu_utilization << " %" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "PEAK RSS"
+            << ":  " << result.peak_rss << " kb" << std::endl;
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend)
+{
+  std::string csv_filename = exec + "-" + model + "-" + backend + "-load.csv";
+  {
+    CsvWriter writer(csv_filename, csv_load_header);
+    writer << model << backend << result.mode << result.num_sessions << result.target_qps
+           << result.num_requests << result.duration << result.qps << result.latency_mean;
+    for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+    {
+      writer << result.latency[i];
+    }
+    writer << result.latency_max << result.cpu_utilization << result.peak_rss;
+
+    if (!writer.done())
+    {
+      std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+    }
+  }
+
+  if (result.samples.empty())
+    return;
+
+  csv_filename = exec + "-" + model + "-" + backend + "-timeline.csv";
+  CsvWriter writer(csv_filename, csv_load_timeline_header);
+  for (const auto &sample : result.samples)
+  {
+    writer << sample.time << sample.qps << sample.cpu_utilization << sample.rss;
+  }
+
+  if (!writer.done())
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace benchmark
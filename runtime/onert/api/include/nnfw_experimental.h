@@ -128,6 +128,11 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
  * function can be reused for many inferences. \p lengths must be greater or equal than the operand
  * requires. if you give empty \p inputs to this function, then this function will join all threads.
  *
+ * This function blocks while the queue of the first pipeline stage is full. Each stage queues up
+ * to PIPELINE_QUEUE_SIZE config inputs, and the last stage keeps as many outputs until they are
+ * popped by {@link nnfw_pop_pipeline_output}. So pushing more inputs than the stages can hold
+ * without popping outputs, e.g. pushing all inputs before popping on the same thread, deadlocks.
+ *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
  * multiple input model
@@ -152,4 +157,125 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
  */
 NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs);
 
+/**
+ * @brief Completion of an inference submitted by {@link nnfw_submit}
+ */
+typedef struct
+{
+  /** Request id given by {@link nnfw_submit} */
+  uint64_t request_id;
+  /** Result of the inference */
+  NNFW_STATUS status;
+} nnfw_completion;
+
+/**
+ * @brief Callback called when an inference submitted by {@link nnfw_submit} is finished
+ * @note  It is called on a runtime thread, so it should return quickly and must not call
+ *        API of the session except {@link nnfw_submit}
+ */
+typedef void (*nnfw_completion_callback)(uint64_t request_id, NNFW_STATUS status,
+                                         void *user_data);
+
+/**
+ * @brief     Submit an inference with its own input and output buffers
+ * This function must be called after {@link nnfw_prepare}. It returns without waiting, and the
+ * inference runs on runtime thread pool which is created once and shared by sessions.
+ * Many inferences can be in flight at once. Inferences of a session run one by one in order of
+ * submission. Buffers must be valid until the inference is completed.
+ * Completion is notified by the callback set by {@link nnfw_set_completion_callback}, or queued
+ * to be retrieved by {@link nnfw_poll_completions} if the callback is not set.
+ * @note      Input shapes set by {@link nnfw_set_input_tensorinfo} are applied
+ * @param[in]   session         The session to run inference
+ * @param[in]   inputs          Input buffers, as many as inputs of model
+ * @param[in]   input_lengths   Sizes in bytes of input buffers
+ * @param[in]   outputs         Output buffers, as many as outputs of model
+ * @param[in]   output_lengths  Sizes in bytes of output buffers
+ * @param[out]  request_id      Id of the submitted inference
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_submit(nnfw_session *session, const void **inputs, const size_t *input_lengths,
+                        void **outputs, const size_t *output_lengths, uint64_t *request_id);
+
+/**
+ * @brief     Set callback to be called when an inference submitted by {@link nnfw_submit} is
+ *            finished. Completions are not queued if the callback is set.
+ * @param[in] session   The session object
+ * @param[in] callback  Callback function, or NULL to queue completions
+ * @param[in] user_data User data passed to callback
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_completion_callback(nnfw_session *session, nnfw_completion_callback callback,
+                                         void *user_data);
+
+/**
+ * @brief       Get a file descriptor which is readable while completions are queued
+ * The descriptor is an eventfd owned by the session, so it can be added to epoll or poll.
+ * It must not be closed or read by user.
+ * @param[in]   session The session object
+ * @param[out]  fd      File descriptor
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_completion_fd(nnfw_session *session, int *fd);
+
+/**
+ * @brief       Get queued completions without blocking
+ * @param[in]   session     The session object
+ * @param[out]  completions Array to get completions
+ * @param[in]   max_count   Size of @c completions
+ * @param[out]  count       Number of completions written to @c completions, 0 if none
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_poll_completions(nnfw_session *session, nnfw_completion *completions,
+                                  uint32_t max_count, uint32_t *count);
+
+/**
+ * @brief     Prepare session to coalesce inferences submitted by {@link nnfw_submit} into batches
+ * This function is called instead of {@link nnfw_prepare}. The loaded model must take a sample,
+ * that is, the first dimension of all inputs must be 1. The model is compiled for a sample and
+ * for each of given batch sizes, by setting the first dimension of inputs to the batch size
+ * before compilation, so batched models have static shapes.
+ * Then each {@link nnfw_submit} queues an inference of a sample. Queued inferences are run as a
+ * batch when the largest batch size is queued or the oldest one has waited for @c max_delay_us,
+ * with the largest batch size not greater than the number of queued inferences.
+ * An inference run alone uses its own buffers, and inferences of a batch are copied to and from
+ * buffers of the batch. Completions are notified in the same way as without batching.
+ * @note      Outputs of batched models must also have the batch size as their first dimension.
+ *            Input shapes set by {@link nnfw_set_input_tensorinfo} after this function are not
+ *            applied to batches.
+ * @param[in] session         The session to be prepared
+ * @param[in] batch_sizes     Batch sizes to compile the model for, 1 is always included
+ * @param[in] num_batch_sizes Number of @c batch_sizes
+ * @param[in] max_delay_us    Time in microseconds an inference can wait to be batched
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, const uint32_t *batch_sizes,
+                                  uint32_t num_batch_sizes, uint32_t max_delay_us);
+
+/**
+ * @brief Counters of batches run by a session prepared by {@link nnfw_prepare_batching}
+ */
+typedef struct
+{
+  /** Number of batches run, including inferences run alone */
+  uint64_t num_batches;
+  /** Number of inferences run in batches, so average batch size is num_requests / num_batches */
+  uint64_t num_requests;
+  /** Largest batch size run */
+  uint32_t max_batch_size;
+  /** Number of inferences waiting to be batched now */
+  uint32_t queued_requests;
+  /** Sum of time in microseconds inferences have waited from submission to run */
+  uint64_t total_queue_delay_us;
+  /** Longest time in microseconds an inference has waited from submission to run */
+  uint64_t max_queue_delay_us;
+} nnfw_batching_stats;
+
+/**
+ * @brief       Get counters of batches run so far
+ * @param[in]   session The session prepared by {@link nnfw_prepare_batching}
+ * @param[out]  stats   Counters of batches
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats);
+
 #endif // __NNFW_EXPERIMENTAL_H__
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Batcher.h"
+
+#include "CompletionQueue.h"
+#include "exec/Execution.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace onert
+{
+namespace api
+{
+
+Batcher::Batcher(exec::Execution *single, std::vector<BatchExecution> &&batches,
+                 std::chrono::microseconds max_delay, CompletionQueue *completion_queue)
+  : _single{single}, _batches{std::move(batches)}, _max_delay{max_delay},
+    _completion_queue{completion_queue}, _stats{}
+{
+  assert(_single != nullptr && _completion_queue != nullptr);
+
+  const auto &graph = _single->primary_subgraph();
+  for (const auto &index : graph.getInputs())
+    _input_sizes.push_back(graph.operands().at(index).info().total_size());
+  for (const auto &index : graph.getOutputs())
+    _output_sizes.push_back(graph.operands().at(index).info().total_size());
+
+  std::sort(_batches.begin(), _batches.end(),
+            [](const BatchExecution &lhs, const BatchExecution &rhs) {
+              return lhs.batch_size < rhs.batch_size;
+            });
+
+  // Samples of a batch are laid out one after another in each input and output
+  for (auto &batch : _batches)
+  {
+    assert(batch.batch_size > 1 && batch.execution != nullptr);
+    const auto &batch_graph = batch.execution->primary_subgraph();
+    batch.inputs.resize(_input_sizes.size());
+    for (uint32_t i = 0; i < _input_sizes.size(); ++i)
+    {
+      const auto &info = batch_graph.operands().at(batch_graph.getInputs().at(i)).info();
+      if (info.total_size() != batch.batch_size * _input_sizes[i])
+        throw std::runtime_error{"Input " + std::to_string(i) + " is not batched"};
+      batch.inputs[i].resize(info.total_size());
+      batch.execution->setInput(ir::IOIndex{i}, batch.inputs[i].data(), batch.inputs[i].size());
+    }
+    batch.outputs.resize(_output_sizes.size());
+    for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+    {
+      const auto &info = batch_graph.operands().at(batch_graph.getOutputs().at(i)).info();
+      if (info.isDynamic() || info.total_size() != batch.batch_size * _output_sizes[i])
+        throw std::runtime_error{"Output " + std::to_string(i) + " is not batched"};
+      batch.outputs[i].resize(info.total_size());
+      batch.execution->setOutput(ir::IOIndex{i}, batch.outputs[i].data(), batch.outputs[i].size());
+    }
+  }
+  if (!_batches.empty())
+    _max_batch_size = _batches.back().batch_size;
+
+  _thread = std::thread(&Batcher::run, this);
+}
+
+Batcher::~Batcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _cv.notify_one();
+  _thread.join();
+}
+
+void Batcher::submit(uint64_t request_id, const void **inputs, const size_t *input_lengths,
+                     void **outputs, const size_t *output_lengths)
+{
+  for (size_t i = 0; i < _input_sizes.size(); ++i)
+  {
+    if (input_lengths[i] < _input_sizes[i])
+      throw std::runtime_error{"Too small length"};
+  }
+  for (size_t i = 0; i < _output_sizes.size(); ++i)
+  {
+    if (output_lengths[i] < _output_sizes[i])
+      throw std::runtime_error{"Too small length"};
+  }
+
+  Request request;
+  request.id = request_id;
+  request.inputs.assign(inputs, inputs + _input_sizes.size());
+  request.input_lengths.assign(input_lengths, input_lengths + _input_sizes.size());
+  request.outputs.assign(outputs, outputs + _output_sizes.size());
+  request.output_lengths.assign(output_lengths, output_lengths + _output_sizes.size());
+  request.submit_time = std::chrono::steady_clock::now();
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _requests.push_back(std::move(request));
+    // Batching thread waits for the first request, and then for the largest batch or timeout
+    notify = _requests.size() == 1 || _requests.size() == _max_batch_size;
+  }
+  if (notify)
+    _cv.notify_one();
+}
+
+nnfw_batching_stats Batcher::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto stats = _stats;
+  stats.queued_requests = static_cast<uint32_t>(_requests.size());
+  return stats;
+}
+
+void Batcher::run()
+{
+  std::vector<Request> requests;
+  while (true)
+  {
+    BatchExecution *batch = nullptr;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [this] { return _stop || !_requests.empty(); });
+      if (_requests.empty())
+        return;
+
+      // Wait for more requests until the oldest one has waited for the maximum delay
+      const auto deadline = _requests.front().submit_time + _max_delay;
+      _cv.wait_until(lock, deadline,
+                     [this] { return _stop || _requests.size() >= _max_batch_size; });
+
+      for (auto &candidate : _batches)
+      {
+        if (candidate.batch_size <= _requests.size())
+          batch = &candidate;
+      }
+      const uint32_t batch_size = batch != nullptr ? batch->batch_size : 1;
+
+      const auto now = std::chrono::steady_clock::now();
+      for (uint32_t i = 0; i < batch_size; ++i)
+      {
+        requests.push_back(std::move(_requests.front()));
+        _requests.pop_front();
+        const uint64_t delay_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                    now - requests.back().submit_time)
+                                    .count();
+        _stats.total_queue_delay_us += delay_us;
+        _stats.max_queue_delay_us = std::max(_stats.max_queue_delay_us, delay_us);
+      }
+      _stats.num_batches++;
+      _stats.num_requests += batch_size;
+      _stats.max_batch_size = std::max(_stats.max_batch_size, batch_size);
+    }
+
+    if (batch != nullptr)
+      runBatch(*batch, requests);
+    else
+      runSingle(requests.front());
+    requests.clear();
+  }
+}
+
+void Batcher::runSingle(Request &request)
+{
+  // Run with buffers of request without copy, on runtime thread pool
+  const auto id = request.id;
+  auto completion_queue = _completion_queue;
+  try
+  {
+    auto io_desc = _single->createIODescription(request.inputs, request.input_lengths,
+                                                request.outputs, request.output_lengths);
+    _single->submit(std::move(io_desc), [id, completion_queue](std::exception_ptr error) {
+      completion_queue->push(id, error);
+    });
+  }
+  catch (...)
+  {
+    completion_queue->push(id, std::current_exception());
+  }
+}
+
+void Batcher::runBatch(BatchExecution &batch, std::vector<Request> &requests)
+{
+  assert(requests.size() == batch.batch_size);
+
+  for (size_t i = 0; i < _input_sizes.size(); ++i)
+  {
+    const auto size = _input_sizes[i];
+    for (size_t n = 0; n < requests.size(); ++n)
+      std::memcpy(batch.inputs[i].data() + n * size, requests[n].inputs[i], size);
+  }
+
+  std::exception_ptr error;
+  try
+  {
+    batch.execution->execute();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  for (size_t n = 0; n < requests.size(); ++n)
+  {
+    if (!error)
+    {
+      for (size_t i = 0; i < _output_sizes.size(); ++i)
+      {
+        const auto size = _output_sizes[i];
+        std::memcpy(requests[n].outputs[i], batch.outputs[i].data() + n * size, size);
+      }
+    }
+    _completion_queue->push(requests[n].id, error);
+  }
+}
+
+} // namespace api
+} // namespace onert
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_API_BATCHER_H__
+#define __ONERT_API_BATCHER_H__
+
+#include "nnfw_experimental.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+class Execution;
+} // namespace exec
+namespace api
+{
+
+class CompletionQueue;
+
+/**
+ * @brief Class to coalesce single-sample inferences submitted by nnfw_submit into batches
+ *
+ * Submitted inferences are queued and run by a batching thread. A batch is formed when the
+ * largest batch size is queued or the oldest inference has waited for the maximum delay, with
+ * the largest compiled batch size not greater than the number of queued inferences. So batches
+ * are never padded. An inference run alone is run with its own buffers by the single-sample
+ * execution, and others are gathered to and scattered from buffers of the batch.
+ */
+class Batcher
+{
+public:
+  /**
+   * @brief Execution compiled for a batch size, with its input and output buffers
+   */
+  struct BatchExecution
+  {
+    uint32_t batch_size;
+    std::unique_ptr<exec::Execution> execution;
+    std::vector<std::vector<uint8_t>> inputs;
+    std::vector<std::vector<uint8_t>> outputs;
+  };
+
+public:
+  /**
+   * @brief     Construct a new Batcher object and start its batching thread
+   * @param[in] single            Execution of a sample, which is not owned
+   * @param[in] batches           Executions of batch sizes greater than 1
+   * @param[in] max_delay         Time an inference can wait to be batched with others
+   * @param[in] completion_queue  Queue to notify completions, which is not owned
+   */
+  Batcher(exec::Execution *single, std::vector<BatchExecution> &&batches,
+          std::chrono::microseconds max_delay, CompletionQueue *completion_queue);
+
+  /**
+   * @brief Destroy the Batcher object
+   * @note  It runs queued inferences without delay before stopping the batching thread
+   */
+  ~Batcher();
+
+  Batcher(const Batcher &) = delete;
+  Batcher &operator=(const Batcher &) = delete;
+
+public:
+  /**
+   * @brief Queue a single-sample inference
+   * @note  It throws if a buffer is smaller than a sample
+   */
+  void submit(uint64_t request_id, const void **inputs, const size_t *input_lengths,
+              void **outputs, const size_t *output_lengths);
+
+  /**
+   * @brief Return counters of batches run so far
+   */
+  nnfw_batching_stats stats() const;
+
+private:
+  struct Request
+  {
+    uint64_t id;
+    std::vector<const void *> inputs;
+    std::vector<size_t> input_lengths;
+    std::vector<void *> outputs;
+    std::vector<size_t> output_lengths;
+    std::chrono::steady_clock::time_point submit_time;
+  };
+
+  void run();
+  void runSingle(Request &request);
+  void runBatch(BatchExecution &batch, std::vector<Request> &requests);
+
+private:
+  exec::Execution *_single;
+  // Sorted by batch size
+  std::vector<BatchExecution> _batches;
+  const std::chrono::microseconds _max_delay;
+  CompletionQueue *_completion_queue;
+  uint32_t _max_batch_size{1};
+  // Size of a sample of each input and output
+  std::vector<size_t> _input_sizes;
+  std::vector<size_t> _output_sizes;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<Request> _requests;
+  bool _stop{false};
+  nnfw_batching_stats _stats;
+  std::thread _thread;
+};
+
+} // namespace api
+} // namespace onert
+
+#endif // __ONERT_API_BATCHER_H__
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompletionQueue.h"
+
+#include "util/Exceptions.h"
+
+#include <iostream>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace onert
+{
+namespace api
+{
+
+CompletionQueue::CompletionQueue() : _fd{eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)}
+{
+  // DO NOTHING
+}
+
+CompletionQueue::~CompletionQueue()
+{
+  if (_fd >= 0)
+    close(_fd);
+}
+
+void CompletionQueue::setCallback(nnfw_completion_callback callback, void *user_data)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _callback = callback;
+  _user_data = user_data;
+}
+
+void CompletionQueue::push(uint64_t request_id, NNFW_STATUS status)
+{
+  nnfw_completion_callback callback = nullptr;
+  void *user_data = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_callback == nullptr)
+    {
+      _completions.push_back({request_id, status});
+      if (_fd >= 0)
+      {
+        uint64_t one = 1;
+        // Counter of eventfd cannot overflow with the number of requests in flight
+        (void)write(_fd, &one, sizeof(one));
+      }
+      return;
+    }
+    callback = _callback;
+    user_data = _user_data;
+  }
+
+  callback(request_id, status, user_data);
+}
+
+void CompletionQueue::push(uint64_t request_id, std::exception_ptr error)
+{
+  NNFW_STATUS status = NNFW_STATUS_NO_ERROR;
+  if (error)
+  {
+    try
+    {
+      std::rethrow_exception(error);
+    }
+    catch (const onert::InsufficientBufferSizeException &e)
+    {
+      std::cerr << "Error during inference " << request_id << " : " << e.what() << std::endl;
+      status = NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during inference " << request_id << " : " << e.what() << std::endl;
+      status = NNFW_STATUS_ERROR;
+    }
+  }
+  push(request_id, status);
+}
+
+uint32_t CompletionQueue::pop(nnfw_completion *completions, uint32_t max_count)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  uint32_t count = 0;
+  while (count < max_count && !_completions.empty())
+  {
+    completions[count++] = _completions.front();
+    _completions.pop_front();
+  }
+
+  // Make eventfd not readable, as nothing is left to pop
+  if (_completions.empty() && _fd >= 0)
+  {
+    uint64_t value = 0;
+    (void)read(_fd, &value, sizeof(value));
+  }
+
+  return count;
+}
+
+} // namespace api
+} // namespace onert
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_API_COMPLETION_QUEUE_H__
+#define __ONERT_API_COMPLETION_QUEUE_H__
+
+#include "nnfw_experimental.h"
+
+#include <deque>
+#include <exception>
+#include <mutex>
+
+namespace onert
+{
+namespace api
+{
+
+/**
+ * @brief Queue of completed inferences submitted by nnfw_submit
+ *
+ * It owns an eventfd, which is readable while the queue is not empty.
+ * So users can wait for completions with poll/epoll together with other file descriptors.
+ */
+class CompletionQueue
+{
+public:
+  CompletionQueue();
+  ~CompletionQueue();
+
+  CompletionQueue(const CompletionQueue &) = delete;
+  CompletionQueue &operator=(const CompletionQueue &) = delete;
+
+public:
+  /**
+   * @brief Set callback to be called on completion instead of queueing it
+   */
+  void setCallback(nnfw_completion_callback callback, void *user_data);
+
+  /**
+   * @brief Queue completion of request, or call callback if it is set
+   * @note  It is called on runtime threads
+   */
+  void push(uint64_t request_id, NNFW_STATUS status);
+
+  /**
+   * @brief Queue completion of request with status converted from the exception thrown during
+   *        the inference, or nullptr if succeeded
+   */
+  void push(uint64_t request_id, std::exception_ptr error);
+
+  /**
+   * @brief  Pop completions as many as max_count, without blocking
+   * @return Number of popped completions
+   */
+  uint32_t pop(nnfw_completion *completions, uint32_t max_count);
+
+  /**
+   * @brief Return eventfd which is readable while the queue is not empty, or -1 on failure
+   */
+  int fd() const { return _fd; }
+
+private:
+  int _fd;
+  std::mutex _mutex;
+  std::deque<nnfw_completion> _completions;
+  nnfw_completion_callback _callback{nullptr};
+  void *_user_data{nullptr};
+};
+
+} // namespace api
+} // namespace onert
+
+#endif // __ONERT_API_COMPLETION_QUEUE_H__
@@ -392,3 +392,43 @@ NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->pop_pipeline_output((std::vector<void *> *)outputs);
 }
+
+NNFW_STATUS nnfw_submit(nnfw_session *session, const void **inputs, const size_t *input_lengths,
+                        void **outputs, const size_t *output_lengths, uint64_t *request_id)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->submit(inputs, input_lengths, outputs, output_lengths, request_id);
+}
+
+NNFW_STATUS nnfw_set_completion_callback(nnfw_session *session, nnfw_completion_callback callback,
+                                         void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_completion_callback(callback, user_data);
+}
+
+NNFW_STATUS nnfw_completion_fd(nnfw_session *session, int *fd)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->completion_fd(fd);
+}
+
+NNFW_STATUS nnfw_poll_completions(nnfw_session *session, nnfw_completion *completions,
+                                  uint32_t max_count, uint32_t *count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->poll_completions(completions, max_count, count);
+}
+
+NNFW_STATUS nnfw_prepare_batching(nnfw_session *session, const uint32_t *batch_sizes,
+                                  uint32_t num_batch_sizes, uint32_t max_delay_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_batching(batch_sizes, num_batch_sizes, max_delay_us);
+}
+
+NNFW_STATUS nnfw_get_batching_stats(nnfw_session *session, nnfw_batching_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_batching_stats(stats);
+}
@@ -15,6 +15,8 @@
  */
 
 #include "nnfw_api_internal.h"
+#include "Batcher.h"
+#include "CompletionQueue.h"
 #include "CustomKernelRegistry.h"
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
@@ -27,8 +29,11 @@
 #include "ir/OpCode.h"
 #include "util/TracingCtx.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <set>
 #include <string>
 #include <vector>
 #include <dirent.h>
@@ -158,13 +163,31 @@ void setConfigKeyValues(const CfgKeyValues &keyValues)
 } // namespace
 
 nnfw_session::nnfw_session()
-  : _subgraphs{nullptr}, _compiler{nullptr}, _execution{nullptr},
+  : _subgraphs{nullptr}, _compiler{nullptr},
+    _completion_queue{std::make_unique<onert::api::CompletionQueue>()}, _execution{nullptr},
     _kernel_registry{std::make_shared<onert::api::CustomKernelRegistry>()}, _tracing_ctx{nullptr}
 {
   // DO NOTHING
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  // Stop pipeline threads which may be blocked on queues
+  bool is_running = false;
+  for (const auto &thread : _threads)
+    is_running |= thread.joinable();
+
+  if (is_running)
+  {
+    for (auto &execution : _executions)
+      execution->abortPipeline();
+    for (auto &thread : _threads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+  }
+}
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
 {
@@ -179,7 +202,8 @@ NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
 
   try
   {
-    _subgraphs = onert::circle_loader::loadModel(buffer, size);
+    _model_loader = [buffer, size]() { return onert::circle_loader::loadModel(buffer, size); };
+    _subgraphs = _model_loader();
   }
   catch (const std::exception &e)
   {
@@ -219,17 +243,18 @@ NNFW_STATUS nnfw_session::load_model_from_modelfile(const char *model_file_path)
   {
     if (model_type == ".tflite")
     {
-      _subgraphs = onert::tflite_loader::loadModel(filename.c_str());
+      _model_loader = [filename]() { return onert::tflite_loader::loadModel(filename.c_str()); };
     }
     else if (model_type == ".circle")
     {
-      _subgraphs = onert::circle_loader::loadModel(filename.c_str());
+      _model_loader = [filename]() { return onert::circle_loader::loadModel(filename.c_str()); };
     }
     else
     {
       std::cerr << "Unsupported model type" << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    _subgraphs = _model_loader();
   }
   catch (const std::exception &e)
   {
@@ -299,20 +324,27 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
 
     auto model_file_path = package_path + std::string("/") + models[0].asString(); // first model
     auto model_type = model_types[0].asString(); // first model's type
+    std::function<std::shared_ptr<onert::ir::Subgraphs>()> loader;
     if (model_type == "tflite")
     {
-      _subgraphs = onert::tflite_loader::loadModel(model_file_path);
+      loader = [model_file_path]() { return onert::tflite_loader::loadModel(model_file_path); };
     }
     else if (model_type == "circle")
     {
-      _subgraphs = onert::circle_loader::loadModel(model_file_path);
+      loader = [model_file_path]() { return onert::circle_loader::loadModel(model_file_path); };
     }
     else
     {
       std::cerr << "Unsupported model type in MANIFEST" << std::endl;
       return NNFW_STATUS_ERROR;
     }
-    _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+    auto kernel_registry = _kernel_registry;
+    _model_loader = [loader, kernel_registry]() {
+      auto subgraphs = loader();
+      subgraphs->primary()->bindKernelBuilder(kernel_registry->getBuilder());
+      return subgraphs;
+    };
+    _subgraphs = _model_loader();
   }
   catch (const std::exception &e)
   {
@@ -390,7 +422,17 @@ NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
     {
       _executions.push_back(std::make_shared<onert::exec::Execution>(*it));
     }
-    make_dependency();
+    const auto num_producers = make_dependency();
+    const auto capacity = onert::util::getConfigInt(onert::util::config::PIPELINE_QUEUE_SIZE);
+    if (capacity <= 0)
+      throw std::runtime_error{"PIPELINE_QUEUE_SIZE must be positive"};
+
+    for (uint32_t i = 0; i < _executions.size(); i++)
+    {
+      const bool is_output = (i == _executions.size() - 1);
+      _executions[i]->preparePipeline(capacity, num_producers[i], is_output);
+    }
+
     _threads.resize(_executions.size());
     for (uint32_t i = 0; i < _threads.size(); i++)
     {
@@ -479,9 +521,208 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
-
   _state = State::FINISHED_RUN;
+
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::submit(const void **inputs, const size_t *input_lengths, void **outputs,
+                                 const size_t *output_lengths, uint64_t *request_id)
+{
+  if (!isStatePreparedOrFinishedRun() && !isStateRunning())
+  {
+    std::cerr << "Error during nnfw_session::submit : "
+              << "submit should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::submit : not supported for pipeline run" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (request_id == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  const auto &graph = _execution->primary_subgraph();
+  const auto num_inputs = graph.getInputs().size();
+  const auto num_outputs = graph.getOutputs().size();
+  if ((num_inputs > 0 && (inputs == nullptr || input_lengths == nullptr)) ||
+      (num_outputs > 0 && (outputs == nullptr || output_lengths == nullptr)))
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    if (_batcher)
+    {
+      const auto id = _next_request_id++;
+      _batcher->submit(id, inputs, input_lengths, outputs, output_lengths);
+      *request_id = id;
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    auto io_desc = _execution->createIODescription(
+      std::vector<const void *>(inputs, inputs + num_inputs),
+      std::vector<size_t>(input_lengths, input_lengths + num_inputs),
+      std::vector<void *>(outputs, outputs + num_outputs),
+      std::vector<size_t>(output_lengths, output_lengths + num_outputs));
+
+    const auto id = _next_request_id++;
+    auto completion_queue = _completion_queue.get();
+    _execution->submit(std::move(io_desc), [id, completion_queue](std::exception_ptr error) {
+      completion_queue->push(id, error);
+    });
+    *request_id = id;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::submit : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_completion_callback(nnfw_completion_callback callback,
+                                                  void *user_data)
+{
+  _completion_queue->setCallback(callback, user_data);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::completion_fd(int *fd)
+{
+  if (fd == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (_completion_queue->fd() < 0)
+  {
+    std::cerr << "Error during nnfw_session::completion_fd : failed to create eventfd"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  *fd = _completion_queue->fd();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::poll_completions(nnfw_completion *completions, uint32_t max_count,
+                                           uint32_t *count)
+{
+  if (count == nullptr || (completions == nullptr && max_count > 0))
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  *count = _completion_queue->pop(completions, max_count);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::prepare_batching(const uint32_t *batch_sizes, uint32_t num_batch_sizes,
+                                           uint32_t max_delay_us)
+{
+  if (!isStateModelLoaded())
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (batch_sizes == nullptr && num_batch_sizes > 0)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  std::set<uint32_t> sizes;
+  for (uint32_t i = 0; i < num_batch_sizes; ++i)
+  {
+    if (batch_sizes[i] == 0)
+    {
+      std::cerr << "Error during nnfw_session::prepare_batching : batch size must be positive"
+                << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+    // Model for a sample is always compiled
+    if (batch_sizes[i] > 1)
+      sizes.insert(batch_sizes[i]);
+  }
+
+  try
+  {
+    // Batch is the first dimension of inputs, others are kept including ones set by user
+    std::vector<onert::ir::Shape> input_shapes;
+    const auto &primary = *_subgraphs->primary();
+    for (const auto &index : primary.getInputs())
+    {
+      const auto &shape = primary.operands().at(index).shape();
+      if (shape.rank() == 0 || shape.dim(0) != 1)
+        throw std::runtime_error{"first dimension of model inputs must be 1"};
+      input_shapes.push_back(shape);
+    }
+
+    std::vector<onert::api::Batcher::BatchExecution> batches;
+    for (const auto size : sizes)
+    {
+      auto subgraphs = _model_loader();
+      for (uint32_t i = 0; i < subgraphs->count(); ++i)
+        _tracing_ctx->setSubgraphIndex(subgraphs->at(onert::ir::SubgraphIndex{i}).get(), i);
+
+      auto &graph = *subgraphs->primary();
+      for (uint32_t i = 0; i < input_shapes.size(); ++i)
+      {
+        auto shape = input_shapes[i];
+        shape.dim(0) = size;
+        graph.operands().at(graph.getInputs().at(i)).info().shape(shape);
+      }
+
+      onert::compiler::Compiler compiler{subgraphs, _tracing_ctx.get()};
+      compiler.options() = _compiler->options();
+      subgraphs.reset();
+      auto execution = std::make_unique<onert::exec::Execution>(compiler.compile());
+      batches.push_back({size, std::move(execution), {}, {}});
+    }
+
+    _subgraphs.reset();
+    std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
+    _execution = std::make_unique<onert::exec::Execution>(executors);
+    _batcher = std::make_unique<onert::api::Batcher>(_execution.get(), std::move(batches),
+                                                     std::chrono::microseconds{max_delay_us},
+                                                     _completion_queue.get());
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_batching : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::PREPARED;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_batching_stats(nnfw_batching_stats *stats)
+{
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!_batcher)
+  {
+    std::cerr << "Error during nnfw_session::get_batching_stats : "
+              << "session is not prepared for batching" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  *stats = _batcher->stats();
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -845,8 +1086,10 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
   return NNFW_STATUS_NO_ERROR;
 }
 
-void nnfw_session::make_dependency()
+std::vector<uint32_t> nnfw_session::make_dependency()
 {
+  // Executions which push inputs to each execution
+  std::vector<std::set<uint32_t>> producers(_executions.size());
   for (uint32_t out_exe = 0; out_exe < _executions.size(); out_exe++)
   {
     auto out_graph = _executions[out_exe]->primary_subgraph();
@@ -881,49 +1124,79 @@ void nnfw_session::make_dependency()
           }
 
           if (is_same)
+          {
             _executions[out_exe]->pushNextExe(_executions[in_exe], out->second, in->second);
+            producers[in_exe].insert(out_exe);
+          }
         }
       }
     }
   }
+
+  std::vector<uint32_t> num_producers;
+  for (const auto &producer : producers)
+    num_producers.push_back(producer.size());
+  // User pushes inputs of the first execution
+  if (!num_producers.empty())
+    num_producers[0] += 1;
+  return num_producers;
 }
 
 NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
                                               std::vector<uint32_t> *lengths)
 {
-  static uint32_t count = 0;
   if (inputs->empty())
   {
-    _executions[0]->setFinish();
+    _executions[0]->finishPipelineInput();
     for (uint32_t i = 0; i < _threads.size(); i++)
     {
       _threads[i].join();
     }
+
+    for (uint32_t i = 0; i < _executions.size(); i++)
+    {
+      const auto stats = _executions[i]->pipelineStats();
+      const auto runs = std::max<uint64_t>(stats.num_runs, 1);
+      VERBOSE(NNFW_API) << "Pipeline stage " << i << " : runs " << stats.num_runs
+                        << ", avg run " << stats.total_run_us / runs << "us, max run "
+                        << stats.max_run_us << "us, avg wait " << stats.total_wait_us / runs
+                        << "us, max wait " << stats.max_wait_us << "us, peak ready records "
+                        << stats.peak_ready_records << "/" << stats.capacity << std::endl;
+    }
     return NNFW_STATUS_NO_ERROR;
   }
-  _executions[0]->asyncIoDescSemWait();
-  _executions[0]->createNewAsyncDesc(count++);
-  for (uint32_t i = 0; i < inputs->size(); i++)
+
+  if (lengths->size() < inputs->size())
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : lengths are missing"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    // Blocks while all records of the first execution are in flight
+    const auto count = _pipeline_count++;
+    for (uint32_t i = 0; i < inputs->size(); i++)
+    {
+      _executions[0]->pushPipelineInput(count, onert::ir::IOIndex(i), inputs->at(i),
+                                        lengths->at(i));
+    }
+  }
+  catch (const std::exception &e)
   {
-    _executions[0]->executeAsyncInput(onert::ir::IOIndex(i), inputs->at(i), lengths->at(i));
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
   }
-  _executions[0]->asyncIoDescSemPost();
   return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
 {
-  auto results = _executions[_executions.size() - 1]->getAsyncResults();
-  while (results->empty())
-  {
-    if (_executions[_executions.size() - 1]->stopWait())
-      return NNFW_STATUS_ERROR;
-  }
+  // Blocks until a result comes out. Fails after all results are popped or pipeline is aborted.
+  if (!_executions[_executions.size() - 1]->popPipelineOutput(*outputs))
+    return NNFW_STATUS_ERROR;
 
-  auto result = results->front();
-  results->pop_front();
-  for (uint32_t i = 0; i < result.size(); i++)
-    outputs->push_back(result[i]);
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -23,6 +23,8 @@
 #include <util/GeneralConfigSource.h>
 #include <util/TracingCtx.h>
 
+#include <atomic>
+#include <functional>
 #include <string>
 #include <memory>
 #include <thread>
@@ -33,6 +35,8 @@ namespace onert
 namespace api
 {
 class CustomKernelRegistry;
+class CompletionQueue;
+class Batcher;
 } // namespace api
 namespace exec
 {
@@ -67,7 +71,7 @@ private:
    *           | MODEL_LOADED |
    *           +--------------+
    *             |
-   *             | prepare
+   *             | prepare (or prepare_batching)
    *             v
    *           +--------------+
    *           |   PREPARED   | --------+
@@ -108,6 +112,16 @@ public:
   NNFW_STATUS run_async();
   NNFW_STATUS await();
 
+  NNFW_STATUS submit(const void **inputs, const size_t *input_lengths, void **outputs,
+                     const size_t *output_lengths, uint64_t *request_id);
+  NNFW_STATUS set_completion_callback(nnfw_completion_callback callback, void *user_data);
+  NNFW_STATUS completion_fd(int *fd);
+  NNFW_STATUS poll_completions(nnfw_completion *completions, uint32_t max_count,
+                               uint32_t *count);
+  NNFW_STATUS prepare_batching(const uint32_t *batch_sizes, uint32_t num_batch_sizes,
+                               uint32_t max_delay_us);
+  NNFW_STATUS get_batching_stats(nnfw_batching_stats *stats);
+
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
 
@@ -141,7 +155,7 @@ public:
   //
   // Experimental API
   //
-  void make_dependency();
+  std::vector<uint32_t> make_dependency();
   NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
   NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
 
@@ -162,11 +176,20 @@ private:
 private:
   State _state{State::INITIALIZED};
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
+  // Loads the model again, to compile it for each batch size
+  std::function<std::shared_ptr<onert::ir::Subgraphs>()> _model_loader;
   std::unique_ptr<onert::compiler::Compiler> _compiler;
+  // NOTE _completion_queue should be destroyed after _execution, which waits submitted inferences
+  std::unique_ptr<onert::api::CompletionQueue> _completion_queue;
+  std::atomic<uint64_t> _next_request_id{0};
   std::unique_ptr<onert::exec::Execution> _execution;
+  // NOTE _batcher should be destroyed before _execution, which it runs single inferences on
+  std::unique_ptr<onert::api::Batcher> _batcher;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::vector<std::thread> _threads;
   std::vector<std::shared_ptr<onert::exec::Execution>> _executions;
+  // NOTE Inputs can be pushed from several threads, apart from the one popping outputs
+  std::atomic<uint32_t> _pipeline_count{0};
   std::string _package_file_path;
 
   std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
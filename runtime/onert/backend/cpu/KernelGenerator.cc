@@ -18,6 +18,8 @@
 
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
@@ -33,6 +35,7 @@
 #include "ops/FillLayer.h"
 #include "ops/FullyConnectedLayer.h"
 #include "ops/GatherLayer.h"
+#include "ops/InstanceNormLayer.h"
 #include "ops/LSTMLayer.h"
 #include "ops/MeanLayer.h"
 #include "ops/DetectionPostProcessLayer.h"
@@ -42,13 +45,16 @@
 #include "ops/PadLayer.h"
 #include "ops/PoolLayer.h"
 #include "ops/PowLayer.h"
+#include "ops/PReLULayer.h"
 #include "ops/QuantizeLayer.h"
 #include "ops/RangeLayer.h"
 #include "ops/RankLayer.h"
 #include "ops/ReduceLayer.h"
 #include "ops/ReshapeLayer.h"
 #include "ops/ResizeBilinearLayer.h"
+#include "ops/ResizeNearestNeighborLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RNNLayer.h"
 #include "ops/SelectLayer.h"
 #include "ops/ShapeLayer.h"
 #include "ops/SliceLayer.h"
@@ -59,10 +65,13 @@
 #include "ops/SplitLayer.h"
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
+#include "ops/TopKV2Layer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
+#include "ops/LRNLayer.h"
 #include "ops/MatrixBandPartLayer.h"
 #include "ops/BatchMatMulLayer.h"
 #include "ops/BroadcastToLayer.h"
@@ -466,6 +475,35 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto weights_scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto weights_binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto weights_clusters_index{
+    node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto activation = node.param().activation;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto weights_scales_tensor = _tensor_reg->getPortableTensor(weights_scales_index);
+  auto weights_binary_tensor = _tensor_reg->getPortableTensor(weights_binary_index);
+  auto weights_clusters_tensor = _tensor_reg->getPortableTensor(weights_clusters_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, weights_scales_tensor, weights_binary_tensor,
+                weights_clusters_tensor, bias_tensor, activation, output_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reshape &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -537,7 +575,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -556,7 +594,7 @@ void KernelGenerator::visit(const ir::operation::Comparison &node)
 
   auto fn = std::make_unique<ops::CompareLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, comparison_type, ofm_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, comparison_type, ofm_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -598,6 +636,35 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto input_binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto input_clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_scales_tensor = _tensor_reg->getPortableTensor(input_scales_index);
+  auto input_binary_tensor = _tensor_reg->getPortableTensor(input_binary_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_clusters_tensor = _tensor_reg->getPortableTensor(input_clusters_index);
+
+  // NOTE Weights represented by BCQ have rank 2, [rows, hidden]
+  const auto axis = static_cast<int32_t>(node.param().axis);
+  if (axis != 0 && axis != 1)
+    throw std::runtime_error("BCQGather: axis must be 0 or 1");
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(input_scales_tensor, input_binary_tensor, indices_tensor, input_clusters_tensor,
+                output_tensor, axis, static_cast<int32_t>(node.param().input_hidden_size));
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::OneHot &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -721,7 +788,8 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   else
   {
     auto fn = std::make_unique<ops::ElementwiseUnaryLayer>();
-    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type));
+    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type),
+                  _external_context);
     _return_fn = std::move(fn);
   }
 }
@@ -832,6 +900,51 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  const auto stride = node.param().stride;
+  const auto param_padding = node.param().padding;
+  assert((param_padding.type == ir::PaddingType::SAME) ||
+         (param_padding.type == ir::PaddingType::VALID));
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  if (_ctx.at(ifm_index).info().isDynamic() || _ctx.at(ofm_index).info().isDynamic())
+  {
+    fn->configure(ifm_tensor, ker_tensor, param_padding.type, param_padding.param.left,
+                  param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
+                  stride.horizontal, stride.vertical, ofm_tensor, _external_context);
+
+    _return_fn = std::move(fn);
+    return;
+  }
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  // NOTE Padding of transpose conv is calculated with output as input of conv
+  const auto padding =
+    ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+  fn->configure(ifm_tensor, ker_tensor, param_padding.type, padding.left, padding.right,
+                padding.top, padding.bottom, stride.horizontal, stride.vertical, ofm_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reduce &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -847,7 +960,7 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
 
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -856,7 +969,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -876,7 +990,7 @@ void KernelGenerator::visit(const ir::operation::Select &node)
 
   auto fn = std::make_unique<ops::SelectLayer>();
 
-  fn->configure(condition_tensor, true_tensor, false_tensor, output_tensor);
+  fn->configure(condition_tensor, true_tensor, false_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1003,6 +1117,47 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::INPUT)};
+
+  auto align_corners = node.param().align_corners;
+  auto layout = node.param().layout;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::ResizeNearestNeighborLayer>();
+
+  if (node.getInputs().size() == 1)
+  {
+    fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
+                  align_corners, layout, _external_context);
+  }
+  else
+  {
+    assert(node.getInputs().size() == 2);
+    const auto size_index{node.getInputs().at(ir::operation::ResizeNearestNeighbor::SIZE)};
+    auto size_tensor = _tensor_reg->getPortableTensor(size_index);
+    if (size_tensor->is_constant())
+    {
+      auto size_vec = _ctx.at(size_index).asVector<int32_t>();
+      const auto height_out = size_vec[0];
+      const auto width_out = size_vec[1];
+      fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners, layout,
+                    _external_context);
+    }
+    else
+    {
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, layout,
+                    _external_context);
+    }
+  }
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reverse &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1075,7 +1230,62 @@ void KernelGenerator::visit(const ir::operation::Pow &node)
 
   auto fn = std::make_unique<ops::PowLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, ir::Activation::NONE, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, ir::Activation::NONE, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::InstanceNorm &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::InstanceNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::InstanceNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::InstanceNorm::Input::BETA)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::InstanceNormLayer>();
+
+  fn->configure(ifm_tensor, gamma_tensor, beta_tensor, node.param().epsilon,
+                node.param().activation, ofm_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::LocalResponseNormalization &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::LocalResponseNormalization::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+
+  const auto &param = node.param();
+
+  auto fn = std::make_unique<ops::LRNLayer>();
+
+  fn->configure(ifm_tensor, param.radius, param.bias, param.alpha, param.beta, ofm_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::PReLU &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::PReLU::Input::INPUT)};
+  const auto alpha_index{node.getInputs().at(ir::operation::PReLU::Input::ALPHA)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto alpha_tensor = _tensor_reg->getPortableTensor(alpha_index);
+
+  auto fn = std::make_unique<ops::PReLULayer>();
+
+  fn->configure(ifm_tensor, alpha_tensor, ofm_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1140,7 +1350,7 @@ void KernelGenerator::visit(const ir::operation::SquaredDifference &node)
 
   auto fn = std::make_unique<ops::SqDiffLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, ofm_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -1160,6 +1370,22 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TopKV2 &node)
+{
+  const auto values_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES)};
+  const auto indices_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES)};
+  const auto input_index{node.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::TopKV2Layer>();
+
+  fn->configure(input_tensor, node.param().k, values_tensor, indices_tensor, _external_context);
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::MatrixBandPart &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1565,7 +1791,38 @@ void KernelGenerator::visit(const ir::operation::LSTM &node)
     /*output_offset=*/0, scratch_buffer_tensor, output_state_out_tensor, cell_state_out_tensor,
     output_tensor,
     !_ctx.at(output_state_in_index).info().isVariable() /* means empty buffer on frontend now */,
-    !_ctx.at(cell_state_in_index).info().isVariable());
+    !_ctx.at(cell_state_in_index).info().isVariable(), _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  const auto output_index{node.getOutputs().at(ir::operation::RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{
+    node.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT)};
+
+  const auto input_index{node.getInputs().at(ir::operation::RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(ir::operation::RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{
+    node.getInputs().at(ir::operation::RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(ir::operation::RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(ir::operation::RNN::Input::HIDDEN_STATE_IN)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto hidden_state_out_tensor = _tensor_reg->getPortableTensor(hidden_state_out_index);
+
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto weights_tensor = _tensor_reg->getPortableTensor(weights_index);
+  auto recurrent_weights_tensor = _tensor_reg->getPortableTensor(recurrent_weights_index);
+  auto bias_tensor = _tensor_reg->getPortableTensor(bias_index);
+  auto hidden_state_in_tensor = _tensor_reg->getPortableTensor(hidden_state_in_index);
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  fn->configure(input_tensor, weights_tensor, recurrent_weights_tensor, bias_tensor,
+                hidden_state_in_tensor, node.param().activation, output_tensor,
+                hidden_state_out_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -29,21 +29,6 @@ namespace cpu
 {
 namespace ops
 {
-namespace
-{
-template <typename T> std::function<bool(T, T)> GetComparefunction(bool is_arg_max)
-{
-  if (is_arg_max)
-  {
-    return std::greater<T>();
-  }
-  else
-  {
-    return std::less<T>();
-  }
-}
-} // namespace
-
 void ArgMinMaxLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                const IPortableTensor *axis, bool is_arg_max)
 {
@@ -66,7 +51,7 @@ void ArgMinMaxLayer::run()
   }
 #define TF_LITE_ARG_MIN_MAX(input_type, axis_type, output_type)                 \
   ArgMinMax(getShape(_input), getBuffer<input_type>(_input), getShape(_output), \
-            getBuffer<output_type>(_output), axis, GetComparefunction<input_type>(_is_arg_max));
+            getBuffer<output_type>(_output), axis, _is_arg_max);
   if (_output->data_type() == ir::DataType::INT32)
   {
     switch (_input->data_type())
@@ -79,7 +64,7 @@ void ArgMinMaxLayer::run()
         TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int32_t);
         break;
       case ir::DataType::QUANT_INT8_ASYMM:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int32_t);
+        TF_LITE_ARG_MIN_MAX(int8_t, int32_t, int32_t);
         break;
       case ir::DataType::INT32:
         TF_LITE_ARG_MIN_MAX(int32_t, int32_t, int32_t);
@@ -100,7 +85,7 @@ void ArgMinMaxLayer::run()
         TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int64_t);
         break;
       case ir::DataType::QUANT_INT8_ASYMM:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int64_t);
+        TF_LITE_ARG_MIN_MAX(int8_t, int32_t, int64_t);
         break;
       case ir::DataType::INT32:
         TF_LITE_ARG_MIN_MAX(int32_t, int32_t, int64_t);
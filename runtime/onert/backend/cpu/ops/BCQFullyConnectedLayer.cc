@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BCQFullyConnectedLayer.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQFullyConnectedLayer::BCQFullyConnectedLayer()
+  : _input(nullptr), _weights_scales(nullptr), _weights_binary(nullptr),
+    _weights_clusters(nullptr), _bias(nullptr), _output(nullptr),
+    _activation(ir::Activation::NONE), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void BCQFullyConnectedLayer::configure(const IPortableTensor *input,
+                                       const IPortableTensor *weights_scales,
+                                       const IPortableTensor *weights_binary,
+                                       const IPortableTensor *weights_clusters,
+                                       const IPortableTensor *bias, ir::Activation activation,
+                                       IPortableTensor *output,
+                                       const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _weights_scales = weights_scales;
+  _weights_binary = weights_binary;
+  _weights_clusters = weights_clusters;
+  _bias = bias;
+  _activation = activation;
+  _output = output;
+  _external_context = external_context;
+}
+
+void BCQFullyConnectedLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQFullyConnected: unsupported data type"};
+
+  nnfw::cker::BCQFullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::BCQFullyConnected(
+    op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights_scales),
+    getBuffer<float>(_weights_scales), getShape(_weights_binary),
+    getBuffer<int32_t>(_weights_binary), getShape(_weights_clusters),
+    getBuffer<int32_t>(_weights_clusters), getShape(_bias),
+    _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+    _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
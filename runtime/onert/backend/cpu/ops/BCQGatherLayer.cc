@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "BCQGatherLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void BCQGatherLayer::configure(const IPortableTensor *input_scales,
+                               const IPortableTensor *input_binary, const IPortableTensor *indices,
+                               const IPortableTensor *input_clusters, IPortableTensor *output,
+                               int32_t axis, int32_t hidden_size)
+{
+  _input_scales = input_scales;
+  _input_binary = input_binary;
+  _indices = indices;
+  _input_clusters = input_clusters;
+  _output = output;
+  _axis = axis;
+  _hidden_size = hidden_size;
+}
+
+void BCQGatherLayer::run()
+{
+  if (_output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error("BCQGather: unsupported output data type");
+
+  nnfw::cker::BCQGatherParams op_params;
+  op_params.axis = _axis;
+  op_params.hidden_size = _hidden_size;
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      nnfw::cker::BCQGather<int32_t>(
+        op_params, getShape(_input_scales), getBuffer<float>(_input_scales),
+        getShape(_input_binary), getBuffer<int32_t>(_input_binary), getShape(_indices),
+        getBuffer<int32_t>(_indices), getShape(_input_clusters),
+        getBuffer<int32_t>(_input_clusters), getShape(_output), getBuffer<float>(_output));
+      break;
+    case OperandType::INT64:
+      nnfw::cker::BCQGather<int64_t>(
+        op_params, getShape(_input_scales), getBuffer<float>(_input_scales),
+        getShape(_input_binary), getBuffer<int32_t>(_input_binary), getShape(_indices),
+        getBuffer<int64_t>(_indices), getShape(_input_clusters),
+        getBuffer<int32_t>(_input_clusters), getShape(_output), getBuffer<float>(_output));
+      break;
+    default:
+      throw std::runtime_error("BCQGather: unsupported indices data type");
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
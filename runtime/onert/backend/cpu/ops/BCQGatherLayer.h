@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __ONERT_BACKEND_CPU_OPS_BCQGATHERLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_BCQGATHERLAYER_H__
+
+#include <backend/IPortableTensor.h>
+
+#include <exec/IFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class BCQGatherLayer : public ::onert::exec::IFunction
+{
+public:
+  BCQGatherLayer()
+    : _input_scales{nullptr}, _input_binary{nullptr}, _indices{nullptr},
+      _input_clusters{nullptr}, _output{nullptr}, _axis{0}, _hidden_size{0}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *input_scales, const IPortableTensor *input_binary,
+                 const IPortableTensor *indices, const IPortableTensor *input_clusters,
+                 IPortableTensor *output, int32_t axis, int32_t hidden_size);
+
+  void run() override;
+
+private:
+  const IPortableTensor *_input_scales;
+  const IPortableTensor *_input_binary;
+  const IPortableTensor *_indices;
+  const IPortableTensor *_input_clusters;
+  IPortableTensor *_output;
+
+  int32_t _axis;
+  int32_t _hidden_size;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_BCQGATHERLAYER_H__
@@ -37,10 +37,11 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  ruy::Context *_ruy_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params, ruy::Context *ruy_context)
+    : _op_params(std::move(op_params)), _need_broadcast(false), _ruy_context(ruy_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -69,12 +70,14 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     if (_need_broadcast)
     {
       nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _ruy_context);
     }
     else
     {
       nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _ruy_context);
     }
   }
 };
@@ -83,7 +86,8 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params,
+                      ruy::Context *ruy_context)
 {
   switch (lhs->data_type())
   {
@@ -93,7 +97,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     case OperandType::INT32:
@@ -102,7 +106,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.quantized_activation_max = output_activation_max;
       op_params.quantized_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     default:
@@ -165,7 +169,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -174,6 +179,8 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
+  ruy::Context *ruy_context = _external_context->ruy_context();
 
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
@@ -182,20 +189,20 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kSub:
@@ -203,21 +210,21 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kMul:
@@ -225,20 +232,20 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
       }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kDiv:
@@ -254,7 +261,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     default:
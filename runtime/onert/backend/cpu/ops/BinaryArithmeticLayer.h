@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_BINARYARITHMETICLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -49,7 +50,8 @@ public:
 
 public:
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                 const ir::Activation activation, const ArithmeticType arithmetic_type);
+                 const ir::Activation activation, const ArithmeticType arithmetic_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -58,6 +60,8 @@ private:
   const IPortableTensor *_rhs;
   IPortableTensor *_output;
 
+  std::shared_ptr<ExternalContext> _external_context;
+
   std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)> _kernel;
 };
 
@@ -45,7 +45,7 @@ static_assert(static_cast<int>(OpType::LessEqual) == 5, "An OpType value has cha
 
 template <typename T>
 void compareQuant8(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                   OpType op_type)
+                   OpType op_type, ruy::Context *ruy_context)
 {
   nnfw::cker::ComparisonParams params;
   params.left_shift = 8;
@@ -61,9 +61,10 @@ void compareQuant8(const IPortableTensor *lhs, const IPortableTensor *rhs, IPort
                                       &params.input2_shift);
   params.is_broadcast = !HaveSameShapes(lhs, rhs);
 
-  using CompareFunction = void (*)(
-    ComparisonParams & params, const Shape &input1_shape, const T *input1_data,
-    const Shape &input2_shape, const T *input2_data, const Shape &output_shape, bool *output_data);
+  using CompareFunction =
+    void (*)(ComparisonParams & params, const Shape &input1_shape, const T *input1_data,
+             const Shape &input2_shape, const T *input2_data, const Shape &output_shape,
+             bool *output_data, ruy::Context *ruy_context);
 
   static const CompareFunction broadcast_fns[] = {
     Broadcast4DSlowEqualWithScaling,   Broadcast4DSlowNotEqualWithScaling,
@@ -85,18 +86,19 @@ void compareQuant8(const IPortableTensor *lhs, const IPortableTensor *rhs, IPort
   CompareFunction fn = (params.is_broadcast ? broadcast_fns[index] : non_broadcast_fns[index]);
 
   fn(params, getExtendedTensorShape(lhs), getBuffer<T>(lhs), getExtendedTensorShape(rhs),
-     getBuffer<T>(rhs), getExtendedTensorShape(output), getBuffer<bool>(output));
+     getBuffer<T>(rhs), getExtendedTensorShape(output), getBuffer<bool>(output), ruy_context);
 }
 
 template <typename T>
 void compareScalar(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                   OpType op_type)
+                   OpType op_type, ruy::Context *ruy_context)
 {
   bool requires_broadcast = !HaveSameShapes(lhs, rhs);
 
   using CompareFunction =
     void (*)(const Shape &input1_shape, const T *input1_data, const Shape &input2_shape,
-             const T *input2_data, const Shape &output_shape, bool *output_data);
+             const T *input2_data, const Shape &output_shape, bool *output_data,
+             ruy::Context *ruy_context);
 
   static const CompareFunction broadcast_fns[] = {
     Broadcast4DSlowEqual,        Broadcast4DSlowNotEqual, Broadcast4DSlowGreater,
@@ -117,48 +119,50 @@ void compareScalar(const IPortableTensor *lhs, const IPortableTensor *rhs, IPort
   CompareFunction fn = (requires_broadcast ? broadcast_fns[index] : non_broadcast_fns[index]);
 
   fn(getExtendedTensorShape(lhs), getBuffer<T>(lhs), getExtendedTensorShape(rhs), getBuffer<T>(rhs),
-     getExtendedTensorShape(output), getBuffer<bool>(output));
+     getExtendedTensorShape(output), getBuffer<bool>(output), ruy_context);
 }
 
 } // namespace
 
 CompareLayer::CompareLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr),
-    _op_type(ir::operation::Comparison::ComparisonType::Equal)
+    _op_type(ir::operation::Comparison::ComparisonType::Equal), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void CompareLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
-                             const OpType op_type, IPortableTensor *output)
+                             const OpType op_type, IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _lhs = lhs;
   _rhs = rhs;
   _op_type = op_type;
   _output = output;
+  _external_context = external_context;
 }
 
 void CompareLayer::run()
 {
   if (_lhs->data_type() == OperandType::FLOAT32)
   {
-    compareScalar<float>(_lhs, _rhs, _output, _op_type);
+    compareScalar<float>(_lhs, _rhs, _output, _op_type, _external_context->ruy_context());
   }
   else if (_lhs->data_type() == OperandType::INT32)
   {
-    compareScalar<int32_t>(_lhs, _rhs, _output, _op_type);
+    compareScalar<int32_t>(_lhs, _rhs, _output, _op_type, _external_context->ruy_context());
   }
   else if (_lhs->data_type() == OperandType::INT64)
   {
-    compareScalar<int64_t>(_lhs, _rhs, _output, _op_type);
+    compareScalar<int64_t>(_lhs, _rhs, _output, _op_type, _external_context->ruy_context());
   }
   else if (_lhs->data_type() == OperandType::BOOL8)
   {
-    compareScalar<uint8_t>(_lhs, _rhs, _output, _op_type);
+    compareScalar<uint8_t>(_lhs, _rhs, _output, _op_type, _external_context->ruy_context());
   }
   else if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    compareQuant8<uint8_t>(_lhs, _rhs, _output, _op_type);
+    compareQuant8<uint8_t>(_lhs, _rhs, _output, _op_type, _external_context->ruy_context());
   }
   else
   {
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_COMPARELAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <ir/operation/Comparison.h>
@@ -38,7 +39,8 @@ public:
 
 public:
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
-                 const ir::operation::Comparison::ComparisonType op_type, IPortableTensor *output);
+                 const ir::operation::Comparison::ComparisonType op_type, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -47,6 +49,8 @@ private:
   const IPortableTensor *_rhs;
   IPortableTensor *_output;
   ir::operation::Comparison::ComparisonType _op_type;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
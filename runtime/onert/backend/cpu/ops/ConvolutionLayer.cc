@@ -20,6 +20,8 @@
 #include "../Tensor.h"
 #include "ir/Padding.h"
 #include <cker/operation/Conv.h>
+#include <util/ConfigSource.h>
+#include <util/WeightCache.h>
 
 namespace onert
 {
@@ -210,8 +212,24 @@ void ConvolutionLayer::prepare()
   if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
+    std::function<nnfw::cker::Conv::TransposedFilter()> get_transposed_filter;
+    util::WeightCache::Key filter_key;
+    if (util::getConfigBool(util::config::SHARE_WEIGHTS) &&
+        util::WeightCache::get().findKey(getBuffer<float>(_kernel), filter_key))
+    {
+      // Sessions of the same model share the transposed filter
+      get_transposed_filter = [this, filter_key]() {
+        const auto filter_shape = getShape(_kernel);
+        const auto filter_data = getBuffer<float>(_kernel);
+        const auto transform = "cpu.conv.hwcn." + std::to_string(filter_shape.Dims(0));
+        return util::WeightCache::get().getOrCreate<const std::vector<float>>(
+          util::WeightCache::derivedKey(filter_key, transform),
+          [&]() { return nnfw::cker::Conv::TransposeFilter(filter_shape, filter_data); });
+      };
+    }
     kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                   is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+                   is_transposed, _dilationWidthFactor, _dilationHeightFactor,
+                   get_transposed_filter);
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
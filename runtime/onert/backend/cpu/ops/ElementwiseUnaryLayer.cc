@@ -36,10 +36,22 @@ namespace ops
 
 namespace
 {
-void absFloat32(const IPortableTensor *input, IPortableTensor *output)
+using ContextKernel = void (*)(const IPortableTensor *, IPortableTensor *, ruy::Context *);
+
+// Kernels of cker elementwise ops run on threads of ruy_context
+std::function<void(const IPortableTensor *, IPortableTensor *)>
+bindContext(ContextKernel kernel, ruy::Context *ruy_context)
+{
+  return [kernel, ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+    kernel(input, output, ruy_context);
+  };
+}
+
+void absFloat32(const IPortableTensor *input, IPortableTensor *output,
+                ruy::Context *ruy_context)
 {
   nnfw::cker::Abs(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
 template <typename FromT>
@@ -112,10 +124,11 @@ void cast(const IPortableTensor *input, IPortableTensor *output)
   }
 }
 
-void cosFloat32(const IPortableTensor *input, IPortableTensor *output)
+void cosFloat32(const IPortableTensor *input, IPortableTensor *output,
+                ruy::Context *ruy_context)
 {
   nnfw::cker::Cos(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
 void dequantizeInt8(const IPortableTensor *input, IPortableTensor *output)
@@ -142,16 +155,18 @@ void erfFloat32(const IPortableTensor *input, IPortableTensor *output)
                   getBuffer<float>(output));
 }
 
-void floorFloat32(const IPortableTensor *input, IPortableTensor *output)
+void floorFloat32(const IPortableTensor *input, IPortableTensor *output,
+                  ruy::Context *ruy_context)
 {
   nnfw::cker::Floor(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+                    getBuffer<float>(output), ruy_context);
 }
 
-void logFloat32(const IPortableTensor *input, IPortableTensor *output)
+void logFloat32(const IPortableTensor *input, IPortableTensor *output,
+                ruy::Context *ruy_context)
 {
   nnfw::cker::Log(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
 void logicalNot(const IPortableTensor *input, IPortableTensor *output)
@@ -160,9 +175,11 @@ void logicalNot(const IPortableTensor *input, IPortableTensor *output)
                          getBuffer<bool>(output));
 }
 
-template <typename T> void neg(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void neg(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Neg<T>(getShape(input), getBuffer<T>(input), getShape(output), getBuffer<T>(output));
+  nnfw::cker::Neg<T>(getShape(input), getBuffer<T>(input), getShape(output), getBuffer<T>(output),
+                     ruy_context);
 }
 
 void roundFloat32(const IPortableTensor *input, IPortableTensor *output)
@@ -171,28 +188,32 @@ void roundFloat32(const IPortableTensor *input, IPortableTensor *output)
                     getBuffer<float>(output));
 }
 
-void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output,
+                  ruy::Context *ruy_context)
 {
   nnfw::cker::Rsqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+                    getBuffer<float>(output), ruy_context);
 }
 
-void sinFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sinFloat32(const IPortableTensor *input, IPortableTensor *output,
+                ruy::Context *ruy_context)
 {
   nnfw::cker::Sin(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
-void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output,
+                 ruy::Context *ruy_context)
 {
   nnfw::cker::Sqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                   getBuffer<float>(output));
+                   getBuffer<float>(output), ruy_context);
 }
 
-void squareFloat32(const IPortableTensor *input, IPortableTensor *output)
+void squareFloat32(const IPortableTensor *input, IPortableTensor *output,
+                   ruy::Context *ruy_context)
 {
   nnfw::cker::Square(getShape(input), getBuffer<float>(input), getShape(output),
-                     getBuffer<float>(output));
+                     getBuffer<float>(output), ruy_context);
 }
 
 template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPortableTensor *output)
@@ -207,20 +228,23 @@ template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPorta
 } // namespace
 
 void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                                      const ElementwiseUnaryType op_type)
+                                      const ElementwiseUnaryType op_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
+  ruy::Context *ruy_context = _external_context->ruy_context();
 
   switch (op_type)
   {
     case ElementwiseUnaryType::kAbs:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = absFloat32;
+        _kernel = bindContext(absFloat32, ruy_context);
       }
       else
       {
@@ -233,7 +257,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kCos:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = cosFloat32;
+        _kernel = bindContext(cosFloat32, ruy_context);
       }
       else
       {
@@ -278,7 +302,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kFloor:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = floorFloat32;
+        _kernel = bindContext(floorFloat32, ruy_context);
       }
       else
       {
@@ -288,7 +312,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kLog:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = logFloat32;
+        _kernel = bindContext(logFloat32, ruy_context);
       }
       else
       {
@@ -308,15 +332,15 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kNeg:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = neg<float>;
+        _kernel = bindContext(neg<float>, ruy_context);
       }
       else if ((input->data_type() == OperandType::INT64))
       {
-        _kernel = neg<int64_t>;
+        _kernel = bindContext(neg<int64_t>, ruy_context);
       }
       else if ((input->data_type() == OperandType::INT32))
       {
-        _kernel = neg<int32_t>;
+        _kernel = bindContext(neg<int32_t>, ruy_context);
       }
       else
       {
@@ -336,7 +360,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kRSqrt:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = rsqrtFloat32;
+        _kernel = bindContext(rsqrtFloat32, ruy_context);
       }
       else
       {
@@ -346,7 +370,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kSin:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = sinFloat32;
+        _kernel = bindContext(sinFloat32, ruy_context);
       }
       else
       {
@@ -356,7 +380,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kSqrt:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = sqrtFloat32;
+        _kernel = bindContext(sqrtFloat32, ruy_context);
       }
       else
       {
@@ -366,7 +390,7 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kSquare:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = squareFloat32;
+        _kernel = bindContext(squareFloat32, ruy_context);
       }
       else
       {
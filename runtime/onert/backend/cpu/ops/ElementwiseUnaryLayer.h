@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_ELEMENTWISEUNARYLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -54,20 +55,22 @@ enum class ElementwiseUnaryType
 class ElementwiseUnaryLayer : public ::onert::exec::IFunction
 {
 public:
-  ElementwiseUnaryLayer() : _input(nullptr), _output(nullptr), _kernel()
+  ElementwiseUnaryLayer() : _input(nullptr), _output(nullptr), _external_context(nullptr), _kernel()
   {
     // DO NOTHING
   }
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output,
-                 const ElementwiseUnaryType op_type);
+                 const ElementwiseUnaryType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
   std::function<void(const IPortableTensor *, IPortableTensor *)> _kernel;
 };
 
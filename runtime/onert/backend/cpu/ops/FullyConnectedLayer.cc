@@ -21,6 +21,8 @@
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -30,6 +32,23 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Loader keeps int8 weights of int8 FC as asymmetric, which are symmetric if zero points are 0
+bool isSymmetricInt8(const IPortableTensor *tensor)
+{
+  if (tensor->data_type() == OperandType::QUANT_INT8_SYMM)
+    return true;
+  if (tensor->data_type() != OperandType::QUANT_INT8_ASYMM)
+    return false;
+  const auto &zero_points = tensor->data_zero_points();
+  return std::all_of(zero_points.begin(), zero_points.end(),
+                     [](int32_t zero_point) { return zero_point == 0; });
+}
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
@@ -150,6 +169,17 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
   const uint16_t *w1_indices = _weights->sparsity()->w1_indices();
 
   auto block_size = _weights->sparsity()->block_size();
+  if (block_size.size() != 0 && block_size.size() != 2)
+    throw std::runtime_error{"FullyConnected: unsupported sparsity"};
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    if (block_size.size() == 0 || !isSymmetricInt8(_weights))
+      throw std::runtime_error{"FullyConnected: unsupported sparsity"};
+    fullyConnectedSparseWeightQuant8(block_size[0], block_size[1]);
+    return;
+  }
+
   if (block_size.size() == 0)
   {
     nnfw::cker::FullyConnectedSparseWeightRandom(
@@ -157,15 +187,50 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
       getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
   }
-  else if (block_size.size() == 2 && block_size[0] == 16 && block_size[1] == 1)
+  else
   {
-    nnfw::cker::FullyConnectedSparseWeight16x1(
+    // 16x1 blocks are also handled here to run on multi threads
+    nnfw::cker::FullyConnectedSparseWeightBlock(
       op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
-      getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
+      getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices, block_size[0],
+      block_size[1], _external_context ? _external_context->ruy_context() : nullptr);
   }
-  else
-    throw std::runtime_error{"FullyConnected: unsupported sparsity"};
+}
+
+void FullyConnectedLayer::fullyConnectedSparseWeightQuant8(int block_rows, int block_cols)
+{
+  // NOTE Only symmetric int8 weights are supported since zero blocks are not stored
+  const int output_depth = getShape(_weights).Dims(0);
+  if (_per_channel_output_multiplier.empty())
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+      _weights->data_scales().size(), output_depth, _per_channel_output_multiplier,
+      _per_channel_output_shift);
+  }
+  const int output_size = getShape(_output).FlatSize();
+  if (static_cast<int>(_sparse_scratch.size()) < output_size)
+    _sparse_scratch.resize(output_size);
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedSparseWeightBlock(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(), true,
+    getShape(_input), getBuffer<int8_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+    getShape(_bias), _bias ? getBuffer<int32_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int8_t>(_output), _sparse_scratch.data(), _weights->sparsity()->w1_segments(),
+    _weights->sparsity()->w1_indices(), block_rows, block_cols,
+    _external_context ? _external_context->ruy_context() : nullptr);
 }
 
 void FullyConnectedLayer::fullyConnected16x1Float32()
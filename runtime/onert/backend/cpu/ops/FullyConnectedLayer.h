@@ -55,6 +55,8 @@ public:
 
   void fullyConnectedSparseWeight();
 
+  void fullyConnectedSparseWeightQuant8(int block_rows, int block_cols);
+
   void fullyConnected16x1Float32();
 
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -77,6 +79,11 @@ private:
 
   std::shared_ptr<ExternalContext> _external_context;
 
+  // For int8 block sparse weights
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+  std::vector<int32_t> _sparse_scratch;
+
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
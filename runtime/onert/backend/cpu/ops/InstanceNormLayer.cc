@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "InstanceNormLayer.h"
+
+#include <cker/operation/InstanceNorm.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+InstanceNormLayer::InstanceNormLayer()
+  : _input(nullptr), _gamma(nullptr), _beta(nullptr), _output(nullptr), _epsilon(0.f),
+    _activation(ir::Activation::NONE), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void InstanceNormLayer::configure(const IPortableTensor *input, const IPortableTensor *gamma,
+                                  const IPortableTensor *beta, float epsilon,
+                                  ir::Activation activation, IPortableTensor *output,
+                                  const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _gamma = gamma;
+  _beta = beta;
+  _epsilon = epsilon;
+  _activation = activation;
+  _output = output;
+  _external_context = external_context;
+}
+
+void InstanceNormLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"InstanceNorm: unsupported data type"};
+
+  nnfw::cker::InstanceNormParams op_params;
+  op_params.epsilon = _epsilon;
+  CalculateActivationRange(_activation, &op_params.float_activation_min,
+                           &op_params.float_activation_max);
+
+  nnfw::cker::InstanceNorm(op_params, getShape(_input), getBuffer<float>(_input),
+                           getShape(_gamma), getBuffer<float>(_gamma), getShape(_beta),
+                           getBuffer<float>(_beta), getShape(_output), getBuffer<float>(_output),
+                           _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "LRNLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/LocalResponseNormalization.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+LRNLayer::LRNLayer()
+  : _input(nullptr), _output(nullptr), _radius(0), _bias(0.f), _alpha(0.f), _beta(0.f),
+    _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void LRNLayer::configure(const IPortableTensor *input, int radius, float bias, float alpha,
+                         float beta, IPortableTensor *output,
+                         const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _radius = radius;
+  _bias = bias;
+  _alpha = alpha;
+  _beta = beta;
+  _output = output;
+  _external_context = external_context;
+}
+
+void LRNLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"LocalResponseNormalization: unsupported data type"};
+
+  nnfw::cker::LocalResponseNormalizationParams op_params;
+  op_params.range = _radius;
+  op_params.bias = _bias;
+  op_params.alpha = _alpha;
+  op_params.beta = _beta;
+
+  nnfw::cker::LocalResponseNormalization(op_params, getShape(_input), getBuffer<float>(_input),
+                                         getShape(_output), getBuffer<float>(_output),
+                                         _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
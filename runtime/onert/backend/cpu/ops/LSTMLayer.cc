@@ -18,7 +18,9 @@
 #include "LSTMLayer.h"
 
 #include "OperationUtils.h"
+#include "../Tensor.h"
 
+#include <cker/operation/FusedLSTM.h>
 #include <cker/operation/LSTM.h>
 
 namespace onert
@@ -58,8 +60,39 @@ inline void initializeStateBuffer(const onert::backend::IPortableTensor *tensor_
   else
     memset(buffer, 0, tensor_in->total_size());
 }
+
+inline bool hasData(const IPortableTensor *tensor)
+{
+  // If tensor is not given or the tensor size is 0, consider it was not given
+  return tensor != nullptr && tensor->total_size() > 0;
+}
+
+// Return float buffer of optional weights, dequantizing symmetric int8 weights of hybrid LSTM
+const float *getFloatWeights(const IPortableTensor *tensor, std::vector<float> *dequantized)
+{
+  if (!hasData(tensor))
+    return nullptr;
+  if (tensor->data_type() == OperandType::FLOAT32)
+    return getBuffer<float>(tensor);
+
+  assert(tensor->data_type() == OperandType::QUANT_INT8_SYMM);
+  const int size = getShape(tensor).FlatSize();
+  const int8_t *data = getBuffer<int8_t>(tensor);
+  const float scale = tensor->data_scale();
+  dequantized->resize(size);
+  for (int i = 0; i < size; ++i)
+    (*dequantized)[i] = data[i] * scale;
+  return dequantized->data();
+}
 } // namespace
 
+LSTMLayer::LSTMLayer() : _fused_lstm(new nnfw::cker::FusedLSTM())
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
 void LSTMLayer::LSTMFloat()
 {
   auto in_shape = _input->getShape();
@@ -239,6 +272,89 @@ void LSTMLayer::LSTMFloat()
   }
 }
 
+void LSTMLayer::LSTMFused()
+{
+  if (!_is_weights_packed)
+  {
+    // This means that weights are not constant
+    packWeights();
+  }
+
+  auto in_shape = _input->getShape();
+  assert(in_shape.rank() >= 2 && in_shape.rank() <= 3);
+  int max_time, n_batch;
+  if (in_shape.rank() == 3)
+  {
+    max_time = (_time_major) ? in_shape.dim(0) : in_shape.dim(1);
+    n_batch = (_time_major) ? in_shape.dim(1) : in_shape.dim(0);
+  }
+  else
+  {
+    max_time = 1;
+    n_batch = in_shape.dim(0);
+  }
+  const int n_input = in_shape.dim(_input->getShape().rank() - 1);
+  const int n_cell = _cell_state_in->getShape().dim(1);
+
+  // Optional outputs
+  float *output_state_buf = getOptionalOutputBuffer<float>(_output_state, &_output_state_vec,
+                                                           _output_state_in->total_size());
+  float *cell_state_buf =
+    getOptionalOutputBuffer<float>(_cell_state, &_cell_state_vec, _cell_state_in->total_size());
+
+  initializeStateBuffer(_output_state_in, output_state_buf, _has_output_state_data);
+  initializeStateBuffer(_cell_state_in, cell_state_buf, _has_cell_state_data);
+
+  nnfw::cker::LSTMParams lstm_params;
+  lstm_params.activation = convertActivationType(_params.activation);
+  lstm_params.cell_clip = _params.cell_threshold;
+  lstm_params.proj_clip = _params.projection_threshold;
+
+  const float *projection_bias_ptr =
+    hasData(_projection_bias) ? getBuffer<float>(_projection_bias) : nullptr;
+  auto out_shape = _output->getShape();
+  const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
+  auto ruy_context = _external_context->ruy_context();
+  auto &fused_lstm = *_fused_lstm;
+  auto step = [&](const float *input_ptr, int batches, float *output_state_ptr,
+                  float *cell_state_ptr, float *output_ptr) {
+    fused_lstm(lstm_params, input_ptr, _cell_to_input_weights_ptr, _cell_to_forget_weights_ptr,
+               _cell_to_output_weights_ptr, _projection_weights_ptr, projection_bias_ptr, batches,
+               output_batch_leading_dim, output_state_ptr, cell_state_ptr, output_ptr,
+               ruy_context);
+  };
+
+  if (_time_major)
+  {
+    // Loop through the sequence, all batches are computed together in a step
+    const int input_step = n_batch * n_input;
+    const int output_step = n_batch * output_batch_leading_dim;
+    for (int t = 0; t < max_time; t++)
+    {
+      const int t_rel = _forward_sequence ? t : max_time - t - 1;
+      const float *input_ptr = getBuffer<float>(_input) + t_rel * input_step;
+      float *output_ptr = getBuffer<float>(_output) + t_rel * output_step + _output_offset;
+      step(input_ptr, n_batch, output_state_buf, cell_state_buf, output_ptr);
+    }
+  }
+  else
+  {
+    for (int b = 0; b < n_batch; b++)
+    {
+      for (int t = 0; t < max_time; t++)
+      {
+        const int t_rel = _forward_sequence ? t : max_time - t - 1;
+        const int time_offset = b * max_time + t_rel;
+        const float *input_ptr = getBuffer<float>(_input) + time_offset * n_input;
+        float *output_ptr =
+          getBuffer<float>(_output) + time_offset * output_batch_leading_dim + _output_offset;
+        step(input_ptr, 1, output_state_buf + b * output_batch_leading_dim,
+             cell_state_buf + b * n_cell, output_ptr);
+      }
+    }
+  }
+}
+
 void LSTMLayer::configure(
   const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
   const IPortableTensor *input_to_forget_weights, const IPortableTensor *input_to_cell_weights,
@@ -259,7 +375,8 @@ void LSTMLayer::configure(
   const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
   bool forward_sequence, bool time_major, int output_offset, IPortableTensor *scratch_buffer,
   IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-  bool has_output_state_data, bool has_cell_state_data)
+  bool has_output_state_data, bool has_cell_state_data,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _input_to_input_weights = input_to_input_weights;
@@ -298,12 +415,89 @@ void LSTMLayer::configure(
   _output = output;
   _has_output_state_data = has_output_state_data;
   _has_cell_state_data = has_cell_state_data;
+  _external_context = external_context;
+  _use_fused_lstm = canUseFusedLSTM();
+
+  const bool is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
+                         _input_to_forget_weights->data_type() == OperandType::QUANT_INT8_SYMM;
+  if (is_hybrid && !_use_fused_lstm)
+    throw std::runtime_error{"LSTMLayer: hybrid LSTM with layer normalization is not supported"};
+}
+
+bool LSTMLayer::canUseFusedLSTM() const
+{
+  // Layer normalization needs statistics over all cells of a gate, so cells cannot be updated
+  // block by block
+  return _input->data_type() == OperandType::FLOAT32 && !hasData(_aux_input) &&
+         !hasData(_input_layer_norm_coefficients) && !hasData(_forget_layer_norm_coefficients) &&
+         !hasData(_cell_layer_norm_coefficients) && !hasData(_output_layer_norm_coefficients);
+}
+
+void LSTMLayer::packWeights()
+{
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_input = _input_to_output_weights->getShape().dim(1);
+  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
+
+  // {input, forget, cell, output} gates, input gate does not exist with CIFG
+  const IPortableTensor *input_weights[4] = {_input_to_input_weights, _input_to_forget_weights,
+                                             _input_to_cell_weights, _input_to_output_weights};
+  const IPortableTensor *recurrent_weights[4] = {
+    _recurrent_to_input_weights, _recurrent_to_forget_weights, _recurrent_to_cell_weights,
+    _recurrent_to_output_weights};
+  const IPortableTensor *gate_biases[4] = {_input_gate_bias, _forget_gate_bias, _cell_gate_bias,
+                                           _output_gate_bias};
+
+  const float *bias_ptrs[4];
+  for (int g = 0; g < 4; ++g)
+    bias_ptrs[g] = hasData(gate_biases[g]) ? getBuffer<float>(gate_biases[g]) : nullptr;
+
+  if (_input_to_forget_weights->data_type() == OperandType::QUANT_INT8_SYMM)
+  {
+    const int8_t *input_weight_ptrs[4];
+    const int8_t *recurrent_weight_ptrs[4];
+    float input_scales[4];
+    float recurrent_scales[4];
+    for (int g = 0; g < 4; ++g)
+    {
+      const bool exists = hasData(input_weights[g]);
+      input_weight_ptrs[g] = exists ? getBuffer<int8_t>(input_weights[g]) : nullptr;
+      recurrent_weight_ptrs[g] = exists ? getBuffer<int8_t>(recurrent_weights[g]) : nullptr;
+      input_scales[g] = exists ? input_weights[g]->data_scale() : 0.f;
+      recurrent_scales[g] = exists ? recurrent_weights[g]->data_scale() : 0.f;
+    }
+    _fused_lstm->prepare(input_weight_ptrs, input_scales, recurrent_weight_ptrs, recurrent_scales,
+                         bias_ptrs, n_cell, n_input, n_output);
+  }
+  else
+  {
+    const float *input_weight_ptrs[4];
+    const float *recurrent_weight_ptrs[4];
+    for (int g = 0; g < 4; ++g)
+    {
+      const bool exists = hasData(input_weights[g]);
+      input_weight_ptrs[g] = exists ? getBuffer<float>(input_weights[g]) : nullptr;
+      recurrent_weight_ptrs[g] = exists ? getBuffer<float>(recurrent_weights[g]) : nullptr;
+    }
+    _fused_lstm->prepare(input_weight_ptrs, recurrent_weight_ptrs, bias_ptrs, n_cell, n_input,
+                         n_output);
+  }
+
+  _cell_to_input_weights_ptr = getFloatWeights(_cell_to_input_weights, &_dequantized_weights[0]);
+  _cell_to_forget_weights_ptr = getFloatWeights(_cell_to_forget_weights, &_dequantized_weights[1]);
+  _cell_to_output_weights_ptr = getFloatWeights(_cell_to_output_weights, &_dequantized_weights[2]);
+  _projection_weights_ptr = getFloatWeights(_projection_weights, &_dequantized_weights[3]);
 }
 
 void LSTMLayer::run()
 {
+  prepare();
 
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_use_fused_lstm)
+  {
+    LSTMFused();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     LSTMFloat();
   }
@@ -313,6 +507,35 @@ void LSTMLayer::run()
   }
 }
 
+void LSTMLayer::prepare()
+{
+  if (_is_weights_packed || !_use_fused_lstm)
+    return;
+
+  const IPortableTensor *gate_weights[8] = {
+    _input_to_input_weights,    _input_to_forget_weights,     _input_to_cell_weights,
+    _input_to_output_weights,   _recurrent_to_input_weights,  _recurrent_to_forget_weights,
+    _recurrent_to_cell_weights, _recurrent_to_output_weights};
+  for (auto weights : gate_weights)
+  {
+    // Non-constant weights are packed on every run
+    if (hasData(weights) && !weights->is_constant())
+      return;
+  }
+
+  packWeights();
+  _is_weights_packed = true;
+
+  // Decrease reference of gate weights which are not used anymore
+  for (auto weights : gate_weights)
+  {
+    auto weights_tensor = dynamic_cast<const Tensor *>(weights);
+    if (weights_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(weights_tensor)->decrease_ref();
+  }
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -18,17 +18,21 @@
 #define __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 #include <ir/InternalType.h>
 #include <ir/operation/LSTM.h>
 #include <exec/IFunction.h>
 
+#include <memory>
+
 namespace nnfw
 {
 namespace cker
 {
 class FCTempArena;
-}
+class FusedLSTM;
+} // namespace cker
 } // namespace nnfw
 
 namespace onert
@@ -44,11 +48,14 @@ namespace ops
 class LSTMLayer : public ::onert::exec::IFunction
 {
 public:
-  LSTMLayer() = default;
+  LSTMLayer();
+  ~LSTMLayer();
 
 public:
   void LSTMFloat();
 
+  void LSTMFused();
+
   void configure(
     const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
     const IPortableTensor *input_to_forget_weights, const IPortableTensor *input_to_cell_weights,
@@ -72,11 +79,17 @@ public:
     const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
     bool forward_sequence, bool time_major, int32_t output_offset, IPortableTensor *scratch_buffer,
     IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-    bool has_output_state_data, bool has_cell_state_data);
+    bool has_output_state_data, bool has_cell_state_data,
+    const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+  void prepare() override;
+
 private:
+  bool canUseFusedLSTM() const;
+  void packWeights();
+
   const IPortableTensor *_input{nullptr};
   const IPortableTensor *_input_to_input_weights{nullptr};
   const IPortableTensor *_input_to_forget_weights{nullptr};
@@ -119,6 +132,17 @@ private:
   int32_t _output_offset{0};
   bool _has_output_state_data{false};
   bool _has_cell_state_data{false};
+  std::shared_ptr<ExternalContext> _external_context{nullptr};
+  // Gate weights packed by prepare, which is used instead of LstmStepFloat if possible
+  std::unique_ptr<nnfw::cker::FusedLSTM> _fused_lstm{nullptr};
+  bool _use_fused_lstm{false};
+  bool _is_weights_packed{false};
+  // Peephole and projection weights for fused LSTM, dequantized if hybrid
+  const float *_cell_to_input_weights_ptr{nullptr};
+  const float *_cell_to_forget_weights_ptr{nullptr};
+  const float *_cell_to_output_weights_ptr{nullptr};
+  const float *_projection_weights_ptr{nullptr};
+  std::vector<float> _dequantized_weights[4];
 };
 
 } // namespace ops
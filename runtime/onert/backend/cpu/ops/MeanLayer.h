@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_MEANLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_MEANLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -38,10 +40,10 @@ public:
 public:
   void MeanFloat32();
 
-  void MeanQuant8();
+  template <typename T> void MeanQuant8();
 
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 bool keep_dims);
+                 bool keep_dims, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -50,6 +52,7 @@ private:
   const IPortableTensor *_axes;
   IPortableTensor *_output;
   bool _keep_dims;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PReLULayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/PReLU.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+PReLULayer::PReLULayer()
+  : _input(nullptr), _alpha(nullptr), _output(nullptr), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void PReLULayer::configure(const IPortableTensor *input, const IPortableTensor *alpha,
+                           IPortableTensor *output,
+                           const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _alpha = alpha;
+  _output = output;
+  _external_context = external_context;
+}
+
+void PReLULayer::preluQuant8()
+{
+  nnfw::cker::PReLUParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.alpha_offset = -_alpha->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  const double real_multiplier_1 = _input->data_scale() / _output->data_scale();
+  const double real_multiplier_2 =
+    _input->data_scale() * _alpha->data_scale() / _output->data_scale();
+  QuantizeMultiplier(real_multiplier_1, &op_params.output_multiplier_1, &op_params.output_shift_1);
+  QuantizeMultiplier(real_multiplier_2, &op_params.output_multiplier_2, &op_params.output_shift_2);
+
+  nnfw::cker::PReLU(op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_alpha),
+                    getBuffer<uint8_t>(_alpha), getShape(_output), getBuffer<uint8_t>(_output));
+}
+
+void PReLULayer::run()
+{
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      nnfw::cker::PReLU(getShape(_input), getBuffer<float>(_input), getShape(_alpha),
+                        getBuffer<float>(_alpha), getShape(_output), getBuffer<float>(_output),
+                        _external_context->ruy_context());
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      preluQuant8();
+      break;
+    default:
+      throw std::runtime_error{"PReLU: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -40,21 +40,24 @@ void PowLayer::powFloat32()
   {
     nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::POW>(
       op_params, getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs), getBuffer<float>(_rhs),
-      getShape(_output), getBuffer<float>(_output));
+      getShape(_output), getBuffer<float>(_output), _external_context->ruy_context());
     return;
   }
 
   nnfw::cker::powImpl(getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
-                      getBuffer<float>(_rhs), getShape(_output), getBuffer<float>(_output));
+                      getBuffer<float>(_rhs), getShape(_output), getBuffer<float>(_output),
+                      _external_context->ruy_context());
 }
 
 void PowLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
-                         ir::Activation activation, IPortableTensor *output)
+                         ir::Activation activation, IPortableTensor *output,
+                         const std::shared_ptr<ExternalContext> &external_context)
 {
   _lhs = lhs;
   _rhs = rhs;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
 }
 
 void PowLayer::run()
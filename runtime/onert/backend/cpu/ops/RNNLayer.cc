@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+RNNLayer::RNNLayer()
+  : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+    _hidden_state_in(nullptr), _activation(ir::Activation::NONE), _output(nullptr),
+    _hidden_state_out(nullptr), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void RNNLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
+                         const IPortableTensor *recurrent_weights, const IPortableTensor *bias,
+                         const IPortableTensor *hidden_state_in, ir::Activation activation,
+                         IPortableTensor *output, IPortableTensor *hidden_state_out,
+                         const std::shared_ptr<ExternalContext> &external_context)
+{
+  // Hybrid RNN with quantized weights is not supported
+  for (const auto tensor : std::initializer_list<const IPortableTensor *>{
+         input, weights, recurrent_weights, bias, hidden_state_in, output, hidden_state_out})
+  {
+    if (tensor->data_type() != OperandType::FLOAT32)
+      throw std::runtime_error{"RNN: unsupported data type"};
+  }
+
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+  _external_context = external_context;
+}
+
+void RNNLayer::run()
+{
+  nnfw::cker::RNN(convertActivationType(_activation), getShape(_input), getBuffer<float>(_input),
+                  getShape(_weights), getBuffer<float>(_weights), getShape(_recurrent_weights),
+                  getBuffer<float>(_recurrent_weights), getShape(_bias), getBuffer<float>(_bias),
+                  getShape(_hidden_state_in), getBuffer<float>(_hidden_state_in),
+                  getShape(_output), getBuffer<float>(_output),
+                  getBuffer<float>(_hidden_state_out), _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -18,7 +18,6 @@
 
 #include "OperationUtils.h"
 
-#include "cker/neon/neon_check.h"
 #include <cker/operation/Reduce.h>
 
 namespace onert
@@ -33,15 +32,14 @@ namespace ops
 namespace
 {
 
-template <typename T>
+template <typename T, typename Reducer>
 void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
-               bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ruy::Context *ruy_context)
 {
   reduce_kernel.prepare(input->getShape().rank(), axes.size());
-  bool result =
-    reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input), getShape(output),
-                                   getBuffer<T>(output), axes, keep_dims, init_value, reducer);
+  bool result = reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input),
+                                               getShape(output), getBuffer<T>(output), axes,
+                                               keep_dims, Reducer(), ruy_context);
 
   if (!result)
   {
@@ -51,31 +49,28 @@ void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std:
 
 template <typename T>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+         ruy::Context *ruy_context)
 {
+  using namespace nnfw::cker::reduce;
   switch (reduce_type)
   {
     case ReduceType::kSum:
-      return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(0), reduce_kernel,
-                       [](const T current, const T in) -> T { return in + current; });
+      return std::bind(&evalLogic<T, SumReducer<T>>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
       break;
     case ReduceType::kProd:
-      return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(1), reduce_kernel,
-                       [](const T current, const T in) -> T { return in * current; });
+      return std::bind(&evalLogic<T, ProdReducer<T>>, std::placeholders::_1,
+                       std::placeholders::_2, std::placeholders::_3, keep_dims, reduce_kernel,
+                       ruy_context);
       break;
     case ReduceType::kMax:
-      return std::bind(
-        &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
-        [](const T current, const T in) -> T { return (in > current) ? in : current; });
+      return std::bind(&evalLogic<T, MaxReducer<T>>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
       break;
     case ReduceType::kMin:
-      return std::bind(
-        &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
-        [](const T current, const T in) -> T { return (in < current) ? in : current; });
+      return std::bind(&evalLogic<T, MinReducer<T>>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -85,19 +80,41 @@ evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_ty
 // Template specialization for bool type
 template <>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+               ruy::Context *ruy_context)
 {
+  using namespace nnfw::cker::reduce;
   switch (reduce_type)
   {
     case ReduceType::kAny:
-      return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, false, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in || current; });
+      return std::bind(&evalLogic<bool, AnyReducer>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
       break;
     case ReduceType::kAll:
-      return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, true, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in && current; });
+      return std::bind(&evalLogic<bool, AllReducer>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
+      break;
+    default:
+      throw std::runtime_error{"Reduce: Unsupported reduce type"};
+  }
+}
+
+// Max and min of quantized values, which keep the quantization parameters of input
+template <typename T>
+std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
+evalTypeQuantized(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+                  ruy::Context *ruy_context)
+{
+  using namespace nnfw::cker::reduce;
+  switch (reduce_type)
+  {
+    case ReduceType::kMax:
+      return std::bind(&evalLogic<T, MaxReducer<T>>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
+      break;
+    case ReduceType::kMin:
+      return std::bind(&evalLogic<T, MinReducer<T>>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, keep_dims, reduce_kernel, ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -106,60 +123,56 @@ evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType red
 
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
 generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+                      ruy::Context *ruy_context)
 {
   switch (input->data_type())
   {
     case OperandType::FLOAT32:
-      return evalType<float>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<float>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     case OperandType::INT32:
-      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     case OperandType::BOOL8:
-      return evalType<bool>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<bool>(keep_dims, reduce_kernel, reduce_type, ruy_context);
+    case OperandType::QUANT_UINT8_ASYMM:
+      return evalTypeQuantized<uint8_t>(keep_dims, reduce_kernel, reduce_type, ruy_context);
+    case OperandType::QUANT_INT8_ASYMM:
+      return evalTypeQuantized<int8_t>(keep_dims, reduce_kernel, reduce_type, ruy_context);
     default:
       throw std::runtime_error{"Reduce(generic): unsupported data type"};
   }
 }
 
 // TODO Refine this function
+template <typename T>
 void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
                       const std::vector<int> &axes, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel)
+                      nnfw::cker::Reduce &reduce_kernel, ruy::Context *ruy_context)
 {
-  const bool same_scale = (input->data_scale() == output->data_scale() &&
-                           input->data_zero_point() == output->data_zero_point());
-
   reduce_kernel.prepare(input->getShape().rank(), axes.size());
 
-  if (!same_scale)
+  std::vector<int32_t> temp_sum(output->getShape().num_elements());
+  bool result = reduce_kernel.QuantizedMeanOrSum<T, int32_t>(
+    getBuffer<T>(input), input->data_zero_point(), input->data_scale(), getShape(input),
+    getBuffer<T>(output), output->data_zero_point(), output->data_scale(), getShape(output), axes,
+    keep_dims, temp_sum.data(), true,
+    [](const int32_t current, const T in) -> int32_t {
+      const int32_t actual_in = static_cast<int32_t>(in);
+      return current + actual_in;
+    },
+    ruy_context);
+
+  if (!result)
   {
-    std::vector<int32_t> temp_sum(output->getShape().num_elements());
-    bool result = reduce_kernel.QuantizedMeanOrSum<uint8_t, int32_t>(
-      getBuffer<uint8_t>(input), input->data_zero_point(), input->data_scale(), getShape(input),
-      getBuffer<uint8_t>(output), output->data_zero_point(), output->data_scale(), getShape(output),
-      axes, keep_dims, temp_sum.data(), true,
-      [](const int32_t current, const uint8_t in) -> int32_t {
-        const int32_t actual_in = static_cast<int32_t>(in);
-        return current + actual_in;
-      });
-
-    if (!result)
-    {
-      throw std::runtime_error{"Reduce: Fail to run"};
-    }
-
-    return;
+    throw std::runtime_error{"Reduce: Fail to run"};
   }
-
-  const auto kernel = generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum);
-  kernel(input, output, axes);
 }
 
 } // namespace
 
 ReduceLayer::ReduceLayer()
   : _input(nullptr), _axes(nullptr), _output(nullptr), _reduce_kernel(new nnfw::cker::Reduce()),
-    _kernel(), _reduceType(ReduceType::kInvalid)
+    _kernel(), _reduceType(ReduceType::kInvalid), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -167,38 +180,64 @@ ReduceLayer::ReduceLayer()
 ReduceLayer::~ReduceLayer() = default;
 
 void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                            IPortableTensor *output, ReduceType reduceType, bool keep_dims)
+                            IPortableTensor *output, ReduceType reduceType, bool keep_dims,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _reduceType = reduceType;
+  _external_context = external_context;
+  ruy::Context *ruy_context = _external_context->ruy_context();
+
+  const bool is_quantized = _input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
+                            _input->data_type() == OperandType::QUANT_INT8_ASYMM;
+  if (is_quantized && _reduceType != ReduceType::kSum &&
+      (_input->data_scale() != _output->data_scale() ||
+       _input->data_zero_point() != _output->data_zero_point()))
+  {
+    throw std::runtime_error{"Reduce: quantized input and output must have same quantization"};
+  }
 
   switch (_reduceType)
   {
     case ReduceType::kSum:
       if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
-        _kernel = std::bind(&evalSumQuantized, std::placeholders::_1, std::placeholders::_2,
-                            std::placeholders::_3, keep_dims, *_reduce_kernel);
+        _kernel = std::bind(&evalSumQuantized<uint8_t>, std::placeholders::_1,
+                            std::placeholders::_2, std::placeholders::_3, keep_dims,
+                            *_reduce_kernel, ruy_context);
         return;
       }
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum);
+      if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+      {
+        _kernel = std::bind(&evalSumQuantized<int8_t>, std::placeholders::_1,
+                            std::placeholders::_2, std::placeholders::_3, keep_dims,
+                            *_reduce_kernel, ruy_context);
+        return;
+      }
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum, ruy_context);
       break;
     case ReduceType::kProd:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd, ruy_context);
       break;
     case ReduceType::kMax:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax, ruy_context);
       break;
     case ReduceType::kMin:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin, ruy_context);
       break;
     case ReduceType::kAny:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny, ruy_context);
       break;
     case ReduceType::kAll:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll);
+      _kernel =
+        generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll, ruy_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -208,15 +247,6 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
 void ReduceLayer::run()
 {
   const auto axes = getReducerAxes(_axes);
-#ifdef USE_NEON
-  int32_t rank = _input->getShape().rank();
-  if (_input->data_type() == ir::DataType::FLOAT32 && _reduceType == ReduceType::kSum &&
-      axes.size() == 1 && (axes[0] == -1 || axes[0] == rank - 1))
-  {
-    OptimizedReduceSum(getBuffer<float>(_input), getShape(_input), getBuffer<float>(_output));
-    return;
-  }
-#endif // NEON
   _kernel(_input, _output, axes);
 }
 
@@ -17,7 +17,7 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_REDUCESUMLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_REDUCESUMLAYER_H__
 
-#include "cker/neon/neon_check.h"
+#include "../ExternalContext.h"
 
 #include <backend/IPortableTensor.h>
 
@@ -60,7 +60,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 ReduceType reduceType, bool keep_dims);
+                 ReduceType reduceType, bool keep_dims,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -75,6 +76,7 @@ private:
     _kernel;
 
   ReduceType _reduceType;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
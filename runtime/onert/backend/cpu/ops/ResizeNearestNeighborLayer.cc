@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ResizeNearestNeighborLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/ResizeNearestNeighbor.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+// Each channel of NCHW is resized alone, as a batch of NHWC with one channel
+nnfw::cker::Shape getResizeShape(const IPortableTensor *tensor, ir::Layout layout)
+{
+  auto shape = getShape(tensor);
+  if (layout != ir::Layout::NCHW)
+    return shape;
+  return nnfw::cker::Shape{shape.Dims(0) * shape.Dims(1), shape.Dims(2), shape.Dims(3), 1};
+}
+
+} // namespace
+
+ResizeNearestNeighborLayer::ResizeNearestNeighborLayer()
+  : _input(nullptr), _output(nullptr), _size(nullptr), _output_height(0), _output_width(0),
+    _align_corners(false), _layout(ir::Layout::NHWC), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void ResizeNearestNeighborLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                           const IPortableTensor *size, bool align_corners,
+                                           ir::Layout layout,
+                                           const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(!size->is_constant());
+  _input = input;
+  _output = output;
+  _size = size;
+  _align_corners = align_corners;
+  _layout = layout;
+  _external_context = external_context;
+}
+
+void ResizeNearestNeighborLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                           int32_t output_height, int32_t output_width,
+                                           bool align_corners, ir::Layout layout,
+                                           const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(_size == nullptr);
+  if (output_height < 0 || output_width < 0)
+  {
+    throw std::runtime_error{"ResizeNearestNeighbor: size value must be positive value"};
+  }
+  _input = input;
+  _output = output;
+  _output_height = output_height;
+  _output_width = output_width;
+  _align_corners = align_corners;
+  _layout = layout;
+  _external_context = external_context;
+}
+
+template <typename T>
+void ResizeNearestNeighborLayer::resize(const nnfw::cker::ResizeNearestNeighborParams &params,
+                                        const nnfw::cker::Shape &input_shape,
+                                        const nnfw::cker::Shape &output_shape)
+{
+  nnfw::cker::ResizeNearestNeighbor(params, input_shape, getBuffer<T>(_input), output_shape,
+                                    getBuffer<T>(_output), _external_context->ruy_context());
+}
+
+void ResizeNearestNeighborLayer::run()
+{
+  nnfw::cker::ResizeNearestNeighborParams params;
+  if (_size == nullptr)
+  {
+    params.output_height = _output_height;
+    params.output_width = _output_width;
+  }
+  else
+  {
+    const auto size_buf = getBuffer<int32_t>(_size);
+    params.output_height = size_buf[0];
+    params.output_width = size_buf[1];
+  }
+  params.align_corners = _align_corners;
+  params.half_pixel_centers = false;
+
+  const auto input_shape = getResizeShape(_input, _layout);
+  const auto output_shape = getResizeShape(_output, _layout);
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      resize<float>(params, input_shape, output_shape);
+      break;
+    case OperandType::INT32:
+      resize<int32_t>(params, input_shape, output_shape);
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      resize<uint8_t>(params, input_shape, output_shape);
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      resize<int8_t>(params, input_shape, output_shape);
+      break;
+    default:
+      throw std::runtime_error{"ResizeNearestNeighbor: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __ONERT_BACKEND_CPU_OPS_RESIZENEARESTNEIGHBORLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_RESIZENEARESTNEIGHBORLAYER_H__
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <cker/Shape.h>
+#include <cker/Types.h>
+
+#include <exec/IFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class ResizeNearestNeighborLayer : public ::onert::exec::IFunction
+{
+public:
+  ResizeNearestNeighborLayer();
+
+public:
+  void configure(const IPortableTensor *input, IPortableTensor *output,
+                 const IPortableTensor *size, bool align_corners, ir::Layout layout,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void configure(const IPortableTensor *input, IPortableTensor *output, int32_t output_height,
+                 int32_t output_width, bool align_corners, ir::Layout layout,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+private:
+  template <typename T>
+  void resize(const nnfw::cker::ResizeNearestNeighborParams &params,
+              const nnfw::cker::Shape &input_shape, const nnfw::cker::Shape &output_shape);
+
+private:
+  const IPortableTensor *_input;
+  IPortableTensor *_output;
+  const IPortableTensor *_size;
+  int32_t _output_height;
+  int32_t _output_width;
+  bool _align_corners;
+  ir::Layout _layout;
+
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_RESIZENEARESTNEIGHBORLAYER_H__
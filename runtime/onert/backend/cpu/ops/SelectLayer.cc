@@ -30,34 +30,38 @@ namespace ops
 {
 
 SelectLayer::SelectLayer()
-  : _cond(nullptr), _input_true(nullptr), _input_false(nullptr), _output(nullptr)
+  : _cond(nullptr), _input_true(nullptr), _input_false(nullptr), _output(nullptr),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void SelectLayer::configure(const IPortableTensor *cond, const IPortableTensor *input_true,
-                            const IPortableTensor *input_false, IPortableTensor *output)
+                            const IPortableTensor *input_false, IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _cond = cond;
   _input_true = input_true;
   _input_false = input_false;
   _output = output;
+  _external_context = external_context;
 }
 
 void SelectLayer::run()
 {
 
-#define KERNEL_SELECT(type, op)                                                     \
-  nnfw::cker::op(getShape(_cond), getBuffer<uint8_t>(_cond), getShape(_input_true), \
-                 getBuffer<type>(_input_true), getShape(_input_false),              \
-                 getBuffer<type>(_input_false), getShape(_output), getBuffer<type>(_output));
+#define KERNEL_SELECT(type, op, ...)                                                         \
+  nnfw::cker::op(getShape(_cond), getBuffer<uint8_t>(_cond), getShape(_input_true),          \
+                 getBuffer<type>(_input_true), getShape(_input_false),                       \
+                 getBuffer<type>(_input_false), getShape(_output), getBuffer<type>(_output), \
+                 ##__VA_ARGS__);
 
-#define KERNEL_SWITCH(type, op)                                  \
+#define KERNEL_SWITCH(type, op, ...)                             \
   switch (type)                                                  \
   {                                                              \
     break;                                                       \
     case OperandType::FLOAT32:                                   \
-      KERNEL_SELECT(float, op);                                  \
+      KERNEL_SELECT(float, op, ##__VA_ARGS__);                   \
       break;                                                     \
     default:                                                     \
       throw std::runtime_error{"Select: unsupported data type"}; \
@@ -74,11 +78,11 @@ void SelectLayer::run()
   }
   else if (require_broadcast)
   {
-    KERNEL_SWITCH(input_type, BroadcastSelect4DSlow);
+    KERNEL_SWITCH(input_type, BroadcastSelect4DSlow, _external_context->ruy_context());
   }
   else
   {
-    KERNEL_SWITCH(input_type, Select);
+    KERNEL_SWITCH(input_type, Select, _external_context->ruy_context());
   }
 }
 
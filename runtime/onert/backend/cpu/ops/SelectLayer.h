@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_SELECT_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -37,7 +38,8 @@ public:
 
 public:
   void configure(const IPortableTensor *cond, const IPortableTensor *input_true,
-                 const IPortableTensor *input_false, IPortableTensor *output);
+                 const IPortableTensor *input_false, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -46,6 +48,8 @@ private:
   const IPortableTensor *_input_true;
   const IPortableTensor *_input_false;
   IPortableTensor *_output;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
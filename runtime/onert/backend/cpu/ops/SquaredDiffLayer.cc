@@ -29,7 +29,8 @@ namespace cpu
 namespace ops
 {
 
-SqDiffLayer::SqDiffLayer() : _input1(nullptr), _input2(nullptr), _output(nullptr)
+SqDiffLayer::SqDiffLayer()
+  : _input1(nullptr), _input2(nullptr), _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -37,15 +38,18 @@ SqDiffLayer::SqDiffLayer() : _input1(nullptr), _input2(nullptr), _output(nullptr
 void SqDiffLayer::SqDiffFloat32()
 {
   nnfw::cker::SqDiff(getShape(_input1), getBuffer<float>(_input1), getShape(_input2),
-                     getBuffer<float>(_input2), getShape(_output), getBuffer<float>(_output));
+                     getBuffer<float>(_input2), getShape(_output), getBuffer<float>(_output),
+                     _external_context->ruy_context());
 }
 
 void SqDiffLayer::configure(const IPortableTensor *input1, const IPortableTensor *input2,
-                            IPortableTensor *output)
+                            IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input1 = input1;
   _input2 = input2;
   _output = output;
+  _external_context = external_context;
 }
 
 void SqDiffLayer::run()
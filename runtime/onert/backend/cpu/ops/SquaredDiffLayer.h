@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_SQDIFFLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -39,7 +40,7 @@ public:
   void SqDiffFloat32();
 
   void configure(const IPortableTensor *input1, const IPortableTensor *input2,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -47,6 +48,8 @@ private:
   const IPortableTensor *_input1;
   const IPortableTensor *_input2;
   IPortableTensor *_output;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
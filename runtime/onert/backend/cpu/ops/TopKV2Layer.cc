@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TopKV2Layer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/TopKV2.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TopKV2Layer::TopKV2Layer()
+  : _input(nullptr), _k(0), _values(nullptr), _indices(nullptr), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void TopKV2Layer::configure(const IPortableTensor *input, int32_t k, IPortableTensor *values,
+                            IPortableTensor *indices,
+                            const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _k = k;
+  _values = values;
+  _indices = indices;
+  _external_context = external_context;
+}
+
+template <typename T> void TopKV2Layer::topKV2()
+{
+  nnfw::cker::TopKV2(getShape(_input), getBuffer<T>(_input), _k, getShape(_values),
+                     getBuffer<T>(_values), getBuffer<int32_t>(_indices),
+                     _external_context->ruy_context());
+}
+
+void TopKV2Layer::run()
+{
+  const auto rank = _input->getShape().rank();
+  if (rank < 1 || _k < 0 || _k > _input->getShape().dim(rank - 1))
+    throw std::runtime_error{"TopKV2: k is out of range"};
+
+  if (_indices->data_type() != OperandType::INT32)
+    throw std::runtime_error{"TopKV2: unsupported indices type"};
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      topKV2<float>();
+      break;
+    case OperandType::INT32:
+      topKV2<int32_t>();
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      topKV2<uint8_t>();
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      topKV2<int8_t>();
+      break;
+    default:
+      throw std::runtime_error{"TopKV2: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -22,6 +22,9 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include "IMemoryPlanner.h"
+
+#include <cstdlib>
 #include <memory>
 
 namespace onert
@@ -37,7 +40,15 @@ namespace basic
 class Allocator
 {
 public:
-  Allocator(uint32_t capacity);
+  /**
+   * @brief Construct a new Allocator object
+   * @param[in] capacity Size of memory in bytes
+   * @param[in] alignment Alignment of base pointer in bytes, which is a power of 2
+   * @param[in] use_huge_pages Whether to advise the kernel to back memory with transparent huge
+   *                           pages, which is ignored on systems without them
+   */
+  Allocator(uint64_t capacity, size_t alignment = IMemoryPlanner::kDefaultAlignment,
+            bool use_huge_pages = false);
   /**
    * @brief Get memory base pointer
    * @return base pointer
@@ -46,7 +57,12 @@ public:
   void release() { _base.reset(); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  struct Deleter
+  {
+    void operator()(uint8_t *ptr) const { std::free(ptr); }
+  };
+
+  std::unique_ptr<uint8_t[], Deleter> _base;
 };
 
 } // namespace basic
@@ -19,6 +19,8 @@
 
 #include "ir/OperandIndexMap.h"
 
+#include <cstdint>
+
 namespace onert
 {
 namespace backend
@@ -31,7 +33,7 @@ namespace basic
  */
 struct Block
 {
-  uint32_t offset;
+  uint64_t offset;
   size_t size;
 };
 
@@ -42,6 +44,11 @@ struct IMemoryPlanner
 {
   using MemoryPlans = ir::OperandIndexMap<Block>;
 
+  /**
+   * @brief Default alignment of planned offsets, which is a cache line and fits SIMD registers
+   */
+  static constexpr size_t kDefaultAlignment = 64;
+
   /**
    * @brief Claim memory for operand
    * @param[in] index The operand index
@@ -57,7 +64,7 @@ struct IMemoryPlanner
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  virtual uint32_t capacity() = 0;
+  virtual uint64_t capacity() = 0;
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -41,7 +41,7 @@ public:
   uint8_t *getBuffer(const ir::OperandIndex &ind) const;
   void deallocate(void) { _mem_alloc->release(); }
 
-  void claimPlan(const ir::OperandIndex &ind, uint32_t size);
+  void claimPlan(const ir::OperandIndex &ind, size_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
 private:
@@ -50,6 +50,8 @@ private:
 
 private:
   ir::OperandIndexMap<Block> _tensor_mem_map;
+  size_t _alignment;
+  bool _use_huge_pages;
   std::shared_ptr<IMemoryPlanner> _mem_planner;
   std::shared_ptr<Allocator> _mem_alloc;
 };
@@ -60,7 +62,7 @@ public:
   DynamicMemoryManager() = default;
   virtual ~DynamicMemoryManager() = default;
 
-  std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
+  std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint64_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
@@ -46,7 +46,7 @@ public:
   void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info,
                    ir::Layout backend_layout, bool as_const);
 
-  void claimPlan(const ir::OperandIndex &ind, uint32_t size);
+  void claimPlan(const ir::OperandIndex &ind, size_t size);
   void releasePlan(const ir::OperandIndex &ind);
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
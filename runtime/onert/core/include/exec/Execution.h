@@ -24,16 +24,40 @@
 #include "ir/Layout.h"
 #include "exec/IExecutor.h"
 #include "IODescription.h"
+#include "PipelineQueue.h"
 
-#include <thread>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
-#include <semaphore.h>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Counters of a pipeline stage
+ */
+struct PipelineStats
+{
+  uint64_t num_runs = 0;
+  // Time to run executor, in microseconds
+  uint64_t total_run_us = 0;
+  uint64_t max_run_us = 0;
+  // Time from when all inputs of a record are set to when its run starts, in microseconds
+  uint64_t total_wait_us = 0;
+  uint64_t max_wait_us = 0;
+  // Records ready to be run, now and at most
+  size_t ready_records = 0;
+  size_t peak_ready_records = 0;
+  // Number of records of the stage
+  size_t capacity = 0;
+};
+
 /**
  * @brief Class to define execution instance to collect input/output information for inference
  *        and prepare executor run (TODO)
@@ -48,6 +72,19 @@ public:
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
 
+  /**
+   * @brief Destroy the Execution object
+   * @note  It waits until all submitted inferences are finished
+   */
+  ~Execution();
+
+public:
+  /**
+   * @brief Callback called when a submitted inference is finished
+   * @note  Argument is the exception thrown during the inference, or nullptr if succeeded
+   */
+  using Completion = std::function<void(std::exception_ptr)>;
+
 public:
   /**
    * @brief   Returns primary graph object
@@ -126,7 +163,7 @@ public:
 
   /**
    * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
+   * @note  It returns after execution is queued to runtime thread pool
    *        It should be called after setting input and output buffer
    */
   void startExecute(void);
@@ -137,6 +174,28 @@ public:
    */
   void waitFinish(void);
 
+  /**
+   * @brief     Create IO description of an inference to be submitted
+   * @param[in] inputs          Input buffers, in order of input index
+   * @param[in] input_lengths   Lengths of input buffers
+   * @param[in] outputs         Output buffers, in order of output index
+   * @param[in] output_lengths  Lengths of output buffers
+   * @return    IO description with input shapes changed by changeInputShape
+   */
+  std::unique_ptr<IODescription> createIODescription(const std::vector<const void *> &inputs,
+                                                     const std::vector<size_t> &input_lengths,
+                                                     const std::vector<void *> &outputs,
+                                                     const std::vector<size_t> &output_lengths);
+
+  /**
+   * @brief     Submit an inference to be run on runtime thread pool
+   * @param[in] io_desc     IO description of the inference
+   * @param[in] completion  Called on a pool thread when the inference is finished
+   * @note      Inferences of an execution run one by one in order of submission,
+   *            so many inferences can be in flight without an executor run concurrently
+   */
+  void submit(std::unique_ptr<IODescription> io_desc, const Completion &completion);
+
   /**
    * @brief   Check execution is finished
    * @return  @c true if execution is finished, otherwise @c false
@@ -150,16 +209,6 @@ public:
   // Experimental API
   //
 
-  // accessor
-  std::vector<
-    std::tuple<std::shared_ptr<onert::exec::Execution>, onert::ir::IOIndex, onert::ir::IOIndex>>
-  getNextExes()
-  {
-    return next_exes;
-  }
-  std::deque<std::pair<IODescription *, uint32_t>> *getAsyncIoDescs() { return &_async_io_descs; }
-  std::deque<std::vector<void *>> *getAsyncResults() { return &_async_results; }
-
   /**
    * @brief     Push IO information between related executions into next_exes
    * @param[in] next   address of next execution
@@ -173,74 +222,61 @@ public:
   }
 
   /**
-   * @brief     Create New IODescription instance for new inputs outputs
-   * @param[in] index   instance count number
+   * @brief     Prepare this execution as a pipeline stage, allocating IO buffers of all records
+   *            in advance
+   * @param[in] capacity       Number of records which can be in flight at this stage
+   * @param[in] num_producers  Number of previous stages (or user) which set inputs of this stage
+   * @param[in] is_output      Whether outputs of this stage are results of pipeline
    */
-  void createNewAsyncDesc(uint32_t count = 0);
+  void preparePipeline(uint32_t capacity, uint32_t num_producers, bool is_output);
 
   /**
-   * @brief     Set async input data's information
+   * @brief     Set an input of the record of an inference
+   * @param[in] count   Inference count number
    * @param[in] index   Input index
-   * @param[in] buffer  Input data's buffer pointer
+   * @param[in] buffer  Input data's buffer pointer, which is copied
    * @param[in] length  Input data's length
-   * @param[in] layout  Input data's data format
+   * @note      It blocks while all records of this stage are in flight
+   *            It throws if the pipeline is aborted
    */
-  void executeAsyncInput(const ir::IOIndex &index, const void *buffer, size_t length,
-                         ir::Layout layout = ir::Layout::NHWC);
+  void pushPipelineInput(uint32_t count, const ir::IOIndex &index, const void *buffer,
+                         size_t length);
 
   /**
-   * @brief     Set async output data's information
-   * @param[in] index   Output index
-   * @param[in] buffer  Output data's buffer pointer
-   * @param[in] length  Output data's length
-   * @param[in] layout  Output data's data format
-   */
-  void executeAsyncOutput(const ir::IOIndex &index, void *buffer, size_t length,
-                          ir::Layout layout = ir::Layout::NHWC);
-
-  /**
-   * @brief  Async execution
-   * @note   It should be called after setting input and output buffer
-   */
-  void AsyncExecute();
-
-  /**
-   * @brief   Set finish
-   */
-  void setFinish();
-
-  /**
-   * @brief   Check if input queue is empty
-   * @return  @c true if queue is empty, otherwise @c false
-   */
-  bool isEmptyQueue();
-
-  /**
-   * @brief   Wait semaphore to prevent race condition
+   * @brief Notify a producer will not set inputs anymore
+   * @note  When all producers are finished, this stage finishes after running remaining records
    */
-  void asyncIoDescSemWait();
+  void finishPipelineInput();
 
   /**
-   * @brief   Post semaphore to prevent race condition
+   * @brief Stop this stage without running remaining records, waking up all waiting threads
    */
-  void asyncIoDescSemPost();
+  void abortPipeline();
 
   /**
    * @brief   Inference
    * @note    this function provided to the thread for pipelining
+   *          It returns when this stage is finished or aborted
    */
   void runInference();
 
   /**
-   * @brief   Check if stop_wait is true
-   * @return  @c true if stop_wait is true, otherwise @c false
+   * @brief      Pop results of an inference, blocking until they are ready
+   * @param[out] outputs  Output buffers allocated by malloc, which should be freed by caller
+   * @return     @c false if the pipeline is finished and no result is left, otherwise @c true
    */
-  bool stopWait(void) const;
+  bool popPipelineOutput(std::vector<void *> &outputs);
 
   /**
-   * @brief   Set stop_wait to terminate consumer thread
+   * @brief      Pop results of an inference, blocking until they are ready or timeout
+   * @return     @c false if timed out or no result is left, otherwise @c true
    */
-  void sholudStop();
+  bool popPipelineOutput(std::vector<void *> &outputs, std::chrono::milliseconds timeout);
+
+  /**
+   * @brief   Return counters of this pipeline stage
+   */
+  PipelineStats pipelineStats() const;
 
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
@@ -249,18 +285,59 @@ private:
   };
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
 
+  struct AsyncRequest
+  {
+    IODescription *io_desc;
+    // Set if io_desc is owned by request
+    std::unique_ptr<IODescription> owned_io_desc;
+    Completion completion;
+  };
+
+  void enqueueRequest(AsyncRequest &&request);
+  void runRequests();
+
+  struct PipelineRecord
+  {
+    // Inference count number
+    uint32_t count;
+    uint32_t num_inputs_set;
+    std::chrono::steady_clock::time_point ready_time;
+    std::vector<std::vector<uint8_t>> input_buffers;
+    std::vector<std::vector<uint8_t>> output_buffers;
+    IODescription io_desc;
+  };
+
+  void runPipelineRecord(PipelineRecord *record);
+
 private:
   const std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
-  std::deque<std::pair<IODescription *, uint32_t>> _async_io_descs;
-  sem_t _async_io_descs_sem;
-  std::deque<std::vector<void *>> _async_results;
   std::vector<
     std::tuple<std::shared_ptr<onert::exec::Execution>, onert::ir::IOIndex, onert::ir::IOIndex>>
     next_exes;
-  std::unique_ptr<std::thread> _exec_thread;
+  // Serializes runs of executor
+  std::mutex _exec_mutex;
+  // Requests to be run on runtime thread pool, and whether a pool thread is running them
+  std::mutex _async_mutex;
+  std::condition_variable _async_cv;
+  std::deque<AsyncRequest> _async_requests;
+  bool _async_running{false};
+  // State of startExecute/waitFinish
+  bool _async_done{false};
+  std::exception_ptr _async_error;
   bool finished{false};
-  bool stop_wait{false};
+  // Records of pipeline stage, all allocated in preparePipeline
+  std::vector<std::unique_ptr<PipelineRecord>> _pipeline_records;
+  std::unique_ptr<PipelineQueue<PipelineRecord *>> _free_records;
+  std::unique_ptr<PipelineQueue<PipelineRecord *>> _ready_records;
+  // Set only for the output stage
+  std::unique_ptr<PipelineQueue<std::vector<void *>>> _pipeline_results;
+  // Records some of whose inputs are set, by inference count number
+  std::mutex _pending_mutex;
+  std::map<uint32_t, PipelineRecord *> _pending_records;
+  uint32_t _num_producers{0};
+  mutable std::mutex _stats_mutex;
+  PipelineStats _stats;
 };
 
 } // namespace exec
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PipelineQueue.h
+ * @brief This file defines bounded blocking queue between pipeline stages
+ */
+#ifndef __ONERT_EXEC_PIPELINE_QUEUE_H__
+#define __ONERT_EXEC_PIPELINE_QUEUE_H__
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Bounded queue for multiple producers and consumers
+ *
+ * push blocks while the queue is full, so a fast producer waits for slow consumers instead of
+ * growing memory. pop blocks while the queue is empty.
+ * After close, push fails and pop fails once the queue becomes empty.
+ */
+template <typename T> class PipelineQueue
+{
+public:
+  /**
+   * @brief     Construct a new PipelineQueue object
+   * @param[in] capacity  Maximum number of items in the queue
+   */
+  explicit PipelineQueue(size_t capacity) : _capacity{capacity} { assert(capacity > 0); }
+
+public:
+  /**
+   * @brief   Push item, blocking while the queue is full
+   * @return  @c false if the queue is closed, otherwise @c true
+   */
+  bool push(T item)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _not_full.wait(lock, [this] { return _closed || _items.size() < _capacity; });
+      if (_closed)
+        return false;
+
+      _items.push_back(std::move(item));
+      _peak_size = std::max(_peak_size, _items.size());
+    }
+    _not_empty.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief   Pop item, blocking while the queue is empty
+   * @return  @c false if the queue is closed and empty, otherwise @c true
+   */
+  bool pop(T &item)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _not_empty.wait(lock, [this] { return _closed || !_items.empty(); });
+      if (_items.empty())
+        return false;
+
+      item = std::move(_items.front());
+      _items.pop_front();
+    }
+    _not_full.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief   Pop item, blocking while the queue is empty until timeout
+   * @return  @c false if timed out or the queue is closed and empty, otherwise @c true
+   */
+  template <typename Rep, typename Period>
+  bool pop(T &item, const std::chrono::duration<Rep, Period> &timeout)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      if (!_not_empty.wait_for(lock, timeout, [this] { return _closed || !_items.empty(); }))
+        return false;
+      if (_items.empty())
+        return false;
+
+      item = std::move(_items.front());
+      _items.pop_front();
+    }
+    _not_full.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Close the queue, waking up all waiting threads
+   */
+  void close()
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _closed = true;
+    }
+    _not_full.notify_all();
+    _not_empty.notify_all();
+  }
+
+  bool closed() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _closed;
+  }
+
+  size_t size() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _items.size();
+  }
+
+  /**
+   * @brief Return the largest number of items the queue has had
+   */
+  size_t peakSize() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _peak_size;
+  }
+
+  size_t capacity() const { return _capacity; }
+
+private:
+  const size_t _capacity;
+  mutable std::mutex _mutex;
+  std::condition_variable _not_full;
+  std::condition_variable _not_empty;
+  std::deque<T> _items;
+  size_t _peak_size{0};
+  bool _closed{false};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PIPELINE_QUEUE_H__
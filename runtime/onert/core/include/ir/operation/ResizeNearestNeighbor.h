@@ -19,6 +19,7 @@
 
 #include <memory>
 
+#include "ir/Layout.h"
 #include "ir/Operation.h"
 
 namespace onert
@@ -43,6 +44,8 @@ public:
     int32_t height_out;
     int32_t width_out;
     bool align_corners;
+    // Layout of INPUT and output, which is NCHW only from NNAPI
+    Layout layout;
   };
 
 public:
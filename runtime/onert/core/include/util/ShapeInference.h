@@ -100,6 +100,9 @@ template <typename T> ir::Shape inferRangeShape(T start_val, T limit_val, T delt
 ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, const int32_t output_height,
                                    const int32_t output_width);
 
+ir::Shape inferResizeNearestNeighborShape(const ir::Shape &in_shape, const int32_t output_height,
+                                          const int32_t output_width, const ir::Layout layout);
+
 ir::Shape inferSelectShape(const ir::Shape &input_cond_shape, const ir::Shape &input_true_shape,
                            const ir::Shape &input_false_shape);
 
@@ -141,6 +144,8 @@ ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSlic
 ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_buf,
                          const int32_t multiplier_size);
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k);
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t rank);
 
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_WEIGHT_CACHE_H__
+#define __ONERT_UTIL_WEIGHT_CACHE_H__
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Process-wide cache of constant weights, which sessions of the same model share
+ *
+ * Entries are weak references, so a weight lives while any session holds it and is freed with
+ * the last one.
+ */
+class WeightCache
+{
+public:
+  /**
+   * @brief Key of a cached weight
+   */
+  struct Key
+  {
+    /**
+     * @brief Identity of the model file
+     */
+    std::string origin;
+    /**
+     * @brief Buffer index in the model file
+     */
+    uint32_t index;
+    /**
+     * @brief Kind of transform applied to the weight, or empty for the weight as it is
+     */
+    std::string transform;
+
+    bool operator==(const Key &other) const
+    {
+      return origin == other.origin && index == other.index && transform == other.transform;
+    }
+  };
+
+  /**
+   * @brief Key of a weight of the model file
+   * @param[in] origin    Identity of the model file from @c fileIdentity
+   * @param[in] index     Buffer index in the model file
+   */
+  static Key bufferKey(const std::string &origin, uint32_t index) { return Key{origin, index, ""}; }
+
+  /**
+   * @brief Key of a weight derived from a weight of the model file, such as a pre-packed filter
+   * @param[in] source    Key of the weight derived from
+   * @param[in] transform Kind of transform including shapes, which is unique for each backend
+   */
+  static Key derivedKey(const Key &source, const std::string &transform)
+  {
+    return Key{source.origin, source.index, transform};
+  }
+
+  /**
+   * @brief Identity of a file from its device, inode, size and modification time
+   * @param[in] fd  File descriptor
+   * @return Identity, or empty string if fstat fails
+   */
+  static std::string fileIdentity(int fd);
+
+  /**
+   * @brief Get the process-wide WeightCache
+   */
+  static WeightCache &get();
+
+public:
+  /**
+   * @brief Get the weight of key, or create it with factory and cache it
+   * @param[in] key     Key of the weight
+   * @param[in] factory Function to create the weight, which is called once for a live weight
+   * @return Shared weight
+   */
+  template <typename T>
+  std::shared_ptr<T> getOrCreate(const Key &key, const std::function<std::shared_ptr<T>()> &factory)
+  {
+    // NOTE factory runs under the lock so that concurrent sessions do not create duplicates
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _entries.find(key);
+    if (found != _entries.end())
+    {
+      if (auto cached = found->second.lock())
+        return std::static_pointer_cast<T>(std::const_pointer_cast<void>(cached));
+    }
+
+    auto created = factory();
+    _entries[key] = created;
+    if (_entries.size() >= _sweep_size)
+      sweep();
+    return created;
+  }
+
+  /**
+   * @brief Remember that data is the content of the weight of key
+   *
+   * It lets backends, which see data only, find the key of data to cache weights derived from it.
+   *
+   * @param[in] key   Key of a weight cached by @c getOrCreate
+   * @param[in] data  Address of the content of the weight
+   */
+  void setData(const Key &key, const void *data);
+
+  /**
+   * @brief Find the key of a weight alive of which content is at data
+   * @param[in]  data  Address of the content of a weight
+   * @param[out] key   Key of the weight
+   * @return @c true if found, or @c false if data is not of a cached weight
+   */
+  bool findKey(const void *data, Key &key);
+
+  /**
+   * @brief Get the number of weights alive
+   */
+  size_t size();
+
+private:
+  WeightCache() = default;
+
+  // Remove entries of freed weights
+  void sweep();
+
+  struct KeyHash
+  {
+    size_t operator()(const Key &key) const
+    {
+      return std::hash<std::string>()(key.origin) ^ (std::hash<uint32_t>()(key.index) << 1) ^
+             (std::hash<std::string>()(key.transform) << 2);
+    }
+  };
+
+  struct DataKey
+  {
+    Key key;
+    // Weight of which content is at the address, as the address may be reused once it is freed
+    std::weak_ptr<const void> weight;
+  };
+
+  std::mutex _mutex;
+  std::unordered_map<Key, std::weak_ptr<const void>, KeyHash> _entries;
+  std::unordered_map<const void *, DataKey> _data_keys;
+  size_t _sweep_size = 1024;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_WEIGHT_CACHE_H__
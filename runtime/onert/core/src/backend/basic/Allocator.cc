@@ -18,6 +18,14 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 namespace onert
 {
 namespace backend
@@ -25,9 +33,46 @@ namespace backend
 namespace basic
 {
 
-Allocator::Allocator(uint32_t capacity)
+namespace
+{
+
+// Size of a transparent huge page with 4KB base pages
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+} // namespace
+
+Allocator::Allocator(uint64_t capacity, size_t alignment, bool use_huge_pages)
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  if (capacity > std::numeric_limits<size_t>::max())
+    throw std::runtime_error("Allocator: capacity exceeds the address space");
+
+  // posix_memalign requires alignment of a multiple of sizeof(void *)
+  alignment = std::max(alignment, sizeof(void *));
+  // Keep base unique and non-null for zero capacity
+  size_t size = std::max<size_t>(capacity, 1);
+#ifdef MADV_HUGEPAGE
+  use_huge_pages = use_huge_pages && size >= kHugePageSize;
+  if (use_huge_pages)
+  {
+    alignment = std::max(alignment, kHugePageSize);
+    size = (size + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+  }
+#else
+  use_huge_pages = false;
+#endif
+
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, alignment, size) != 0)
+    throw std::bad_alloc{};
+  _base.reset(static_cast<uint8_t *>(ptr));
+
+#ifdef MADV_HUGEPAGE
+  // This is only an advice, so memory works with small pages when the kernel rejects it
+  if (use_huge_pages && madvise(ptr, size, MADV_HUGEPAGE) != 0)
+  {
+    VERBOSE(ALLOC) << "transparent huge pages are not available" << std::endl;
+  }
+#endif
 
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
@@ -29,13 +29,18 @@ namespace backend
 namespace basic
 {
 
-MemoryManager::MemoryManager() : _mem_planner{createMemoryPlanner()}
+MemoryManager::MemoryManager()
+  : _alignment{static_cast<size_t>(util::getConfigInt(util::config::CPU_MEMORY_ALIGNMENT))},
+    _use_huge_pages{util::getConfigBool(util::config::CPU_MEMORY_HUGE_PAGES)},
+    _mem_planner{createMemoryPlanner()}
 {
   // DO NOTHING
 }
 
 MemoryManager::MemoryManager(const std::string planner_id)
-  : _mem_planner{createMemoryPlanner(planner_id)}
+  : _alignment{static_cast<size_t>(util::getConfigInt(util::config::CPU_MEMORY_ALIGNMENT))},
+    _use_huge_pages{util::getConfigBool(util::config::CPU_MEMORY_HUGE_PAGES)},
+    _mem_planner{createMemoryPlanner(planner_id)}
 {
   // DO NOTHING
 }
@@ -43,15 +48,15 @@ MemoryManager::MemoryManager(const std::string planner_id)
 basic::IMemoryPlanner *MemoryManager::createMemoryPlanner()
 {
   auto planner_id = util::getConfigString(util::config::CPU_MEMORY_PLANNER);
-  return basic::MemoryPlannerFactory::get().create(planner_id);
+  return basic::MemoryPlannerFactory::get().create(planner_id, _alignment);
 }
 
 basic::IMemoryPlanner *MemoryManager::createMemoryPlanner(const std::string planner_id)
 {
-  return basic::MemoryPlannerFactory::get().create(planner_id);
+  return basic::MemoryPlannerFactory::get().create(planner_id, _alignment);
 }
 
-void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+void MemoryManager::claimPlan(const ir::OperandIndex &ind, size_t size)
 {
   _mem_planner->claim(ind, size);
 }
@@ -60,7 +65,8 @@ void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->rel
 
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
+  _mem_alloc =
+    std::make_shared<basic::Allocator>(_mem_planner->capacity(), _alignment, _use_huge_pages);
   assert(_mem_alloc->base());
 }
 
@@ -72,7 +78,7 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 }
 
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
-                                                                 uint32_t capacity)
+                                                                 uint64_t capacity)
 {
   auto find = _mem_alloc_map.find(tensor);
   if (find != _mem_alloc_map.end())
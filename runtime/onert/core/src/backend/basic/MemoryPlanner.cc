@@ -16,7 +16,10 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <stdexcept>
 
 namespace onert
 {
@@ -25,11 +28,186 @@ namespace backend
 namespace basic
 {
 
+namespace
+{
+
+size_t checkAlignment(size_t alignment)
+{
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    throw std::runtime_error("MemoryPlanner: alignment must be a power of 2");
+  return alignment;
+}
+
+uint64_t alignOffset(uint64_t offset, size_t alignment)
+{
+  return (offset + alignment - 1) & ~static_cast<uint64_t>(alignment - 1);
+}
+
+// Candidates of branch-and-bound search for each operand
+constexpr size_t kMaxBranches = 3;
+// Interference visits of branch-and-bound search, which bounds its time
+constexpr uint64_t kSearchWork = 1 << 22;
+
+/**
+ * @brief Assigner of offsets to operands of known sizes and interferences
+ */
+class OffsetAssigner
+{
+public:
+  struct Candidate
+  {
+    uint64_t offset;
+    // Size of the free gap at offset, or max for the top of interfering operands
+    uint64_t gap;
+  };
+
+public:
+  OffsetAssigner(const std::vector<size_t> &sizes,
+                 const std::vector<std::vector<size_t>> &interferences, size_t alignment)
+    : _sizes(sizes), _interferences(interferences), _alignment(alignment),
+      _offsets(sizes.size(), 0), _placed(sizes.size(), false)
+  {
+  }
+
+  const std::vector<uint64_t> &offsets() const { return _offsets; }
+
+  /**
+   * @brief Place operands in order, each at the smallest free gap among placed interfering
+   *        operands for best fit, or at the lowest one otherwise, and get the capacity
+   */
+  uint64_t placeGreedy(const std::vector<size_t> &order, bool best_fit)
+  {
+    std::fill(_placed.begin(), _placed.end(), false);
+    uint64_t capacity = 0;
+    std::vector<Candidate> candidates;
+    for (auto i : order)
+    {
+      findCandidates(i, candidates);
+      const auto lowest = std::min_element(
+        candidates.begin(), candidates.end(),
+        [](const Candidate &lhs, const Candidate &rhs) { return lhs.offset < rhs.offset; });
+      place(i, best_fit ? candidates.front().offset : lowest->offset);
+      capacity = std::max(capacity, _offsets[i] + _sizes[i]);
+    }
+    return capacity;
+  }
+
+  /**
+   * @brief Search placements in order for the least capacity below best_capacity
+   * @return The capacity found, or best_capacity if none is below it
+   */
+  uint64_t search(const std::vector<size_t> &order, uint64_t best_capacity, uint64_t lower_bound)
+  {
+    std::fill(_placed.begin(), _placed.end(), false);
+    _order = &order;
+    _best_capacity = best_capacity;
+    _lower_bound = lower_bound;
+    _best_offsets.clear();
+
+    uint64_t edges = 0;
+    for (const auto &interference : _interferences)
+      edges += interference.size();
+    // Each placement visits interfering operands, so bound the number of placements by work
+    _budget = std::max<uint64_t>(order.size(), kSearchWork / std::max<uint64_t>(1, edges));
+
+    searchFrom(0, 0);
+    if (!_best_offsets.empty())
+      _offsets = _best_offsets;
+    return _best_capacity;
+  }
+
+private:
+  void place(size_t i, uint64_t offset)
+  {
+    _offsets[i] = offset;
+    _placed[i] = true;
+  }
+
+  // Find gaps fitting operand i among placed interfering operands, best fit first and the top
+  // of them last
+  void findCandidates(size_t i, std::vector<Candidate> &candidates)
+  {
+    std::vector<std::pair<uint64_t, uint64_t>> blocks;
+    for (auto j : _interferences[i])
+    {
+      if (_placed[j])
+        blocks.emplace_back(_offsets[j], _offsets[j] + _sizes[j]);
+    }
+    std::sort(blocks.begin(), blocks.end());
+
+    candidates.clear();
+    uint64_t next_offset = 0;
+    for (const auto &block : blocks)
+    {
+      if (block.first >= next_offset + _sizes[i])
+        candidates.push_back({next_offset, block.first - next_offset});
+      next_offset = std::max(next_offset, alignOffset(block.second, _alignment));
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate &lhs, const Candidate &rhs) { return lhs.gap < rhs.gap; });
+    candidates.push_back({next_offset, std::numeric_limits<uint64_t>::max()});
+  }
+
+  void searchFrom(size_t depth, uint64_t capacity)
+  {
+    if (depth == _order->size())
+    {
+      _best_capacity = capacity;
+      _best_offsets = _offsets;
+      return;
+    }
+
+    const auto i = (*_order)[depth];
+    std::vector<Candidate> candidates;
+    findCandidates(i, candidates);
+    if (candidates.size() > kMaxBranches)
+    {
+      // Keep the top, which fits always
+      candidates[kMaxBranches - 1] = candidates.back();
+      candidates.resize(kMaxBranches);
+    }
+
+    for (const auto &candidate : candidates)
+    {
+      if (_budget == 0 || _best_capacity <= _lower_bound)
+        break;
+      const auto next_capacity = std::max(capacity, candidate.offset + _sizes[i]);
+      if (next_capacity >= _best_capacity)
+        continue;
+
+      --_budget;
+      place(i, candidate.offset);
+      searchFrom(depth + 1, next_capacity);
+      _placed[i] = false;
+    }
+  }
+
+  const std::vector<size_t> &_sizes;
+  const std::vector<std::vector<size_t>> &_interferences;
+  size_t _alignment;
+  std::vector<uint64_t> _offsets;
+  std::vector<bool> _placed;
+
+  // State of search
+  const std::vector<size_t> *_order = nullptr;
+  uint64_t _best_capacity = 0;
+  uint64_t _lower_bound = 0;
+  std::vector<uint64_t> _best_offsets;
+  uint64_t _budget = 0;
+};
+
+} // namespace
+
+BumpPlanner::BumpPlanner(size_t alignment) : _alignment(checkAlignment(alignment))
+{
+  // DO NOTHING
+}
+
 void BumpPlanner::claim(const ir::OperandIndex &ind, size_t size)
 {
-  Block blk{_capacity, size};
+  Block blk{alignOffset(_capacity, _alignment), size};
   _mem_plans[ind] = blk;
-  _capacity += size;
+  _capacity = blk.offset + size;
 
   VERBOSE(BP_PLANNER) << "CLAIM(" << ind << "): " << blk.offset << ", " << blk.size << std::endl;
 }
@@ -40,6 +218,11 @@ void BumpPlanner::release(const ir::OperandIndex &ind)
                       << "NOTHING does" << std::endl;
 }
 
+FirstFitPlanner::FirstFitPlanner(size_t alignment) : _alignment(checkAlignment(alignment))
+{
+  // DO NOTHING
+}
+
 // There are some assumptions for claiming memory(== making a reservation for memory).
 // 1. About _claim_table(std::map).
 //   - The table's data structure is std::map so that it always sorts
@@ -54,10 +237,12 @@ void BumpPlanner::release(const ir::OperandIndex &ind)
 //       point in time, it means the place at the offset can be claimed.
 // 2. In the loop for _claim_table, we can assume the current claim_base_offset value is bigger than
 //    the previous claim_base_offset.
+// 3. Every base offset is a multiple of _alignment, and a claim starts at the first aligned offset
+//    after the end of the previous claim.
 void FirstFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
 {
   // Find the right position for claiming
-  uint32_t next_offset = 0;
+  uint64_t next_offset = 0;
   for (auto &mem_claim : _claim_table)
   {
     auto claimed_base_offset = mem_claim.first;
@@ -68,7 +253,7 @@ void FirstFitPlanner::claim(const ir::OperandIndex &ind, size_t size)
     }
     else
     {
-      next_offset = claimed_base_offset + claimed_size;
+      next_offset = alignOffset(claimed_base_offset + claimed_size, _alignment);
     }
   }
 
@@ -91,9 +276,9 @@ void FirstFitPlanner::release(const ir::OperandIndex &ind)
   {
     if (it->second == ind)
     {
-      uint32_t offset = it->first;
+      uint64_t offset = it->first;
       uint32_t index = ind.value();
-      uint32_t size = _mem_plans[ind].size;
+      size_t size = _mem_plans[ind].size;
 
       _claim_table.erase(it);
 
@@ -105,9 +290,9 @@ void FirstFitPlanner::release(const ir::OperandIndex &ind)
   assert(!"Cannot release for given index. It has been not claimed or released already.");
 }
 
-WICPlanner::WICPlanner()
-  : _initialized(false), _capacity(0), _mem_plans(), _live_operands(), _interference_graph(),
-    _operands()
+WICPlanner::WICPlanner(size_t alignment)
+  : _alignment(checkAlignment(alignment)), _initialized(false), _capacity(0), _mem_plans(),
+    _live_operands(), _interference_graph(), _operands()
 {
   // DO NOTHING
 }
@@ -145,15 +330,15 @@ void WICPlanner::buildMemoryPlans()
 {
   for (const auto &operand : _operands)
   {
-    uint32_t size = operand.first;
+    size_t size = operand.first;
     const ir::OperandIndex &ind = operand.second;
     VERBOSE(WIC_PLANNER) << "build_plan(" << ind << "): [" << size << "sz]" << std::endl;
 
-    uint32_t next_offset = 0;
+    uint64_t next_offset = 0;
     if (_interference_graph.count(ind))
     {
       // Find interfered memory plans and sort them by offset
-      std::multimap<uint32_t, uint32_t> interfered_plans;
+      std::multimap<uint64_t, size_t> interfered_plans;
       for (const auto &interference : _interference_graph[ind])
       {
         if (_mem_plans.count(interference))
@@ -173,7 +358,7 @@ void WICPlanner::buildMemoryPlans()
         }
         else if (next_offset < claimed_base_offset + claimed_size)
         {
-          next_offset = claimed_base_offset + claimed_size;
+          next_offset = alignOffset(claimed_base_offset + claimed_size, _alignment);
         }
       }
     }
@@ -203,6 +388,155 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+OfflinePlanner::OfflinePlanner(size_t alignment)
+  : _alignment(checkAlignment(alignment)), _initialized(false), _capacity(0), _lower_bound(0),
+    _mem_plans(), _step(0), _lifetimes(), _live_operands()
+{
+  // DO NOTHING
+}
+
+void OfflinePlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  _live_operands[ind] = _lifetimes.size();
+  _lifetimes.push_back({ind, size, _step++, std::numeric_limits<uint32_t>::max()});
+
+  VERBOSE(OFFLINE_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
+}
+
+void OfflinePlanner::release(const ir::OperandIndex &ind)
+{
+  auto live = _live_operands.find(ind);
+  assert(live != _live_operands.end());
+  if (live == _live_operands.end())
+    return;
+
+  _lifetimes[live->second].end = _step++;
+  _live_operands.erase(live);
+  VERBOSE(OFFLINE_PLANNER) << "release(" << ind << ")" << std::endl;
+}
+
+/*
+ * Build memory plans using lifetimes of all operands
+ * 1. Find interfering operands, of which lifetimes overlap
+ * 2. Get the lower bound of capacity, which is the maximum bytes live at a step
+ * 3. Place operands by greedy orders with best fit and first fit, and keep the plan of the least
+ *    capacity
+ *   - By size : larger operands first
+ *   - By breadth : operands live at steps of more live bytes first
+ * 4. Search placements in order by size unless the capacity is the lower bound
+ */
+void OfflinePlanner::buildMemoryPlans()
+{
+  const auto num_operands = _lifetimes.size();
+  const uint32_t num_steps = _step;
+  for (auto &lifetime : _lifetimes)
+    lifetime.end = std::min(lifetime.end, num_steps);
+
+  std::vector<size_t> sizes(num_operands);
+  for (size_t i = 0; i < num_operands; ++i)
+    sizes[i] = _lifetimes[i].size;
+
+  // Lifetimes are in order of begin, so an operand interferes with following operands which
+  // begin before its end
+  std::vector<std::vector<size_t>> interferences(num_operands);
+  for (size_t i = 0; i < num_operands; ++i)
+  {
+    for (size_t j = i + 1; j < num_operands && _lifetimes[j].begin < _lifetimes[i].end; ++j)
+    {
+      interferences[i].push_back(j);
+      interferences[j].push_back(i);
+    }
+  }
+
+  std::vector<uint64_t> live_bytes(num_steps, 0);
+  std::vector<std::vector<size_t>> live_operands(num_steps);
+  for (size_t i = 0; i < num_operands; ++i)
+  {
+    for (auto step = _lifetimes[i].begin; step < _lifetimes[i].end; ++step)
+    {
+      live_bytes[step] += sizes[i];
+      live_operands[step].push_back(i);
+    }
+  }
+  _lower_bound = num_steps == 0 ? 0 : *std::max_element(live_bytes.begin(), live_bytes.end());
+
+  std::vector<size_t> by_size(num_operands);
+  for (size_t i = 0; i < num_operands; ++i)
+    by_size[i] = i;
+  std::stable_sort(by_size.begin(), by_size.end(),
+                   [&](size_t lhs, size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+
+  std::vector<uint32_t> steps(num_steps);
+  for (uint32_t step = 0; step < num_steps; ++step)
+    steps[step] = step;
+  std::stable_sort(steps.begin(), steps.end(),
+                   [&](uint32_t lhs, uint32_t rhs) { return live_bytes[lhs] > live_bytes[rhs]; });
+  std::vector<size_t> by_breadth;
+  std::vector<bool> ordered(num_operands, false);
+  for (auto step : steps)
+  {
+    auto &operands = live_operands[step];
+    std::stable_sort(operands.begin(), operands.end(),
+                     [&](size_t lhs, size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+    for (auto i : operands)
+    {
+      if (!ordered[i])
+      {
+        ordered[i] = true;
+        by_breadth.push_back(i);
+      }
+    }
+  }
+
+  OffsetAssigner assigner{sizes, interferences, _alignment};
+  _capacity = std::numeric_limits<uint64_t>::max();
+  std::vector<uint64_t> offsets;
+  for (const auto *order : {&by_breadth, &by_size})
+  {
+    for (bool best_fit : {true, false})
+    {
+      const auto capacity = assigner.placeGreedy(*order, best_fit);
+      if (capacity < _capacity)
+      {
+        _capacity = capacity;
+        offsets = assigner.offsets();
+      }
+    }
+  }
+  if (num_operands == 0)
+    _capacity = 0;
+  if (_capacity > _lower_bound)
+  {
+    const auto searched_capacity = assigner.search(by_size, _capacity, _lower_bound);
+    if (searched_capacity < _capacity)
+    {
+      _capacity = searched_capacity;
+      offsets = assigner.offsets();
+    }
+  }
+
+  for (size_t i = 0; i < num_operands; ++i)
+  {
+    _mem_plans[_lifetimes[i].index] = {offsets[i], sizes[i]};
+    VERBOSE(OFFLINE_PLANNER) << "alloc(" << _lifetimes[i].index << "): [+" << offsets[i] << ", "
+                             << sizes[i] << "sz]" << std::endl;
+  }
+  const auto gap_percent = _lower_bound == 0 ? 0 : (_capacity - _lower_bound) * 100 / _lower_bound;
+  VERBOSE(OFFLINE_PLANNER) << "capacity " << _capacity << ", lower bound " << _lower_bound << " (+"
+                           << gap_percent << "%)" << std::endl;
+
+  _initialized = true;
+  _lifetimes.clear();
+  _live_operands.clear();
+}
+
+OfflinePlanner::MemoryPlans &OfflinePlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -44,6 +44,12 @@ namespace basic
 class BumpPlanner : public IMemoryPlanner
 {
 public:
+  /**
+   * @brief Construct a new BumpPlanner object
+   * @param[in] alignment Alignment of offsets in bytes, which is a power of 2
+   */
+  explicit BumpPlanner(size_t alignment = kDefaultAlignment);
+
   /**
    * @brief Claim memory for operand by bump way
    * @param[in] index The operand index
@@ -59,7 +65,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  uint64_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -67,7 +73,8 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _alignment;
+  uint64_t _capacity = 0;
   MemoryPlans _mem_plans;
 };
 
@@ -77,6 +84,12 @@ private:
 class FirstFitPlanner : public IMemoryPlanner
 {
 public:
+  /**
+   * @brief Construct a new FirstFitPlanner object
+   * @param[in] alignment Alignment of offsets in bytes, which is a power of 2
+   */
+  explicit FirstFitPlanner(size_t alignment = kDefaultAlignment);
+
   /**
    * @brief Claim memory for operand by firstfit way
    * @param[in] index The operand index
@@ -92,7 +105,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override { return _capacity; }
+  uint64_t capacity() override { return _capacity; }
   /**
    * @brief Get MemoryPlans
    * @return MemoryPlans
@@ -100,10 +113,11 @@ public:
   MemoryPlans &memory_plans() override { return _mem_plans; }
 
 private:
-  uint32_t _capacity = 0;
+  size_t _alignment;
+  uint64_t _capacity = 0;
   MemoryPlans _mem_plans;
-  // Use std::map because claim() assumes that _claim_table is sorted by uint32_t(base_offset)
-  std::map<uint32_t, ir::OperandIndex> _claim_table;
+  // Use std::map because claim() assumes that _claim_table is sorted by uint64_t(base_offset)
+  std::map<uint64_t, ir::OperandIndex> _claim_table;
 };
 
 /**
@@ -112,7 +126,11 @@ private:
 class WICPlanner : public IMemoryPlanner
 {
 public:
-  WICPlanner();
+  /**
+   * @brief Construct a new WICPlanner object
+   * @param[in] alignment Alignment of offsets in bytes, which is a power of 2
+   */
+  explicit WICPlanner(size_t alignment = kDefaultAlignment);
 
   /**
    * @brief Claim memory for operand by WIC algorithm
@@ -129,7 +147,7 @@ public:
    * @brief Get capacity for memory planning
    * @return The value of capacity
    */
-  uint32_t capacity() override
+  uint64_t capacity() override
   {
     if (!_initialized)
       buildMemoryPlans();
@@ -144,13 +162,91 @@ public:
 private:
   void buildMemoryPlans();
 
+  size_t _alignment;
   bool _initialized;
-  uint32_t _capacity;
+  uint64_t _capacity;
   MemoryPlans _mem_plans;
   std::unordered_set<ir::OperandIndex> _live_operands;
   ir::OperandIndexMap<std::vector<ir::OperandIndex>> _interference_graph;
   // Sort operands by descending order of size
-  std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
+  std::multimap<size_t, ir::OperandIndex, std::greater<size_t>> _operands;
+};
+
+/**
+ * @brief Class to plan memory offline from lifetimes of all operands
+ *
+ * Claims and releases only record lifetimes. Plans are built when they are first requested,
+ * which tries greedy orders by size and by breadth with best-fit placement, and refines the
+ * order by size with a bounded branch-and-bound search.
+ */
+class OfflinePlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Construct a new OfflinePlanner object
+   * @param[in] alignment Alignment of offsets in bytes, which is a power of 2
+   */
+  explicit OfflinePlanner(size_t alignment = kDefaultAlignment);
+
+  /**
+   * @brief Record the start of lifetime of operand
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Record the end of lifetime of operand
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint64_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+  /**
+   * @brief Get the maximum bytes of operands live at once, which no plan can be below
+   * @return The lower bound of capacity
+   */
+  uint64_t lowerBound()
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _lower_bound;
+  }
+
+private:
+  struct Lifetime
+  {
+    ir::OperandIndex index;
+    size_t size;
+    // Live in steps of [begin, end)
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  void buildMemoryPlans();
+
+  size_t _alignment;
+  bool _initialized;
+  uint64_t _capacity;
+  uint64_t _lower_bound;
+  MemoryPlans _mem_plans;
+  // Step of claims and releases
+  uint32_t _step;
+  std::vector<Lifetime> _lifetimes;
+  // Position in _lifetimes of operands claimed and not released
+  ir::OperandIndexMap<size_t> _live_operands;
 };
 
 } // namespace basic
@@ -25,11 +25,23 @@ TEST(Allocator, allocate_test)
   ASSERT_NE(allocator.base(), nullptr);
 }
 
+TEST(Allocator, alignment_test)
+{
+  ::onert::backend::basic::Allocator allocator(1000, 256);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(allocator.base()) % 256, 0);
+
+  // Huge pages are only an advice, and small capacity falls back to normal pages
+  ::onert::backend::basic::Allocator huge_page_allocator(4 * 1024 * 1024, 64, true);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(huge_page_allocator.base()) % 64, 0);
+  ::onert::backend::basic::Allocator small_allocator(0, 64, true);
+  ASSERT_NE(small_allocator.base(), nullptr);
+}
+
 TEST(BumpPlanner, claim_test)
 {
-  ::onert::backend::basic::BumpPlanner planner;
+  ::onert::backend::basic::BumpPlanner planner{1};
 
-  auto claim = [&planner](uint32_t index, size_t size, uint32_t expected_offset) {
+  auto claim = [&planner](uint32_t index, size_t size, uint64_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     planner.claim(mem_idx, size);
     auto mem_blk = planner.memory_plans()[mem_idx];
@@ -44,9 +56,9 @@ TEST(BumpPlanner, claim_test)
 
 TEST(FirstFitPlanner, claim_release_test)
 {
-  ::onert::backend::basic::FirstFitPlanner planner;
+  ::onert::backend::basic::FirstFitPlanner planner{1};
 
-  auto claim = [&planner](uint32_t index, size_t size, uint32_t expected_offset) {
+  auto claim = [&planner](uint32_t index, size_t size, uint64_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     planner.claim(mem_idx, size);
     auto mem_blk = planner.memory_plans()[mem_idx];
@@ -128,7 +140,7 @@ TEST(FirstFitPlanner, claim_release_test)
 
 TEST(WICPlanner, claim_release_test)
 {
-  ::onert::backend::basic::WICPlanner planner;
+  ::onert::backend::basic::WICPlanner planner{1};
 
   auto claim = [&planner](uint32_t index, size_t size) {
     onert::ir::OperandIndex mem_idx(index);
@@ -140,14 +152,14 @@ TEST(WICPlanner, claim_release_test)
     planner.release(mem_idx);
   };
 
-  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+  auto verify = [&planner](uint32_t index, uint32_t size, uint64_t expected_offset) {
     onert::ir::OperandIndex mem_idx(index);
     auto mem_blk = planner.memory_plans()[mem_idx];
     ASSERT_EQ(mem_blk.offset, expected_offset);
     ASSERT_EQ(mem_blk.size, size);
   };
 
-  auto capacity = [&planner](uint32_t expected_capacity) {
+  auto capacity = [&planner](uint64_t expected_capacity) {
     auto actual_capacity = planner.capacity();
     ASSERT_EQ(actual_capacity, expected_capacity);
   };
@@ -191,3 +203,213 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(BumpPlanner, aligned_claim_test)
+{
+  ::onert::backend::basic::BumpPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size, uint64_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  claim(0, 10, 0);
+  claim(1, 64, 64);
+  claim(2, 30, 128);
+  ASSERT_EQ(planner.capacity(), 158);
+}
+
+TEST(FirstFitPlanner, aligned_claim_release_test)
+{
+  ::onert::backend::basic::FirstFitPlanner planner{32};
+
+  auto claim = [&planner](uint32_t index, size_t size, uint64_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  claim(0, 10, 0);
+  claim(1, 40, 32);
+  claim(2, 20, 96);
+  release(0);
+  // Fits in the hole before 1
+  claim(3, 32, 0);
+  release(1);
+  // Does not fit in [32, 96)
+  claim(4, 65, 128);
+  claim(5, 1, 32);
+  ASSERT_EQ(planner.capacity(), 193);
+}
+
+TEST(WICPlanner, aligned_claim_release_test)
+{
+  ::onert::backend::basic::WICPlanner planner{16};
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint64_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+  };
+
+  claim(0, 20);
+  claim(1, 5);
+  release(0);
+  claim(2, 10);
+  release(1);
+  release(2);
+
+  // 2 reuses the memory of 0, and 1 interferes with both
+  verify(0, 0);
+  verify(2, 0);
+  verify(1, 32);
+  ASSERT_EQ(planner.capacity(), 37);
+}
+
+TEST(OfflinePlanner, claim_release_test)
+{
+  ::onert::backend::basic::OfflinePlanner planner{1};
+  ::onert::backend::basic::WICPlanner wic_planner{1};
+
+  auto claim = [&](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+    wic_planner.claim(mem_idx, size);
+  };
+
+  auto release = [&](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+    wic_planner.release(mem_idx);
+  };
+
+  claim(0, 56);
+  claim(1, 94);
+  release(1);
+  claim(2, 54);
+  claim(3, 68);
+  release(2);
+  claim(4, 43);
+  claim(5, 52);
+  release(0);
+  release(3);
+  release(5);
+  release(4);
+  claim(6, 57);
+  claim(7, 90);
+  release(6);
+  release(7);
+
+  // 0, 3, 4 and 5 are live together
+  ASSERT_EQ(planner.lowerBound(), 219);
+  ASSERT_EQ(planner.capacity(), 219);
+  // Placing 1 first by size leaves a hole
+  ASSERT_EQ(wic_planner.capacity(), 245);
+
+  // Operands live together do not overlap
+  const std::vector<std::vector<uint32_t>> live_sets{{0, 1}, {0, 2, 3}, {0, 3, 4, 5}, {6, 7}};
+  for (const auto &live_set : live_sets)
+  {
+    for (auto lhs : live_set)
+    {
+      for (auto rhs : live_set)
+      {
+        if (lhs == rhs)
+          continue;
+        auto lhs_blk = planner.memory_plans()[onert::ir::OperandIndex{lhs}];
+        auto rhs_blk = planner.memory_plans()[onert::ir::OperandIndex{rhs}];
+        ASSERT_TRUE(lhs_blk.offset + lhs_blk.size <= rhs_blk.offset ||
+                    rhs_blk.offset + rhs_blk.size <= lhs_blk.offset);
+      }
+    }
+  }
+}
+
+TEST(OfflinePlanner, aligned_claim_release_test)
+{
+  ::onert::backend::basic::OfflinePlanner planner{32};
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  claim(0, 10);
+  claim(1, 5);
+  release(0);
+  claim(2, 7);
+  release(1);
+  release(2);
+
+  // 0 and 2 share memory, and 1 starts at an aligned offset after either of them
+  auto offset = [&planner](uint32_t index) {
+    return planner.memory_plans()[onert::ir::OperandIndex{index}].offset;
+  };
+  ASSERT_EQ(offset(0), offset(2));
+  ASSERT_EQ(offset(1) % 32, 0);
+  ASSERT_NE(offset(0), offset(1));
+  ASSERT_EQ(planner.lowerBound(), 15);
+  ASSERT_EQ(planner.capacity(), 37);
+}
+
+TEST(MemoryPlanner, invalid_alignment_test)
+{
+  EXPECT_ANY_THROW(::onert::backend::basic::BumpPlanner{0});
+  EXPECT_ANY_THROW(::onert::backend::basic::FirstFitPlanner{48});
+  EXPECT_ANY_THROW(::onert::backend::basic::WICPlanner{3});
+  EXPECT_ANY_THROW(::onert::backend::basic::OfflinePlanner{6});
+}
+
+TEST(MemoryPlanner, large_capacity_test)
+{
+  // Plans beyond 4GB are only offsets, so nothing is allocated here
+  const size_t size = static_cast<size_t>(3) << 30;
+  if (size != (static_cast<uint64_t>(3) << 30))
+    return; // 32-bit size_t
+
+  ::onert::backend::basic::BumpPlanner bump_planner;
+  ::onert::backend::basic::FirstFitPlanner first_fit_planner;
+  ::onert::backend::basic::WICPlanner wic_planner;
+  ::onert::backend::basic::OfflinePlanner offline_planner;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    onert::ir::OperandIndex mem_idx(i);
+    bump_planner.claim(mem_idx, size);
+    first_fit_planner.claim(mem_idx, size);
+    wic_planner.claim(mem_idx, size);
+    offline_planner.claim(mem_idx, size);
+  }
+
+  const uint64_t expected_capacity = static_cast<uint64_t>(9) << 30;
+  ASSERT_EQ(bump_planner.capacity(), expected_capacity);
+  ASSERT_EQ(first_fit_planner.capacity(), expected_capacity);
+  ASSERT_EQ(wic_planner.capacity(), expected_capacity);
+  ASSERT_EQ(offline_planner.capacity(), expected_capacity);
+  ASSERT_EQ(wic_planner.memory_plans()[onert::ir::OperandIndex{2}].offset,
+            static_cast<uint64_t>(6) << 30);
+}
@@ -31,21 +31,25 @@ MemoryPlannerFactory &MemoryPlannerFactory::get()
   return instance;
 }
 
-IMemoryPlanner *MemoryPlannerFactory::create(const std::string &key)
+IMemoryPlanner *MemoryPlannerFactory::create(const std::string &key, size_t alignment)
 {
   if (key == "FirstFit")
   {
-    return new FirstFitPlanner;
+    return new FirstFitPlanner{alignment};
   }
   else if (key == "Bump")
   {
-    return new BumpPlanner;
+    return new BumpPlanner{alignment};
   }
   else if (key == "WIC")
   {
-    return new WICPlanner;
+    return new WICPlanner{alignment};
   }
-  return new FirstFitPlanner; // Default Planner
+  else if (key == "Offline")
+  {
+    return new OfflinePlanner{alignment};
+  }
+  return new FirstFitPlanner{alignment}; // Default Planner
 }
 
 } // namespace basic
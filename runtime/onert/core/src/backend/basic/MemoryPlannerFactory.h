@@ -37,7 +37,8 @@ private:
   MemoryPlannerFactory() = default;
 
 public:
-  IMemoryPlanner *create(const std::string &key);
+  IMemoryPlanner *create(const std::string &key,
+                         size_t alignment = IMemoryPlanner::kDefaultAlignment);
 };
 
 } // namespace basic
@@ -75,7 +75,7 @@ void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
   _as_constants[ind] = as_const;
 }
 
-void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
+void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, size_t size)
 {
   assert(_tensors->getNativeTensor(ind));
 
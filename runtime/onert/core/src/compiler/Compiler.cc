@@ -338,12 +338,6 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::Permute] = builtin_id;
   }
 
-  // FIXME This is a workaround for bcq operations, should remove it
-  {
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
-  }
-
   {
     VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
     VERBOSE(Compiler) << "backend_list             : "
@@ -533,12 +527,6 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
     _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::Permute] = builtin_id;
   }
 
-  // FIXME This is a workaround for bcq operations, should remove it
-  {
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
-    _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
-  }
-
   // It doesn't support tracing in case of partial graph
   {
     _options.tracing_ctx = nullptr;
@@ -16,13 +16,41 @@
 
 #include "exec/Execution.h"
 
+#include "ThreadPool.h"
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+class AsyncFunction : public IFunction
+{
+public:
+  AsyncFunction(const std::function<void()> &fn) : _fn{fn} {}
+
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+// Threads shared by all executions of the process, to run submitted inferences
+ThreadPool &runtimeThreadPool()
+{
+  static ThreadPool pool{std::max(1u, std::thread::hardware_concurrency())};
+  return pool;
+}
+
+} // namespace
+
 Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors{executors}
 {
   assert(executors != nullptr);
@@ -30,7 +58,12 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   const auto &primary_subg = primary_subgraph();
   _io_desc.inputs.resize(primary_subg.getInputs().size());
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
-  sem_init(&_async_io_descs_sem, 0, 1);
+}
+
+Execution::~Execution()
+{
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [this] { return !_async_running; });
 }
 
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
@@ -72,82 +105,6 @@ void Execution::setInput(const ir::IOIndex &index, const void *buffer, size_t le
   _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
 }
 
-void Execution::createNewAsyncDesc(uint32_t count)
-{
-  IODescription *_async_io_desc = new IODescription;
-  _async_io_desc->inputs.resize(primary_subgraph().getInputs().size());
-  _async_io_desc->outputs.resize(primary_subgraph().getOutputs().size());
-
-  _async_io_descs.push_back({_async_io_desc, count});
-}
-
-void Execution::setFinish() { finished = true; }
-
-bool Execution::isEmptyQueue()
-{
-  asyncIoDescSemWait();
-  bool ret = _async_io_descs.empty();
-  if (!ret)
-  {
-    for (uint32_t idx = 0; idx < _async_io_descs.front().first->inputs.size(); idx++)
-    {
-      if (_async_io_descs.front().first->inputs.at(idx).get() == nullptr)
-      {
-        ret = true;
-        break;
-      }
-    }
-  }
-  asyncIoDescSemPost();
-  return ret;
-}
-
-void Execution::executeAsyncInput(const ir::IOIndex &index, const void *buffer, size_t length,
-                                  ir::Layout layout)
-{
-  const auto input_index = primary_subgraph().getInputs().at(index);
-  const auto info = primary_subgraph().operands().at(input_index).info();
-  IODescription *_async_io_desc = _async_io_descs.back().first;
-
-  {
-    auto input_shape_sig = _async_io_desc->dynamic_input_shapes.find(index);
-    auto size_required =
-      (input_shape_sig != _async_io_desc->dynamic_input_shapes.end())
-        ? input_shape_sig->second.num_elements() * onert::ir::sizeOfDataType(info.typeInfo().type())
-        : info.total_size();
-
-    if (length < size_required)
-    {
-      throw std::runtime_error{"Too small length"};
-    }
-  }
-  void *_buffer = (void *)malloc(length);
-  if (_buffer == NULL)
-  {
-    throw std::runtime_error{"malloc failed"};
-  }
-  memcpy(_buffer, buffer, length);
-
-  _async_io_desc->inputs.at(index.value()) =
-    std::make_unique<InputDesc>(info, _buffer, length, layout);
-}
-
-void Execution::executeAsyncOutput(const ir::IOIndex &index, void *buffer, size_t length,
-                                   ir::Layout layout)
-{
-  const auto output_index = primary_subgraph().getOutputs().at(index);
-  const auto info = primary_subgraph().operands().at(output_index).info();
-  IODescription *_async_io_desc = _async_io_descs.front().first;
-
-  if (length < info.total_size())
-  {
-    throw std::runtime_error{"Too small length"};
-  }
-
-  _async_io_desc->outputs.at(index.value()) =
-    std::make_unique<OutputDesc>(info, buffer, length, layout);
-}
-
 // TODO Remove default parameter
 void Execution::setInput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
                          const void *buffer, size_t length, ir::Layout layout)
@@ -208,37 +165,160 @@ void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
 
-  primary_executor()->execute(_io_desc);
+  {
+    std::lock_guard<std::mutex> lock{_exec_mutex};
+    primary_executor()->execute(_io_desc);
+  }
   finished = true;
 
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::AsyncExecute()
+void Execution::startExecute()
 {
-  VERBOSE(Execution) << "Start Async execution" << std::endl;
-  if (_async_io_descs.empty())
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
+
   {
-    VERBOSE(Execution) << "The input is not ready" << std::endl;
-    return;
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    _async_done = false;
+    _async_error = nullptr;
   }
 
-  primary_executor()->execute(*_async_io_descs.front().first);
+  enqueueRequest({&_io_desc, nullptr, [this](std::exception_ptr error) {
+                    std::lock_guard<std::mutex> lock{_async_mutex};
+                    _async_error = error;
+                    _async_done = true;
+                    _async_cv.notify_all();
+                  }});
 }
 
-void Execution::startExecute()
+void Execution::waitFinish()
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock{_async_mutex};
+    _async_cv.wait(lock, [this] { return _async_done; });
+    error = _async_error;
+    _async_error = nullptr;
+  }
+  finished = true;
+
+  if (error)
+    std::rethrow_exception(error);
 }
 
-void Execution::waitFinish()
+std::unique_ptr<IODescription>
+Execution::createIODescription(const std::vector<const void *> &inputs,
+                               const std::vector<size_t> &input_lengths,
+                               const std::vector<void *> &outputs,
+                               const std::vector<size_t> &output_lengths)
 {
-  VERBOSE(Execution) << "Wait to finish execution" << std::endl;
+  const auto &graph = primary_subgraph();
+  if (inputs.size() != graph.getInputs().size() || input_lengths.size() != inputs.size())
+    throw std::runtime_error{"Wrong number of inputs"};
+  if (outputs.size() != graph.getOutputs().size() || output_lengths.size() != outputs.size())
+    throw std::runtime_error{"Wrong number of outputs"};
+
+  auto io_desc = std::make_unique<IODescription>();
+  io_desc->dynamic_input_shapes = _io_desc.dynamic_input_shapes;
+  io_desc->inputs.resize(inputs.size());
+  io_desc->outputs.resize(outputs.size());
+
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+  {
+    const ir::IOIndex index{i};
+    const auto info = graph.operands().at(graph.getInputs().at(index)).info();
 
-  _exec_thread->join();
-  finished = true;
+    auto input_shape_sig = io_desc->dynamic_input_shapes.find(index);
+    auto size_required =
+      (input_shape_sig != io_desc->dynamic_input_shapes.end())
+        ? input_shape_sig->second.num_elements() * onert::ir::sizeOfDataType(info.typeInfo().type())
+        : info.total_size();
+
+    if (input_lengths[i] < size_required)
+    {
+      throw std::runtime_error{"Too small length"};
+    }
+
+    io_desc->inputs.at(i) =
+      std::make_unique<InputDesc>(info, inputs[i], input_lengths[i], ir::Layout::NHWC);
+  }
+
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    const ir::IOIndex index{i};
+    const auto info = graph.operands().at(graph.getOutputs().at(index)).info();
+
+    if (output_lengths[i] < info.total_size())
+    {
+      throw std::runtime_error{"Too small length"};
+    }
+
+    io_desc->outputs.at(i) =
+      std::make_unique<OutputDesc>(info, outputs[i], output_lengths[i], ir::Layout::NHWC);
+  }
+
+  return io_desc;
+}
+
+void Execution::submit(std::unique_ptr<IODescription> io_desc, const Completion &completion)
+{
+  assert(io_desc != nullptr);
+  auto io_desc_ptr = io_desc.get();
+  enqueueRequest({io_desc_ptr, std::move(io_desc), completion});
+}
+
+void Execution::enqueueRequest(AsyncRequest &&request)
+{
+  bool start_running = false;
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    _async_requests.push_back(std::move(request));
+    if (!_async_running)
+    {
+      _async_running = true;
+      start_running = true;
+    }
+  }
+
+  // One pool thread at a time runs requests of this execution, until its queue is empty
+  if (start_running)
+    runtimeThreadPool().enqueue(std::make_unique<AsyncFunction>([this] { runRequests(); }));
+}
+
+void Execution::runRequests()
+{
+  while (true)
+  {
+    AsyncRequest request;
+    {
+      std::lock_guard<std::mutex> lock{_async_mutex};
+      if (_async_requests.empty())
+      {
+        _async_running = false;
+        _async_cv.notify_all();
+        return;
+      }
+      request = std::move(_async_requests.front());
+      _async_requests.pop_front();
+    }
+
+    std::exception_ptr error;
+    try
+    {
+      std::lock_guard<std::mutex> lock{_exec_mutex};
+      primary_executor()->execute(*request.io_desc);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    if (request.completion)
+      request.completion(error);
+  }
 }
 
 bool Execution::isFinished(void) const { return finished; }
@@ -267,153 +347,267 @@ ir::Shape Execution::getOutputShape(ir::IOIndex ind) const
   return output_desc->info.shape();
 }
 
-void Execution::asyncIoDescSemWait() { sem_wait(&_async_io_descs_sem); }
+void Execution::preparePipeline(uint32_t capacity, uint32_t num_producers, bool is_output)
+{
+  assert(capacity > 0);
+  const auto &graph = primary_subgraph();
 
-void Execution::asyncIoDescSemPost() { sem_post(&_async_io_descs_sem); }
+  _free_records = std::make_unique<PipelineQueue<PipelineRecord *>>(capacity);
+  _ready_records = std::make_unique<PipelineQueue<PipelineRecord *>>(capacity);
+  if (is_output)
+    _pipeline_results = std::make_unique<PipelineQueue<std::vector<void *>>>(capacity);
 
-void Execution::runInference()
+  for (uint32_t i = 0; i < capacity; ++i)
+  {
+    auto record = std::make_unique<PipelineRecord>();
+    record->count = 0;
+    record->num_inputs_set = 0;
+    record->io_desc.inputs.resize(graph.getInputs().size());
+    record->io_desc.outputs.resize(graph.getOutputs().size());
+
+    for (uint32_t n = 0; n < graph.getInputs().size(); ++n)
+    {
+      const auto info = graph.operands().at(graph.getInputs().at(n)).info();
+      record->input_buffers.emplace_back(info.total_size());
+      auto &buffer = record->input_buffers.back();
+      record->io_desc.inputs.at(n) =
+        std::make_unique<InputDesc>(info, buffer.data(), buffer.size(), ir::Layout::NHWC);
+    }
+    for (uint32_t n = 0; n < graph.getOutputs().size(); ++n)
+    {
+      const auto info = graph.operands().at(graph.getOutputs().at(n)).info();
+      record->output_buffers.emplace_back(info.total_size());
+      auto &buffer = record->output_buffers.back();
+      record->io_desc.outputs.at(n) =
+        std::make_unique<OutputDesc>(info, buffer.data(), buffer.size(), ir::Layout::NHWC);
+    }
+
+    _free_records->push(record.get());
+    _pipeline_records.push_back(std::move(record));
+  }
+
+  _num_producers = num_producers;
+  _stats.capacity = capacity;
+
+  // Nothing will come to this stage
+  if (num_producers == 0)
+    _ready_records->close();
+}
+
+void Execution::pushPipelineInput(uint32_t count, const ir::IOIndex &index, const void *buffer,
+                                  size_t length)
 {
-  uint32_t inference_cnt;
-  uint32_t output_sz = primary_subgraph().getOutputs().size();
-  while (true)
+  assert(_free_records != nullptr);
+
+  PipelineRecord *record = nullptr;
   {
-    if (isEmptyQueue())
+    std::lock_guard<std::mutex> lock{_pending_mutex};
+    auto it = _pending_records.find(count);
+    if (it != _pending_records.end())
+      record = it->second;
+  }
+
+  if (record == nullptr)
+  {
+    // Blocks while all records are in flight, which makes backpressure to producer
+    PipelineRecord *free_record = nullptr;
+    if (!_free_records->pop(free_record))
+      throw std::runtime_error{"Pipeline is aborted"};
+
+    std::lock_guard<std::mutex> lock{_pending_mutex};
+    auto it = _pending_records.find(count);
+    if (it != _pending_records.end())
     {
-      if (isFinished())
-      {
-        if (!next_exes.empty())
-        {
-          for (uint32_t i = 0; i < next_exes.size(); i++)
-          {
-            std::get<0>(next_exes[i])->setFinish();
-          }
-        }
-        else
-        {
-          sholudStop();
-        }
-        break;
-      }
+      // Another producer has set other input of the same inference meanwhile
+      record = it->second;
+      _free_records->push(free_record);
     }
     else
     {
-      for (uint32_t i = 0; i < output_sz; i++)
-      {
-        auto opidx = primary_subgraph().getOutputs().at(i);
-        auto shape = primary_subgraph().operands().at(opidx).shape();
-        auto dtype = primary_subgraph().operands().at(opidx).typeInfo().type();
-        auto rank = shape.rank();
-        uint32_t tensor_size = 1;
-        for (int32_t j = 0; j < rank; j++)
-        {
-          tensor_size *= shape.dim(j);
-        }
-        if (dtype == onert::ir::DataType::FLOAT32 || dtype == onert::ir::DataType::INT32 ||
-            dtype == onert::ir::DataType::UINT32)
-          tensor_size *= 4;
-        else if (dtype == onert::ir::DataType::INT64)
-          tensor_size *= 8;
-        void *_buffer = (void *)malloc(tensor_size);
-        if (_buffer == NULL)
-        {
-          throw std::runtime_error{"malloc failed"};
-        }
-        executeAsyncOutput(onert::ir::IOIndex(i), _buffer, tensor_size);
-      }
-      AsyncExecute();
+      record = free_record;
+      record->count = count;
+      record->num_inputs_set = 0;
+      _pending_records[count] = record;
+    }
+  }
 
-      // set inputs of next execution
-      auto _io_desc = getAsyncIoDescs()->front().first;
-      inference_cnt = getAsyncIoDescs()->front().second;
-      getAsyncIoDescs()->pop_front();
+  auto &input_buffer = record->input_buffers.at(index.value());
+  if (length < input_buffer.size())
+  {
+    throw std::runtime_error{"Too small length"};
+  }
+  memcpy(input_buffer.data(), buffer, input_buffer.size());
 
-      for (uint32_t i = 0; i < next_exes.size(); i++)
-      {
-        auto next_exe = std::get<0>(next_exes[i]);
-        auto o_index = std::get<1>(next_exes[i]);
-        auto i_index = std::get<2>(next_exes[i]);
-
-        next_exe->asyncIoDescSemWait();
-        auto next_io_descs = next_exe->getAsyncIoDescs();
-        bool exist = false;
-        for (auto iter = next_io_descs->begin(); iter != next_io_descs->end(); iter++)
-        {
-          if (inference_cnt == iter->second)
-          {
-            exist = true;
-          }
-        }
-
-        if (!exist)
-        {
-          next_exe->createNewAsyncDesc(inference_cnt);
-        }
-        for (auto iter = next_io_descs->begin(); iter != next_io_descs->end(); iter++)
-        {
-          if (inference_cnt == iter->second)
-          {
-            const auto input_index = next_exe->primary_subgraph().getInputs().at(i_index.value());
-            const auto info = next_exe->primary_subgraph().operands().at(input_index).info();
-
-            size_t length = _io_desc->outputs[o_index.value()]->size;
-            void *_buffer = (void *)malloc(length);
-            if (_buffer == NULL)
-            {
-              throw std::runtime_error{"malloc failed"};
-            }
-            memcpy(_buffer, _io_desc->outputs[o_index.value()]->buffer, length);
-
-            iter->first->inputs.at(i_index.value()) = std::make_unique<onert::exec::InputDesc>(
-              info, _buffer, length, onert::ir::Layout::NHWC);
-            break;
-          }
-        }
-        next_exe->asyncIoDescSemPost();
-      }
+  bool is_ready = false;
+  {
+    std::lock_guard<std::mutex> lock{_pending_mutex};
+    if (++record->num_inputs_set == record->input_buffers.size())
+    {
+      _pending_records.erase(count);
+      is_ready = true;
+    }
+  }
 
-      if (next_exes.empty())
-      {
-        std::vector<void *> results;
-        for (uint32_t i = 0; i < _io_desc->outputs.size(); i++)
-        {
-          size_t length = _io_desc->outputs[i]->size;
-          void *_buffer = (void *)malloc(length);
-          if (_buffer == NULL)
-          {
-            throw std::runtime_error{"malloc failed"};
-          }
-          memcpy(_buffer, _io_desc->outputs[i]->buffer, length);
-          results.push_back(_buffer);
-        }
-        _async_results.push_back(results);
-      }
+  if (is_ready)
+  {
+    record->ready_time = std::chrono::steady_clock::now();
+    if (!_ready_records->push(record))
+      throw std::runtime_error{"Pipeline is aborted"};
+  }
+}
 
-      for (uint32_t i = 0; i < _io_desc->inputs.size(); i++)
-      {
-        auto p = _io_desc->inputs.at(i).release();
-        if (p)
-        {
-          free((void *)p->buffer);
-          delete p;
-        }
-      }
-      for (uint32_t i = 0; i < _io_desc->outputs.size(); i++)
+void Execution::finishPipelineInput()
+{
+  {
+    std::lock_guard<std::mutex> lock{_pending_mutex};
+    assert(_num_producers > 0);
+    if (--_num_producers > 0)
+      return;
+  }
+  _ready_records->close();
+}
+
+void Execution::abortPipeline()
+{
+  if (_ready_records == nullptr)
+    return;
+
+  _ready_records->close();
+  _free_records->close();
+  if (_pipeline_results)
+    _pipeline_results->close();
+}
+
+void Execution::runPipelineRecord(PipelineRecord *record)
+{
+  using namespace std::chrono;
+
+  const auto start = steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock{_exec_mutex};
+    primary_executor()->execute(record->io_desc);
+  }
+  const auto end = steady_clock::now();
+
+  {
+    std::lock_guard<std::mutex> lock{_stats_mutex};
+    const uint64_t wait_us = duration_cast<microseconds>(start - record->ready_time).count();
+    const uint64_t run_us = duration_cast<microseconds>(end - start).count();
+    _stats.num_runs++;
+    _stats.total_wait_us += wait_us;
+    _stats.max_wait_us = std::max(_stats.max_wait_us, wait_us);
+    _stats.total_run_us += run_us;
+    _stats.max_run_us = std::max(_stats.max_run_us, run_us);
+  }
+
+  // Set inputs of next executions
+  for (const auto &next : next_exes)
+  {
+    const auto &next_exe = std::get<0>(next);
+    const auto o_index = std::get<1>(next);
+    const auto i_index = std::get<2>(next);
+
+    const auto &output = record->output_buffers.at(o_index.value());
+    next_exe->pushPipelineInput(record->count, i_index, output.data(), output.size());
+  }
+
+  if (_pipeline_results)
+  {
+    std::vector<void *> results;
+    for (const auto &output : record->output_buffers)
+    {
+      void *buffer = malloc(output.size());
+      if (buffer == nullptr)
       {
-        auto p = _io_desc->outputs.at(i).release();
-        if (p)
-        {
-          free(p->buffer);
-          delete p;
-        }
+        for (auto result : results)
+          free(result);
+        throw std::runtime_error{"malloc failed"};
       }
-      delete _io_desc;
+      memcpy(buffer, output.data(), output.size());
+      results.push_back(buffer);
+    }
+
+    if (!_pipeline_results->push(results))
+    {
+      for (auto result : results)
+        free(result);
+      throw std::runtime_error{"Pipeline is aborted"};
     }
   }
 }
 
-bool Execution::stopWait(void) const { return stop_wait; }
+void Execution::runInference()
+{
+  assert(_ready_records != nullptr);
 
-void Execution::sholudStop() { stop_wait = true; }
+  PipelineRecord *record = nullptr;
+  while (_ready_records->pop(record))
+  {
+    try
+    {
+      runPipelineRecord(record);
+    }
+    catch (const std::exception &e)
+    {
+      VERBOSE(Execution) << "Pipeline stage is stopped : " << e.what() << std::endl;
+      abortPipeline();
+      for (const auto &next : next_exes)
+        std::get<0>(next)->abortPipeline();
+      break;
+    }
+    _free_records->push(record);
+  }
+
+  // Next executions finish after running records from all of their producers
+  std::vector<Execution *> finished;
+  for (const auto &next : next_exes)
+  {
+    auto next_exe = std::get<0>(next).get();
+    if (std::find(finished.begin(), finished.end(), next_exe) != finished.end())
+      continue;
+    next_exe->finishPipelineInput();
+    finished.push_back(next_exe);
+  }
+
+  if (_pipeline_results)
+    _pipeline_results->close();
+}
+
+bool Execution::popPipelineOutput(std::vector<void *> &outputs)
+{
+  assert(_pipeline_results != nullptr);
+
+  std::vector<void *> results;
+  if (!_pipeline_results->pop(results))
+    return false;
+
+  outputs.insert(outputs.end(), results.begin(), results.end());
+  return true;
+}
+
+bool Execution::popPipelineOutput(std::vector<void *> &outputs, std::chrono::milliseconds timeout)
+{
+  assert(_pipeline_results != nullptr);
+
+  std::vector<void *> results;
+  if (!_pipeline_results->pop(results, timeout))
+    return false;
+
+  outputs.insert(outputs.end(), results.begin(), results.end());
+  return true;
+}
+
+PipelineStats Execution::pipelineStats() const
+{
+  std::lock_guard<std::mutex> lock{_stats_mutex};
+  auto stats = _stats;
+  if (_ready_records)
+  {
+    stats.ready_records = _ready_records->size();
+    stats.peak_ready_records = _ready_records->peakSize();
+  }
+  return stats;
+}
 
 } // namespace exec
 } // namespace onert
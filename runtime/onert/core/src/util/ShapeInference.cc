@@ -589,6 +589,36 @@ ir::Shape inferResizeBilinearShape(const ir::Shape &in_shape, const int32_t outp
   return ret;
 }
 
+ir::Shape inferResizeNearestNeighborShape(const ir::Shape &in_shape, const int32_t output_height,
+                                          const int32_t output_width, const ir::Layout layout)
+{
+  if (layout != ir::Layout::NCHW)
+    return inferResizeBilinearShape(in_shape, output_height, output_width);
+
+  assert(in_shape.rank() == 4);
+  if (output_height < 0)
+  {
+    throw std::runtime_error{
+      "ResizeNearestNeighbor: size value must be positive value, output_height = " +
+      std::to_string(output_height)};
+  }
+  if (output_width < 0)
+  {
+    throw std::runtime_error{
+      "ResizeNearestNeighbor: size value must be positive value, output_width = " +
+      std::to_string(output_width)};
+  }
+
+  ir::Shape ret(in_shape.rank());
+
+  ret.dim(0) = in_shape.dim(0);
+  ret.dim(1) = in_shape.dim(1);
+  ret.dim(2) = output_height;
+  ret.dim(3) = output_width;
+
+  return ret;
+}
+
 template <typename T> ir::Shape inferRangeShape(T start_val, T limit_val, T delta_val)
 {
   ir::Shape out_shape(static_cast<int>(1));
@@ -1070,6 +1100,19 @@ ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_bu
   return new_Shape;
 }
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k)
+{
+  if (in_shape.rank() < 1)
+    throw std::runtime_error("inferTopKV2Shape failed, input rank must be at least 1");
+  if (k < 0 || k > in_shape.dim(in_shape.rank() - 1))
+    throw std::runtime_error("inferTopKV2Shape failed, bad k: " + std::to_string(k));
+
+  // Both values and indices have k elements in the last dimension
+  ir::Shape out_shape = in_shape;
+  out_shape.dim(out_shape.rank() - 1) = k;
+  return out_shape;
+}
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t perm_size)
 {
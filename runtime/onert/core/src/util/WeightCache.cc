@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/WeightCache.h"
+
+#include <algorithm>
+#include <sys/stat.h>
+
+namespace onert
+{
+namespace util
+{
+
+std::string WeightCache::fileIdentity(int fd)
+{
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0)
+    return "";
+
+  return std::to_string(file_stat.st_dev) + ":" + std::to_string(file_stat.st_ino) + ":" +
+         std::to_string(file_stat.st_size) + ":" + std::to_string(file_stat.st_mtim.tv_sec) +
+         "." + std::to_string(file_stat.st_mtim.tv_nsec);
+}
+
+WeightCache &WeightCache::get()
+{
+  static WeightCache instance;
+  return instance;
+}
+
+void WeightCache::setData(const Key &key, const void *data)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto entry = _entries.find(key);
+  if (entry != _entries.end())
+    _data_keys[data] = DataKey{key, entry->second};
+}
+
+bool WeightCache::findKey(const void *data, Key &key)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto found = _data_keys.find(data);
+  if (found == _data_keys.end())
+    return false;
+
+  // Address of a freed weight may be reused by other memory
+  if (found->second.weight.expired())
+    return false;
+
+  key = found->second.key;
+  return true;
+}
+
+size_t WeightCache::size()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  sweep();
+  return _entries.size();
+}
+
+void WeightCache::sweep()
+{
+  for (auto it = _entries.begin(); it != _entries.end();)
+  {
+    if (it->second.expired())
+      it = _entries.erase(it);
+    else
+      ++it;
+  }
+  for (auto it = _data_keys.begin(); it != _data_keys.end();)
+  {
+    if (it->second.weight.expired())
+      it = _data_keys.erase(it);
+    else
+      ++it;
+  }
+  // Sweep again when the number of entries doubles
+  _sweep_size = std::max<size_t>(1024, _entries.size() * 2);
+}
+
+} // namespace util
+} // namespace onert
@@ -33,6 +33,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include <util/logging.h>
+#include <util/WeightCache.h>
 
 namespace onert
 {
@@ -141,6 +142,7 @@ private:
   void loadGather(const Operator *op, ir::Graph &subg);
   void loadIf(const Operator *op, ir::Graph &subg);
   void loadLeakyRelu(const Operator *op, ir::Graph &subg);
+  void loadLocalResponseNormalization(const Operator *op, ir::Graph &subg);
   void loadLogSoftmax(const Operator *op, ir::Graph &subg);
   void loadDetectionPostProcess(const Operator *op, ir::Graph &subg);
   void loadOneHot(const Operator *op, ir::Graph &subg);
@@ -158,6 +160,7 @@ private:
   void loadSplitV(const Operator *op, ir::Graph &subg);
   void loadSqueeze(const Operator *op, ir::Graph &subg);
   void loadStridedSlice(const Operator *op, ir::Graph &subg);
+  void loadTopKV2(const Operator *op, ir::Graph &subg);
   void loadTransposeConv(const Operator *op, ir::Graph &subg);
   void loadUnidirectionalSequenceLSTM(const Operator *op, ir::Graph &subg);
   void loadUnpack(const Operator *op, ir::Graph &subg);
@@ -188,6 +191,8 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Identity of the loaded file to share constants in util::WeightCache, or empty not to share
+  std::string _file_identity;
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
@@ -217,6 +222,12 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
     throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
   }
 
+  // Sessions of the same file share constants
+  if (util::getConfigBool(util::config::SHARE_WEIGHTS))
+  {
+    _file_identity = util::WeightCache::fileIdentity(_fd);
+  }
+
   _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
 
   loadModel();
@@ -368,22 +379,39 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
         // was already created. Let's reuse the Data
         data_obj = buffer_found->second;
       }
-      else if (_use_mmaped_data)
-      {
-        data_obj = std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
-                                                    unaligned_offset_start, data_size);
-        _buf_to_data[buf_idx] = data_obj;
-      }
       else
       {
-        size_t offset = unaligned_offset_start - aligned_offset_start;
-        uint8_t *mmap_base = static_cast<uint8_t *>(
-          mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
-
-        data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
+        std::function<std::shared_ptr<ir::Data>()> create_data = [&]() {
+          if (_use_mmaped_data)
+          {
+            return std::shared_ptr<ir::Data>{std::make_shared<ir::MMapedData>(
+              _fd, aligned_offset_start, mmap_size, unaligned_offset_start, data_size)};
+          }
+
+          size_t offset = unaligned_offset_start - aligned_offset_start;
+          uint8_t *mmap_base = static_cast<uint8_t *>(
+            mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
+
+          auto cached_data = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
+
+          munmap(mmap_base, mmap_size);
+          return std::shared_ptr<ir::Data>{cached_data};
+        };
+
+        // Other sessions of the same file may have loaded this buffer already
+        if (_file_identity.empty())
+        {
+          data_obj = create_data();
+        }
+        else
+        {
+          auto &cache = util::WeightCache::get();
+          const auto key = util::WeightCache::bufferKey(_file_identity, buf_idx);
+          data_obj = cache.getOrCreate<ir::Data>(key, create_data);
+          // Backends find the key from the data to share weights derived from it
+          cache.setData(key, data_obj->base());
+        }
         _buf_to_data[buf_idx] = data_obj;
-
-        munmap(mmap_base, mmap_size);
       }
     }
     subg.setOperandValue(operand_index, std::move(data_obj));
@@ -657,6 +685,26 @@ void BaseLoader<LoaderDomain>::loadTransposeConv(const Operator *op, ir::Graph &
   loadOperationTo<ir::operation::TransposeConv>(op, subg, param);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadTopKV2(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  // k is a param of TopKV2 in IR
+  const auto &k = subg.operands().at(inputs.at(1));
+  if (!k.isConstant())
+    throw std::runtime_error("TopKV2: non-constant 'k' is not supported");
+
+  ir::operation::TopKV2::Param param;
+  param.k = k.asScalar<int32_t>();
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::TopKV2({inputs.at(0)}, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadPool2D(const Operator *op, ir::Graph &subg,
                                           ir::operation::Pool2D::PoolType op_type)
@@ -850,6 +898,7 @@ void BaseLoader<LoaderDomain>::loadResizeNearestNeighbor(const Operator *op, ir:
 {
   ir::operation::ResizeNearestNeighbor::Param param;
   param.align_corners = op->builtin_options_as_ResizeNearestNeighborOptions()->align_corners();
+  param.layout = ir::Layout::NHWC;
 
   loadOperationTo<ir::operation::ResizeNearestNeighbor>(op, subg, param);
 }
@@ -1323,6 +1372,19 @@ void BaseLoader<LoaderDomain>::loadArgMinMax(const Operator *op, ir::Graph &subg
   loadOperationTo<ir::operation::ArgMinMax>(op, subg, param);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadLocalResponseNormalization(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::LocalResponseNormalization::Param param;
+  const auto *options = op->builtin_options_as_LocalResponseNormalizationOptions();
+  param.radius = options->radius();
+  param.bias = options->bias();
+  param.alpha = options->alpha();
+  param.beta = options->beta();
+
+  loadOperationTo<ir::operation::LocalResponseNormalization>(op, subg, param);
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadLogSoftmax(const Operator *op, ir::Graph &subg)
 {
@@ -1621,12 +1683,18 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_TILE:
       loadOperationTo<ir::operation::Tile>(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_TOPK_V2:
+      loadTopKV2(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_RANGE:
       loadOperationTo<ir::operation::Range>(op, subg);
       return;
     case BuiltinOperator::BuiltinOperator_BATCH_MATMUL:
       loadBatchMatMul(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_LOCAL_RESPONSE_NORMALIZATION:
+      loadLocalResponseNormalization(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_LOG_SOFTMAX:
       loadLogSoftmax(op, subg);
       return;
@@ -18,6 +18,7 @@
 #include "NNAPIConvert.h"
 
 #include <ir/Operations.Include.h>
+#include <cmath>
 #include <string.h>
 
 namespace
@@ -973,15 +974,35 @@ OperationFactory::OperationFactory()
     // Each input should be interpreted as follows:
     //
     //  0 -> IFM Index
-    //  1 -> Height Index
-    //  2 -> Width Index
+    //  1 -> Height Index, or height scale if it is float
+    //  2 -> Width Index, or width scale if it is float
+    //  3 -> Layout Index, which is true for NCHW (optional)
     OperandIndexSequence inputs{init_param.inputs[0]};
 
     operation::ResizeNearestNeighbor::Param param;
-    param.height_out = operands.at(OperandIndex{init_param.inputs[1]}).asScalar<int32_t>();
-    param.width_out = operands.at(OperandIndex{init_param.inputs[2]}).asScalar<int32_t>();
     param.align_corners = false;
-    // The layout input is not supported yet
+    param.layout = Layout::NHWC;
+    if (init_param.input_count == 4 &&
+        operands.at(OperandIndex{init_param.inputs[3]}).asScalar<bool>())
+      param.layout = Layout::NCHW;
+
+    const auto &height = operands.at(OperandIndex{init_param.inputs[1]});
+    const auto &width = operands.at(OperandIndex{init_param.inputs[2]});
+    if (height.typeInfo().type() == DataType::FLOAT32)
+    {
+      // Output size is floor of input size times scale
+      const auto &ifm_shape = operands.at(OperandIndex{init_param.inputs[0]}).shape();
+      const auto height_axis = (param.layout == Layout::NCHW) ? 2 : 1;
+      param.height_out =
+        static_cast<int32_t>(std::floor(ifm_shape.dim(height_axis) * height.asScalar<float>()));
+      param.width_out =
+        static_cast<int32_t>(std::floor(ifm_shape.dim(height_axis + 1) * width.asScalar<float>()));
+    }
+    else
+    {
+      param.height_out = height.asScalar<int32_t>();
+      param.width_out = width.asScalar<int32_t>();
+    }
     return new operation::ResizeNearestNeighbor{inputs, outputs, param};
   };
 
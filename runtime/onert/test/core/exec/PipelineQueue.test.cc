@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineQueue.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(PipelineQueue, push_pop)
+{
+  PipelineQueue<int> queue(2);
+  ASSERT_TRUE(queue.push(1));
+  ASSERT_TRUE(queue.push(2));
+  ASSERT_EQ(queue.size(), 2);
+  ASSERT_EQ(queue.peakSize(), 2);
+
+  int item = 0;
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 1);
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 2);
+  ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(PipelineQueue, backpressure)
+{
+  PipelineQueue<int> queue(1);
+  std::vector<int> items;
+  std::thread consumer([&] {
+    int item = 0;
+    while (queue.pop(item))
+      items.push_back(item);
+  });
+
+  for (int i = 0; i < 100; i++)
+    ASSERT_TRUE(queue.push(i));
+  queue.close();
+  consumer.join();
+
+  ASSERT_EQ(items.size(), 100);
+  for (int i = 0; i < 100; i++)
+    ASSERT_EQ(items[i], i);
+  // Queue never holds more than its capacity
+  ASSERT_EQ(queue.peakSize(), 1);
+}
+
+TEST(PipelineQueue, pop_timeout)
+{
+  PipelineQueue<int> queue(1);
+  int item = 0;
+  ASSERT_FALSE(queue.pop(item, std::chrono::milliseconds(1)));
+}
+
+TEST(PipelineQueue, neg_push_after_close)
+{
+  PipelineQueue<int> queue(1);
+  ASSERT_TRUE(queue.push(1));
+  queue.close();
+  ASSERT_TRUE(queue.closed());
+  ASSERT_FALSE(queue.push(2));
+
+  // Remaining item can be popped after close
+  int item = 0;
+  ASSERT_TRUE(queue.pop(item));
+  ASSERT_EQ(item, 1);
+  ASSERT_FALSE(queue.pop(item));
+}
+
+TEST(PipelineQueue, neg_close_wakes_blocked_push)
+{
+  PipelineQueue<int> queue(1);
+  ASSERT_TRUE(queue.push(1));
+
+  bool pushed = true;
+  std::thread producer([&] { pushed = queue.push(2); });
+  queue.close();
+  producer.join();
+
+  ASSERT_FALSE(pushed);
+}
+
+} // namespace
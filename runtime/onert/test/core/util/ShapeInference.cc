@@ -543,3 +543,49 @@ TEST(ShapeInference, BCQGather)
     check(indices_shape, cluster_shape, cluster, hidden_size, axis, rank, expected);
   }
 }
+
+TEST(ShapeInference, TopKV2)
+{
+  Shape in_shape{2, 3, 10};
+
+  auto infered_out_shape = onert::shape_inference::inferTopKV2Shape(in_shape, 4);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 4);
+}
+
+TEST(ShapeInference, neg_TopKV2)
+{
+  Shape in_shape{2, 3, 10};
+
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, 11), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, -1), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(Shape{}, 1), std::runtime_error);
+}
+
+TEST(ShapeInference, ResizeNearestNeighbor)
+{
+  Shape in_shape{2, 4, 6, 3};
+
+  auto infered_out_shape =
+    onert::shape_inference::inferResizeNearestNeighborShape(in_shape, 8, 5, Layout::NHWC);
+  ASSERT_EQ(infered_out_shape, (Shape{2, 8, 5, 3}));
+
+  infered_out_shape =
+    onert::shape_inference::inferResizeNearestNeighborShape(in_shape, 8, 5, Layout::NCHW);
+  ASSERT_EQ(infered_out_shape, (Shape{2, 4, 8, 5}));
+}
+
+TEST(ShapeInference, neg_ResizeNearestNeighbor)
+{
+  Shape in_shape{2, 4, 6, 3};
+
+  ASSERT_THROW(
+    onert::shape_inference::inferResizeNearestNeighborShape(in_shape, -1, 5, Layout::NCHW),
+    std::runtime_error);
+  ASSERT_THROW(
+    onert::shape_inference::inferResizeNearestNeighborShape(in_shape, 8, -1, Layout::NCHW),
+    std::runtime_error);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/WeightCache.h"
+
+#include <vector>
+
+using onert::util::WeightCache;
+
+TEST(WeightCache, share_while_alive)
+{
+  auto &cache = WeightCache::get();
+  const auto key = WeightCache::bufferKey("test:share_while_alive", 3);
+  int created = 0;
+  auto factory = [&]() {
+    ++created;
+    return std::make_shared<int>(42);
+  };
+
+  auto first = cache.getOrCreate<int>(key, factory);
+  auto second = cache.getOrCreate<int>(key, factory);
+  ASSERT_EQ(created, 1);
+  ASSERT_EQ(first.get(), second.get());
+
+  // A different buffer of the same file is another weight
+  auto other = cache.getOrCreate<int>(WeightCache::bufferKey("test:share_while_alive", 4), factory);
+  ASSERT_EQ(created, 2);
+  ASSERT_NE(first.get(), other.get());
+
+  // Freed with the last holder, and created again afterwards
+  first.reset();
+  second.reset();
+  auto third = cache.getOrCreate<int>(key, factory);
+  ASSERT_EQ(created, 3);
+  ASSERT_EQ(*third, 42);
+}
+
+TEST(WeightCache, expire_freed_weights)
+{
+  auto &cache = WeightCache::get();
+  const auto base = cache.size();
+  {
+    auto weight = cache.getOrCreate<int>(WeightCache::bufferKey("test:expire", 0),
+                                         []() { return std::make_shared<int>(1); });
+    ASSERT_EQ(cache.size(), base + 1);
+  }
+  ASSERT_EQ(cache.size(), base);
+}
+
+TEST(WeightCache, derived_key_of_source)
+{
+  const auto source = WeightCache::bufferKey("test:derived_key", 1);
+
+  ASSERT_TRUE(WeightCache::derivedKey(source, "t") == WeightCache::derivedKey(source, "t"));
+  ASSERT_FALSE(WeightCache::derivedKey(source, "t") == WeightCache::derivedKey(source, "u"));
+  ASSERT_FALSE(WeightCache::derivedKey(source, "t") ==
+               WeightCache::derivedKey(WeightCache::bufferKey("test:derived_key", 2), "t"));
+  ASSERT_FALSE(WeightCache::derivedKey(source, "t") == source);
+}
+
+TEST(WeightCache, find_key_of_data)
+{
+  auto &cache = WeightCache::get();
+  const auto key = WeightCache::bufferKey("test:find_key", 0);
+  auto weight = cache.getOrCreate<const std::vector<float>>(
+    key, []() { return std::make_shared<const std::vector<float>>(4, 1.f); });
+  cache.setData(key, weight->data());
+
+  WeightCache::Key found;
+  ASSERT_TRUE(cache.findKey(weight->data(), found));
+  ASSERT_TRUE(found == key);
+}
+
+TEST(WeightCache, neg_find_key_of_freed_data)
+{
+  auto &cache = WeightCache::get();
+  const auto key = WeightCache::bufferKey("test:neg_find_key", 0);
+  auto weight = cache.getOrCreate<const std::vector<float>>(
+    key, []() { return std::make_shared<const std::vector<float>>(4, 1.f); });
+  const void *data = weight->data();
+  cache.setData(key, data);
+  weight.reset();
+
+  WeightCache::Key found;
+  ASSERT_FALSE(cache.findKey(data, found));
+
+  // Data not loaded through the cache has no key
+  const std::vector<float> local(4, 1.f);
+  ASSERT_FALSE(cache.findKey(local.data(), found));
+}
@@ -68,6 +68,14 @@ uint32_t CircleGen::addTensor(const TensorParams &params, const SparsityParams &
   return ind;
 }
 
+uint32_t CircleGen::addTensor(const TensorParams &params, float scale, int64_t zero_point,
+                              const SparsityParams &sp)
+{
+  uint32_t ind = curSubgCtx().tensors.size();
+  curSubgCtx().tensors.emplace_back(buildTensor(params, scale, zero_point, sp));
+  return ind;
+}
+
 void CircleGen::setInputsAndOutputs(const std::vector<int> &inputs, const std::vector<int> &outputs)
 {
   curSubgCtx().inputs = inputs;
@@ -666,6 +674,21 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
                               0 /* shape_signature */);
 }
 
+flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &params, float scale,
+                                                           int64_t zero_point,
+                                                           const SparsityParams &sp)
+{
+  auto shape = _fbb.CreateVector(params.shape);
+  auto name = _fbb.CreateString(params.name);
+  std::vector<float> scale_vector = {scale};
+  std::vector<int64_t> zero_point_vector = {zero_point};
+  auto quantization = circle::CreateQuantizationParametersDirect(_fbb, nullptr, nullptr,
+                                                                 &scale_vector, &zero_point_vector);
+  auto sparsity = buildSparsityParameters(sp);
+  return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name, quantization,
+                              false /* is_variable */, sparsity, 0 /* shape_signature */);
+}
+
 flatbuffers::Offset<circle::SubGraph> CircleGen::buildSubGraph(const SubgraphContext &ctx)
 {
   return circle::CreateSubGraphDirect(_fbb, &ctx.tensors, &ctx.inputs, &ctx.outputs, &ctx.operators,
@@ -131,6 +131,8 @@ public:
   uint32_t addTensor(const TensorParams &params, std::vector<float> &scale,
                      std::vector<int64_t> &zero_point);
   uint32_t addTensor(const TensorParams &params, const SparsityParams &sp);
+  uint32_t addTensor(const TensorParams &params, float scale, int64_t zero_point,
+                     const SparsityParams &sp);
   void setInputsAndOutputs(const std::vector<int> &inputs, const std::vector<int> &outputs);
   uint32_t nextSubgraph();
   CircleBuffer finish();
@@ -244,6 +246,8 @@ private:
   flatbuffers::Offset<circle::SparsityParameters> buildSparsityParameters(const SparsityParams &sp);
   flatbuffers::Offset<circle::Tensor> buildTensor(const TensorParams &params,
                                                   const SparsityParams &sp);
+  flatbuffers::Offset<circle::Tensor> buildTensor(const TensorParams &params, float scale,
+                                                  int64_t zero_point, const SparsityParams &sp);
   flatbuffers::Offset<circle::SubGraph> buildSubGraph(const SubgraphContext &ctx);
 
   SubgraphContext &curSubgCtx() { return _subgraph_contexts.back(); }
@@ -19,8 +19,52 @@
 
 #include "nnfw_internal.h"
 
+#include <poll.h>
+#include <vector>
+
 using ValidationTestAddModelLoaded = ValidationTestModelLoaded<NNPackages::ADD>;
 
+namespace
+{
+
+// Submit inferences of inputs 0, 1, ... at once, and check outputs of all completions
+void submitAndWait(nnfw_session *session, uint32_t num_requests)
+{
+  std::vector<float> inputs(num_requests);
+  std::vector<float> outputs(num_requests);
+  for (uint32_t i = 0; i < num_requests; i++)
+  {
+    inputs[i] = i;
+    const void *input = &inputs[i];
+    void *output = &outputs[i];
+    size_t length = sizeof(float);
+    uint64_t id = 0;
+    NNFW_ENSURE_SUCCESS(nnfw_submit(session, &input, &length, &output, &length, &id));
+  }
+
+  int fd = -1;
+  NNFW_ENSURE_SUCCESS(nnfw_completion_fd(session, &fd));
+
+  uint32_t num_completed = 0;
+  while (num_completed < num_requests)
+  {
+    struct pollfd pfd = {fd, POLLIN, 0};
+    ASSERT_EQ(poll(&pfd, 1, 10000), 1);
+
+    std::vector<nnfw_completion> completions(num_requests);
+    uint32_t count = 0;
+    NNFW_ENSURE_SUCCESS(nnfw_poll_completions(session, completions.data(), num_requests, &count));
+    for (uint32_t i = 0; i < count; i++)
+      EXPECT_EQ(completions[i].status, NNFW_STATUS_NO_ERROR);
+    num_completed += count;
+  }
+
+  for (uint32_t i = 0; i < num_requests; i++)
+    ASSERT_FLOAT_EQ(outputs[i], i + 2.0);
+}
+
+} // namespace
+
 TEST_F(ValidationTestAddModelLoaded, prepare_001)
 {
   NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
@@ -28,6 +72,54 @@ TEST_F(ValidationTestAddModelLoaded, prepare_001)
   SUCCEED();
 }
 
+TEST_F(ValidationTestAddModelLoaded, prepare_batching_submit_full_batch)
+{
+  // Requests are batched as soon as the largest batch is queued, long before the delay
+  const uint32_t batch_sizes[] = {2, 4};
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_batching(_session, batch_sizes, 2, 1000000));
+
+  constexpr uint32_t num_requests = 4;
+  ASSERT_NO_FATAL_FAILURE(submitAndWait(_session, num_requests));
+
+  nnfw_batching_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_batching_stats(_session, &stats));
+  ASSERT_EQ(stats.num_requests, num_requests);
+  ASSERT_EQ(stats.num_batches, 1);
+  ASSERT_EQ(stats.max_batch_size, 4);
+  ASSERT_EQ(stats.queued_requests, 0);
+}
+
+TEST_F(ValidationTestAddModelLoaded, prepare_batching_submit_partial_batch)
+{
+  // After the delay, 3 queued requests run as a batch of 2 and a single one
+  const uint32_t batch_sizes[] = {2, 4};
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_batching(_session, batch_sizes, 2, 100000));
+
+  constexpr uint32_t num_requests = 3;
+  ASSERT_NO_FATAL_FAILURE(submitAndWait(_session, num_requests));
+
+  nnfw_batching_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_get_batching_stats(_session, &stats));
+  ASSERT_EQ(stats.num_requests, num_requests);
+  ASSERT_EQ(stats.num_batches, 2);
+  ASSERT_EQ(stats.max_batch_size, 2);
+  ASSERT_EQ(stats.queued_requests, 0);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_prepare_batching_zero_batch_size)
+{
+  const uint32_t batch_sizes[] = {0};
+  ASSERT_EQ(nnfw_prepare_batching(_session, batch_sizes, 1, 1000), NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_get_batching_stats_without_batching)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  nnfw_batching_stats stats;
+  ASSERT_EQ(nnfw_get_batching_stats(_session, &stats), NNFW_STATUS_INVALID_STATE);
+}
+
 TEST_F(ValidationTestAddModelLoaded, set_available_backends_001)
 {
   NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
@@ -17,6 +17,9 @@
 #include "fixtures.h"
 #include "NNPackages.h"
 
+#include <atomic>
+#include <poll.h>
+
 using ValidationTestAddSessionPrepared = ValidationTestSessionPrepared<NNPackages::ADD>;
 
 TEST_F(ValidationTestAddSessionPrepared, run)
@@ -70,6 +73,91 @@ TEST_F(ValidationTestAddSessionPrepared, run_async)
   ASSERT_FLOAT_EQ(_output[0], 5.0);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, submit_poll_completions)
+{
+  constexpr uint32_t num_requests = 8;
+  std::vector<float> inputs(num_requests);
+  std::vector<float> outputs(num_requests);
+  std::vector<uint64_t> ids(num_requests);
+  for (uint32_t i = 0; i < num_requests; i++)
+  {
+    inputs[i] = i;
+    const void *input = &inputs[i];
+    void *output = &outputs[i];
+    size_t length = sizeof(float);
+    NNFW_ENSURE_SUCCESS(nnfw_submit(_session, &input, &length, &output, &length, &ids[i]));
+  }
+
+  int fd = -1;
+  NNFW_ENSURE_SUCCESS(nnfw_completion_fd(_session, &fd));
+
+  uint32_t num_completed = 0;
+  while (num_completed < num_requests)
+  {
+    struct pollfd pfd = {fd, POLLIN, 0};
+    ASSERT_EQ(poll(&pfd, 1, 10000), 1);
+
+    nnfw_completion completions[num_requests];
+    uint32_t count = 0;
+    NNFW_ENSURE_SUCCESS(nnfw_poll_completions(_session, completions, num_requests, &count));
+    for (uint32_t i = 0; i < count; i++)
+    {
+      // Inferences of a session are completed in order of submission
+      EXPECT_EQ(completions[i].request_id, ids[num_completed]);
+      EXPECT_EQ(completions[i].status, NNFW_STATUS_NO_ERROR);
+      num_completed++;
+    }
+  }
+
+  for (uint32_t i = 0; i < num_requests; i++)
+    ASSERT_FLOAT_EQ(outputs[i], i + 2.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, submit_completion_callback)
+{
+  std::atomic<uint32_t> num_completed{0};
+  auto callback = [](uint64_t, NNFW_STATUS status, void *user_data) {
+    if (status == NNFW_STATUS_NO_ERROR)
+      (*reinterpret_cast<std::atomic<uint32_t> *>(user_data))++;
+  };
+  NNFW_ENSURE_SUCCESS(nnfw_set_completion_callback(_session, callback, &num_completed));
+
+  float input = 3.0;
+  float output = 0;
+  const void *input_ptr = &input;
+  void *output_ptr = &output;
+  size_t length = sizeof(float);
+  uint64_t id = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_submit(_session, &input_ptr, &length, &output_ptr, &length, &id));
+
+  // Closing session waits for submitted inferences
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session));
+  _session = nullptr;
+
+  ASSERT_EQ(num_completed, 1);
+  ASSERT_FLOAT_EQ(output, 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_submit_small_buffer)
+{
+  float input = 3.0;
+  char output[1];
+  const void *input_ptr = &input;
+  void *output_ptr = output;
+  size_t input_length = sizeof(float);
+  size_t output_length = sizeof(output);
+  uint64_t id = 0;
+  ASSERT_EQ(nnfw_submit(_session, &input_ptr, &input_length, &output_ptr, &output_length, &id),
+            NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_poll_completions_null)
+{
+  nnfw_completion completion;
+  ASSERT_EQ(nnfw_poll_completions(_session, &completion, 1, nullptr),
+            NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_input_001)
 {
   char input[32];
@@ -149,6 +149,41 @@ TEST_F(GenModelTest, OneOp_FullyConnected16x1Sparse)
   SUCCEED();
 }
 
+TEST_F(GenModelTest, OneOp_FullyConnected16x1Sparse_I8)
+{
+  CircleGen cgen;
+  // clang-format off
+  std::vector<int8_t> weight_data{ 1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4,
+                                   1, -1, 2, 1, 1, -1, 2, 1, 1, -1, 2, 1, 1, -1, 2, 1};
+  std::vector<int32_t> bias_data{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+  // clang-format on
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT8}, 1.0, -1);
+  CircleGen::SparsityParams sp{
+    {0, 1, 2, 3},
+    {0, 1},
+    {{CircleGen::SparseDimensionType::DimensionType_DENSE, 1},
+     {CircleGen::SparseDimensionType::DimensionType_SPARSE_CSR, {0, 2}, {0, 3}},
+     {CircleGen::SparseDimensionType::DimensionType_DENSE, 16},
+     {CircleGen::SparseDimensionType::DimensionType_DENSE, 1}}};
+  // Loader keeps int8 weights of int8 FC as asymmetric with zero point 0
+  int weight =
+    cgen.addTensor({{16, 4}, circle::TensorType::TensorType_INT8, weight_buf}, 1.0, 0, sp);
+  int bias = cgen.addTensor({{16}, circle::TensorType::TensorType_INT32, bias_buf}, 1.0, 0);
+  int output = cgen.addTensor({{1, 16}, circle::TensorType::TensorType_INT8}, 1.0, 2);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Real input {1, 3, 2, 1} and output {2, 1, 5, 5, ..., 6}, shifted by zero points
+  _context->addTestCase(
+    uniformTCD<int8_t>({{0, 2, 1, 0}}, {{4, 3, 7, 7, 4, 3, 7, 7, 4, 3, 7, 7, 4, 3, 7, 8}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 TEST_F(GenModelTest, OneOp_FullyConnected_OptionalBias)
 {
   CircleGen cgen;
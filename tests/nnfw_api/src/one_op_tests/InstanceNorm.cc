@@ -31,7 +31,7 @@ TEST_F(GenModelTest, OneOp_InstanceNorm)
 
   _context = std::make_unique<GenModelTestContext>(cgen.finish());
   _context->addTestCase(uniformTCD<float>({{1, 1, 1, 1}}, {{2, 2, 2, 2}}));
-  _context->setBackends({"acl_cl", "acl_neon"});
+  _context->setBackends({"acl_cl", "acl_neon", "cpu"});
 
   SUCCEED();
 }
@@ -189,6 +189,20 @@ void Args::Initialize(void)
     }
   };
 
+  auto process_load_mode = [&](const std::string &load_mode) {
+    if (load_mode.empty())
+      _load_mode = LoadMode::NONE;
+    else if (load_mode == "closed")
+      _load_mode = LoadMode::CLOSED;
+    else if (load_mode == "open")
+      _load_mode = LoadMode::OPEN;
+    else
+    {
+      std::cerr << "Invalid load_mode \"" << load_mode << "\": use 'closed' or 'open'\n";
+      exit(1);
+    }
+  };
+
   // General options
   po::options_description general("General options", 100);
 
@@ -234,6 +248,17 @@ void Args::Initialize(void)
          "0: prints the only result. Messages btw run don't print\n"
          "1: prints result and message btw run\n"
          "2: prints all of messages to print\n")
+    ("load_mode", po::value<std::string>()->default_value("")->notifier(process_load_mode),
+         "Run requests of 'num_runs' over 'num_sessions' sessions concurrently, and report latency percentiles\n"
+         "'closed': each session runs a next request as soon as its previous one completes\n"
+         "          after 'run_delay' if given\n"
+         "'open': requests arrive at 'target_qps' in Poisson process, and latency includes queueing\n")
+    ("num_sessions", po::value<int>()->default_value(1)->notifier([&](const auto &v) { _num_sessions = v; }),
+         "The number of sessions running in their own threads for 'load_mode'")
+    ("target_qps", po::value<double>()->default_value(0.0)->notifier([&](const auto &v) { _target_qps = v; }),
+         "The mean arrival rate of requests per second for 'load_mode open'")
+    ("sample_interval", po::value<int>()->default_value(100)->notifier([&](const auto &v) { _sample_interval = v; }),
+         "Interval(ms) of sampling qps, cpu utilization and rss for 'load_mode'")
     ;
   // clang-format on
 
@@ -288,6 +313,20 @@ void Args::Parse(const int argc, char **argv)
     exit(1);
   }
 
+  if (_load_mode != LoadMode::NONE)
+  {
+    if (_num_sessions < 1 || _sample_interval < 1)
+    {
+      std::cerr << "'num_sessions' and 'sample_interval' must be positive\n";
+      exit(1);
+    }
+    if (_load_mode == LoadMode::OPEN && _target_qps <= 0.0)
+    {
+      std::cerr << "'load_mode open' needs positive 'target_qps'\n";
+      exit(1);
+    }
+  }
+
   // This must be run after `notify` as `_warm_up_runs` must have been processed before.
   if (vm.count("mem_poll"))
   {
@@ -40,6 +40,13 @@ enum class WhenToUseH5Shape
 };
 #endif
 
+enum class LoadMode
+{
+  NONE,   // Run one session in sequence
+  CLOSED, // Sessions run next requests as soon as previous ones complete
+  OPEN,   // Requests arrive at target qps regardless of completions
+};
+
 class Args
 {
 public:
@@ -65,6 +72,10 @@ public:
   /// @brief Return true if "--shape_run" or "--shape_prepare" is provided
   bool shapeParamProvided();
   const int getVerboseLevel(void) const { return _verbose_level; }
+  LoadMode getLoadMode(void) const { return _load_mode; }
+  const int getNumSessions(void) const { return _num_sessions; }
+  const double getTargetQps(void) const { return _target_qps; }
+  const int getSampleInterval(void) const { return _sample_interval; }
 
 private:
   void Initialize();
@@ -91,6 +102,10 @@ private:
   bool _write_report;
   bool _print_version = false;
   int _verbose_level;
+  LoadMode _load_mode = LoadMode::NONE;
+  int _num_sessions;
+  double _target_qps;
+  int _sample_interval;
 };
 
 } // end of namespace nnpkg_run
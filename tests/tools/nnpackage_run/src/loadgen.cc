@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "allocation.h"
+#include "benchmark/LoadMonitor.h"
+#include "nnfw.h"
+#include "nnfw_util.h"
+#include "randomgen.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t toUs(Clock::duration duration)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+} // namespace
+
+namespace nnpkg_run
+{
+
+// Session prepared to run with random inputs
+class LoadSession
+{
+public:
+  LoadSession(Args &args)
+  {
+    NNPR_ENSURE_STATUS(nnfw_create_session(&_session));
+    NNPR_ENSURE_STATUS(nnfw_load_model_from_file(_session, args.getPackageFilename().c_str()));
+
+    char *available_backends = std::getenv("BACKENDS");
+    if (available_backends)
+      NNPR_ENSURE_STATUS(nnfw_set_available_backends(_session, available_backends));
+
+    set_tensorinfo(_session, args.getShapeMapForPrepare());
+    NNPR_ENSURE_STATUS(nnfw_prepare(_session));
+    set_tensorinfo(_session, args.getShapeMapForRun());
+
+    uint32_t num_inputs = 0;
+    NNPR_ENSURE_STATUS(nnfw_input_size(_session, &num_inputs));
+    _inputs = std::vector<Allocation>(num_inputs);
+    RandomGenerator(_session).generate(_inputs);
+
+    uint32_t num_outputs = 0;
+    NNPR_ENSURE_STATUS(nnfw_output_size(_session, &num_outputs));
+    _outputs = std::vector<Allocation>(num_outputs);
+    auto output_sizes = args.getOutputSizes();
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(_session, i, &ti));
+      auto found = output_sizes.find(i);
+      uint64_t output_size_in_bytes =
+        (found == output_sizes.end()) ? bufsize_for(&ti) : found->second;
+      _outputs[i].alloc(output_size_in_bytes);
+      NNPR_ENSURE_STATUS(
+        nnfw_set_output(_session, i, ti.dtype, _outputs[i].data(), output_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_output_layout(_session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+  }
+
+  ~LoadSession() { nnfw_close_session(_session); }
+
+  void run() { NNPR_ENSURE_STATUS(nnfw_run(_session)); }
+
+private:
+  nnfw_session *_session = nullptr;
+  std::vector<Allocation> _inputs;
+  std::vector<Allocation> _outputs;
+};
+
+benchmark::LoadResult runLoad(Args &args)
+{
+  const auto mode = args.getLoadMode();
+  const uint32_t num_sessions = args.getNumSessions();
+  const uint32_t num_requests = std::max(args.getNumRuns(), 0);
+
+  // Sessions are prepared one by one not to disturb each other
+  std::vector<std::unique_ptr<LoadSession>> sessions;
+  for (uint32_t s = 0; s < num_sessions; ++s)
+  {
+    sessions.emplace_back(new LoadSession(args));
+    for (int w = 0; w < args.getWarmupRuns(); ++w)
+      sessions.back()->run();
+  }
+
+  // Arrivals of open loop from the start, of which intervals are exponentially distributed
+  std::vector<Clock::duration> arrivals;
+  if (mode == LoadMode::OPEN)
+  {
+    std::mt19937_64 engine{1};
+    std::exponential_distribution<double> interval{args.getTargetQps()};
+    double arrival = 0.0;
+    for (uint32_t r = 0; r < num_requests; ++r)
+    {
+      arrivals.emplace_back(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(arrival)));
+      arrival += interval(engine);
+    }
+  }
+
+  std::vector<uint64_t> latencies(num_requests);
+  std::atomic<uint32_t> next_request{0};
+  benchmark::LoadMonitor monitor{std::chrono::milliseconds(args.getSampleInterval())};
+  const auto run_delay = std::chrono::microseconds(std::max(args.getRunDelay(), 0));
+
+  monitor.start();
+  const auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (uint32_t s = 0; s < num_sessions; ++s)
+  {
+    workers.emplace_back([&, s]() {
+      auto &session = *sessions[s];
+      for (uint32_t r = next_request++; r < num_requests; r = next_request++)
+      {
+        // Open loop measures from the arrival, which includes waiting for a free session
+        Clock::time_point issued;
+        if (mode == LoadMode::OPEN)
+        {
+          issued = start + arrivals[r];
+          std::this_thread::sleep_until(issued);
+        }
+        else
+        {
+          if (r >= num_sessions && run_delay.count() > 0)
+            std::this_thread::sleep_for(run_delay);
+          issued = Clock::now();
+        }
+
+        session.run();
+        latencies[r] = toUs(Clock::now() - issued);
+        monitor.complete();
+      }
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+  const double duration = toUs(Clock::now() - start) / 1e6;
+  monitor.stop();
+
+  benchmark::LoadResult result{latencies, duration, monitor.samples()};
+  result.mode = (mode == LoadMode::OPEN) ? "open" : "closed";
+  result.num_sessions = num_sessions;
+  result.target_qps = (mode == LoadMode::OPEN) ? args.getTargetQps() : 0.0;
+  return result;
+}
+
+} // end of namespace nnpkg_run
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_LOADGEN_H__
+#define __NNPACKAGE_RUN_LOADGEN_H__
+
+#include "args.h"
+#include "benchmark/LoadResult.h"
+
+namespace nnpkg_run
+{
+
+/**
+ * @brief Run requests of '--num_runs' over '--num_sessions' sessions of their own threads in
+ *        '--load_mode', with random inputs
+ */
+benchmark::LoadResult runLoad(Args &args);
+
+} // end of namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_LOADGEN_H__
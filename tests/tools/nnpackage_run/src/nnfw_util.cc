@@ -17,6 +17,7 @@
 #include <cassert>
 #include <string>
 #include "nnfw.h"
+#include "nnfw_util.h"
 
 namespace nnpkg_run
 {
@@ -45,4 +46,41 @@ uint64_t bufsize_for(const nnfw_tensorinfo *ti)
   return elmsize[ti->dtype] * num_elems(ti);
 }
 
+void set_tensorinfo(nnfw_session *session,
+                    const std::unordered_map<uint32_t, TensorShape> &shape_map)
+{
+  for (auto tensor_shape : shape_map)
+  {
+    auto ind = tensor_shape.first;
+    auto &shape = tensor_shape.second;
+    nnfw_tensorinfo ti;
+    // to fill dtype
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
+
+    bool set_input = false;
+    if (ti.rank != shape.size())
+    {
+      set_input = true;
+    }
+    else
+    {
+      for (int i = 0; i < ti.rank; i++)
+      {
+        if (ti.dims[i] != shape.at(i))
+        {
+          set_input = true;
+          break;
+        }
+      }
+    }
+    if (!set_input)
+      continue;
+
+    ti.rank = shape.size();
+    for (int i = 0; i < ti.rank; i++)
+      ti.dims[i] = shape.at(i);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
+  }
+}
+
 } // namespace nnpkg_run
@@ -18,6 +18,9 @@
 #define __NNPACKAGE_RUN_NNFW_UTIL_H__
 
 #include "nnfw.h"
+#include "types.h"
+
+#include <unordered_map>
 
 #define NNPR_ENSURE_STATUS(a)        \
   do                                 \
@@ -32,6 +35,9 @@ namespace nnpkg_run
 {
 uint64_t num_elems(const nnfw_tensorinfo *ti);
 uint64_t bufsize_for(const nnfw_tensorinfo *ti);
+// Set shapes of inputs which differ from shape_map
+void set_tensorinfo(nnfw_session *session,
+                    const std::unordered_map<uint32_t, TensorShape> &shape_map);
 } // end of namespace nnpkg_run
 
 #endif // __NNPACKAGE_UTIL_H__
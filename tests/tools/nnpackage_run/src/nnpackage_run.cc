@@ -20,6 +20,7 @@
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
+#include "loadgen.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
@@ -46,6 +47,24 @@ void overwriteShapeMap(nnpkg_run::TensorShapeMap &shape_map,
     shape_map[i] = shapes[i];
 }
 
+// Get basenames of executable and nnpackage for report filenames
+void getReportBasenames(const std::string &nnpackage_path, char *exec_path,
+                        std::string &exec_basename, std::string &nnpkg_basename)
+{
+  char buf[PATH_MAX];
+  char *res = realpath(nnpackage_path.c_str(), buf);
+  if (res)
+  {
+    nnpkg_basename = basename(buf);
+  }
+  else
+  {
+    std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
+    exit(-1);
+  }
+  exec_basename = basename(exec_path);
+}
+
 int main(const int argc, char **argv)
 {
   using namespace nnpkg_run;
@@ -67,6 +86,23 @@ int main(const int argc, char **argv)
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+    if (args.getLoadMode() != LoadMode::NONE)
+    {
+      auto result = runLoad(args);
+      benchmark::printLoadResult(result);
+
+      if (args.getWriteReport())
+      {
+        char *available_backends = std::getenv("BACKENDS");
+        std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
+        std::string exec_basename;
+        std::string nnpkg_basename;
+        getReportBasenames(nnpackage_path, argv[0], exec_basename, nnpkg_basename);
+        benchmark::writeLoadResult(result, exec_basename, nnpkg_basename, backend_name);
+      }
+      return 0;
+    }
+
     // TODO Apply verbose level to phases
     const int verbose = args.getVerboseLevel();
     benchmark::Phases phases(
@@ -122,41 +158,6 @@ int main(const int argc, char **argv)
       }
     };
 
-    auto setTensorInfo = [session](const TensorShapeMap &tensor_shape_map) {
-      for (auto tensor_shape : tensor_shape_map)
-      {
-        auto ind = tensor_shape.first;
-        auto &shape = tensor_shape.second;
-        nnfw_tensorinfo ti;
-        // to fill dtype
-        NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, ind, &ti));
-
-        bool set_input = false;
-        if (ti.rank != shape.size())
-        {
-          set_input = true;
-        }
-        else
-        {
-          for (int i = 0; i < ti.rank; i++)
-          {
-            if (ti.dims[i] != shape.at(i))
-            {
-              set_input = true;
-              break;
-            }
-          }
-        }
-        if (!set_input)
-          continue;
-
-        ti.rank = shape.size();
-        for (int i = 0; i < ti.rank; i++)
-          ti.dims[i] = shape.at(i);
-        NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, ind, &ti));
-      }
-    };
-
     verifyInputTypes();
     verifyOutputTypes();
 
@@ -172,7 +173,7 @@ int main(const int argc, char **argv)
     if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::PREPARE)
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForPrepare());
 #endif
-    setTensorInfo(args.getShapeMapForPrepare());
+    set_tensorinfo(session, args.getShapeMapForPrepare());
 
     // prepare execution
 
@@ -187,7 +188,7 @@ int main(const int argc, char **argv)
         (!args.getLoadFilename().empty() && !args.shapeParamProvided()))
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForRun());
 #endif
-    setTensorInfo(args.getShapeMapForRun());
+    set_tensorinfo(session, args.getShapeMapForRun());
 
     // prepare input
     std::vector<Allocation> inputs(num_inputs);
@@ -286,20 +287,7 @@ int main(const int argc, char **argv)
     std::string exec_basename;
     std::string nnpkg_basename;
     std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
-    {
-      char buf[PATH_MAX];
-      char *res = realpath(nnpackage_path.c_str(), buf);
-      if (res)
-      {
-        nnpkg_basename = basename(buf);
-      }
-      else
-      {
-        std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
-        exit(-1);
-      }
-      exec_basename = basename(argv[0]);
-    }
+    getReportBasenames(nnpackage_path, argv[0], exec_basename, nnpkg_basename);
 
     benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
 
@@ -17,6 +17,8 @@
 #ifndef __NNPACKAGE_RUN_TYPES_H__
 #define __NNPACKAGE_RUN_TYPES_H__
 
+#include <vector>
+
 namespace nnpkg_run
 {
 
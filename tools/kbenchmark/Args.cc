@@ -36,6 +36,7 @@ void Args::Initialize(const int argc, char **argv)
     ("filter,f", po::value<std::string>(&_filter)->default_value(".*"), "Only run benchmarks whose name matches the regular expression pattern")
     ("verbose,v", po::value<int>(&_verbose)->default_value(0)->implicit_value(true), "Show verbose output")
     ("output,o", po::value<std::string>(&_output)->default_value(""), "Set additional strings for output file name")
+    ("threads,t", po::value<std::vector<int>>(&_threads)->multitoken()->composing()->default_value(std::vector<int>{1}, "1"), "Thread counts to run each configuration with, support multiple thread counts")
   ;
   // clang-format on
 
@@ -101,6 +102,15 @@ void Args::Initialize(const int argc, char **argv)
       exit(1);
     }
   }
+
+  for (auto t : _threads)
+  {
+    if (t < 1)
+    {
+      std::cerr << "Thread count should be positive" << std::endl;
+      exit(1);
+    }
+  }
 }
 
 } // namespace kbenchmark
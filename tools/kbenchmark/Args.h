@@ -36,6 +36,7 @@ public:
   const std::string &reporter(void) { return _reporter; }
   const std::string &filter(void) { return _filter; }
   const std::string &output(void) { return _output; }
+  const std::vector<int> &threads(void) { return _threads; }
   int verbose(void) { return _verbose; }
 
 private:
@@ -47,6 +48,7 @@ private:
   std::string _reporter;
   std::string _filter;
   std::string _output;
+  std::vector<int> _threads;
   int _verbose;
 };
 
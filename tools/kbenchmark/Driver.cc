@@ -39,6 +39,10 @@ int main(int argc, char *argv[])
   const std::vector<std::string> &kernel_list = args.kernel();
   std::vector<void *> khandle_list;
 
+  // Optional entries of kernel libraries which report throughput of the last run
+  typedef void (*throughput_entry)(std::ostream &);
+  std::vector<throughput_entry> throughput_list;
+
   for (auto &k : kernel_list)
   {
     void *khandle;
@@ -67,6 +71,13 @@ int main(int argc, char *argv[])
     // Add current kernel benchmark functions to gloal benchmark list
     nonius::benchmark_registry &kbenchmarks = kbenchmark_entry();
     benchmarks.insert(std::end(benchmarks), std::begin(kbenchmarks), std::end(kbenchmarks));
+
+    auto kthroughput_entry =
+      reinterpret_cast<throughput_entry>(dlsym(khandle, "benchmark_throughput"));
+    if (dlerror() == nullptr && kthroughput_entry != nullptr)
+    {
+      throughput_list.push_back(kthroughput_entry);
+    }
   }
 
   // Set default test name
@@ -120,19 +131,38 @@ int main(int argc, char *argv[])
   }
   else
   {
+    const std::vector<int> &thread_list = args.threads();
     for (auto &c : cf)
     {
-      if (reporter != "html")
+      for (auto threads : thread_list)
       {
         std::string temp_name{test_name + std::string{"_"} + std::to_string(c.first)};
-        cfg.title = temp_name;
-        cfg.output_file = temp_name + ext;
+        if (thread_list.size() > 1)
+        {
+          temp_name += (std::string{"_t"} + std::to_string(threads));
+        }
+        if (reporter != "html")
+        {
+          cfg.title = temp_name;
+          cfg.output_file = temp_name + ext;
+        }
+
+        nonius::parameters op_params = opl[cf.name()]->params(c.first, c.second);
+        op_params.insert({"THREADS", nonius::param{threads}});
+        cfg.params.map = cfg.params.map.merged(op_params);
+
+        nonius::go(cfg, benchmarks);
+
+        if (!throughput_list.empty())
+        {
+          std::cout << "\nThroughput of " << temp_name << std::endl;
+          for (auto &t : throughput_list)
+          {
+            t(std::cout);
+          }
+          std::cout << std::endl;
+        }
       }
-
-      nonius::parameters op_params = opl[cf.name()]->params(c.first, c.second);
-      cfg.params.map = cfg.params.map.merged(op_params);
-
-      nonius::go(cfg, benchmarks);
     }
   }
 
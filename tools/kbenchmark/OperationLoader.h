@@ -21,7 +21,13 @@
 #include <unordered_map>
 
 #include "Operation.h"
+#include "operations/BatchMatMul.h"
 #include "operations/Convolution.h"
+#include "operations/DepthwiseConv.h"
+#include "operations/FullyConnected.h"
+#include "operations/Reduce.h"
+#include "operations/Softmax.h"
+#include "operations/Transpose.h"
 #include "operations/TransposeConv.h"
 
 namespace kbenchmark
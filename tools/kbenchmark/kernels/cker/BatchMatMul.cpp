@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchMatMul benchmark of cker kernel
+ *
+ * The kernel runs on a single thread, so THREADS does not apply to it.
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/BatchMatMul.h>
+
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LHS_SHAPE, std::string{"1,128,64"})
+NONIUS_PARAM(RHS_SHAPE, std::string{"1,64,128"})
+NONIUS_PARAM(ADJ_X, 0);
+NONIUS_PARAM(ADJ_Y, 0);
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  std::vector<int> lhs;
+  std::vector<int> rhs;
+  std::vector<int> out;
+  bool adj_x;
+  bool adj_y;
+  int64_t accum_depth;
+
+  Configuration(nonius::chronometer meter)
+  {
+    lhs = dims(meter.param<LHS_SHAPE>());
+    rhs = dims(meter.param<RHS_SHAPE>());
+    adj_x = meter.param<ADJ_X>() != 0;
+    adj_y = meter.param<ADJ_Y>() != 0;
+
+    // Batch dims are broadcast, and [rows, cols] is [lhs rows, rhs cols]
+    const int rank = std::max(lhs.size(), rhs.size());
+    lhs.insert(lhs.begin(), rank - lhs.size(), 1);
+    rhs.insert(rhs.begin(), rank - rhs.size(), 1);
+    for (int i = 0; i < rank - 2; ++i)
+      out.push_back(std::max(lhs[i], rhs[i]));
+    out.push_back(adj_x ? lhs[rank - 1] : lhs[rank - 2]);
+    out.push_back(adj_y ? rhs[rank - 2] : rhs[rank - 1]);
+    accum_depth = adj_x ? lhs[rank - 2] : lhs[rank - 1];
+  }
+
+  Work work(void) const
+  {
+    const double macs = 1.0 * flat_size(out) * accum_depth;
+    const double elements = flat_size(lhs) + flat_size(rhs) + flat_size(out);
+    return Work{2 * macs, elements * sizeof(float)};
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::BatchMatMul(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> lhs(flat_size(p.lhs), 0.5f);
+  std::vector<float> rhs(flat_size(p.rhs), 0.01f);
+  std::vector<float> output(flat_size(p.out));
+
+  const auto lhs_shape = make_shape(p.lhs);
+  const auto rhs_shape = make_shape(p.rhs);
+  const auto out_shape = make_shape(p.out);
+
+  nnfw::cker::BatchMatMul batch_matmul;
+  batch_matmul.prepare(lhs_shape, rhs_shape, p.adj_x, p.adj_y);
+
+  Throughput::get().measure("cker::BatchMatMul(float)", meter, p.work(), [&](int) {
+    // Run!
+    batch_matmul(lhs_shape, lhs.data(), rhs_shape, rhs.data(), p.adj_x, p.adj_y, out_shape,
+                 output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2D benchmark of cker kernels for float, uint8 and int8
+ *
+ * Float Conv runs on the Eigen thread pool of cker, which is resized to THREADS.
+ */
+
+#include "Utils.h"
+
+#include <cker/eigen/EigenSupport.h>
+#include <cker/operation/Conv.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int batch;
+  int ifm_C, ifm_H, ifm_W;
+  int ofm_C, ofm_H, ofm_W;
+  int ker_H, ker_W;
+
+  nnfw::cker::ConvParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    ifm_C = meter.param<IFM_C>();
+    ifm_H = meter.param<IFM_H>();
+    ifm_W = meter.param<IFM_W>();
+    ofm_C = meter.param<OFM_C>();
+    ofm_H = meter.param<OFM_H>();
+    ofm_W = meter.param<OFM_W>();
+    ker_H = meter.param<KER_H>();
+    ker_W = meter.param<KER_W>();
+
+    const int stride_H = meter.param<STRIDE_H>();
+    const int stride_W = meter.param<STRIDE_W>();
+    const std::string padding = meter.param<PADDING>();
+
+    params.padding_type = padding_type(padding);
+    params.padding_values =
+      calculatePadding(padding, ifm_H, ifm_W, ofm_H, ofm_W, stride_H, stride_W, ker_H, ker_W);
+    params.stride_height = stride_H;
+    params.stride_width = stride_W;
+    params.dilation_height_factor = 1;
+    params.dilation_width_factor = 1;
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    params.is_replaced_weights = false;
+  }
+
+  nnfw::cker::Shape ifm_shape(void) const { return {batch, ifm_H, ifm_W, ifm_C}; }
+  nnfw::cker::Shape ofm_shape(void) const { return {batch, ofm_H, ofm_W, ofm_C}; }
+  nnfw::cker::Shape ker_shape(void) const { return {ofm_C, ker_H, ker_W, ifm_C}; }
+  nnfw::cker::Shape bias_shape(void) const { return {ofm_C}; }
+
+  Work work(int element_size) const
+  {
+    const double macs = 1.0 * batch * ofm_H * ofm_W * ofm_C * ker_H * ker_W * ifm_C;
+    const double elements = ifm_shape().FlatSize() + ofm_shape().FlatSize() +
+                            ker_shape().FlatSize();
+    return Work{2 * macs, elements * element_size};
+  }
+
+  // Quantization params of which values do not change the amount of work
+  void set_quant(int32_t activation_min, int32_t activation_max, int32_t offset)
+  {
+    params.input_offset = -offset;
+    params.weights_offset = -offset;
+    params.output_offset = offset;
+    params.output_multiplier = 1 << 30;
+    params.output_shift = -8;
+    params.quantized_activation_min = activation_min;
+    params.quantized_activation_max = activation_max;
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::Conv(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> input(p.ifm_shape().FlatSize(), 0.5f);
+  std::vector<float> kernel(p.ker_shape().FlatSize(), 0.01f);
+  std::vector<float> bias(p.ofm_C, 0.f);
+  std::vector<float> output(p.ofm_shape().FlatSize());
+
+  nnfw::cker::eigen_support::EigenContext::GetEigenContext().SetNumThreads(
+    meter.param<THREADS>());
+
+  nnfw::cker::Conv conv;
+  conv.prepare(p.ker_shape(), kernel.data(), p.params.padding_type, p.params.is_replaced_weights,
+               1, 1);
+
+  Throughput::get().measure("cker::Conv(float)", meter, p.work(sizeof(float)), [&](int) {
+    // Run!
+    conv(p.params, p.ifm_shape(), input.data(), p.ker_shape(), kernel.data(), p.bias_shape(),
+         bias.data(), p.ofm_shape(), output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::Conv(uint8)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  p.set_quant(0, 255, 128);
+
+  std::vector<uint8_t> input(p.ifm_shape().FlatSize(), 130);
+  std::vector<uint8_t> kernel(p.ker_shape().FlatSize(), 129);
+  std::vector<int32_t> bias(p.ofm_C, 0);
+  std::vector<uint8_t> output(p.ofm_shape().FlatSize());
+
+  nnfw::cker::Conv conv;
+  conv.prepareQuant(p.ifm_shape(), p.ker_shape(), p.ofm_shape(), p.params.stride_width,
+                    p.params.stride_height, 1, 1);
+
+  Throughput::get().measure("cker::Conv(uint8)", meter, p.work(sizeof(uint8_t)), [&](int) {
+    // Run!
+    conv(p.params, p.ifm_shape(), input.data(), p.ker_shape(), kernel.data(), p.bias_shape(),
+         bias.data(), p.ofm_shape(), output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::Conv(int8)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  p.set_quant(-128, 127, 0);
+
+  std::vector<int8_t> input(p.ifm_shape().FlatSize(), 2);
+  std::vector<int8_t> kernel(p.ker_shape().FlatSize(), 1);
+  std::vector<int32_t> bias(p.ofm_C, 0);
+  std::vector<int8_t> output(p.ofm_shape().FlatSize());
+
+  nnfw::cker::Conv conv;
+  conv.per_channel_output_multiplier().assign(p.ofm_C, 1 << 30);
+  conv.per_channel_output_shift().assign(p.ofm_C, -8);
+
+  Throughput::get().measure("cker::Conv(int8)", meter, p.work(sizeof(int8_t)), [&](int) {
+    // Run!
+    conv(p.params, p.ifm_shape(), input.data(), p.ker_shape(), kernel.data(), p.bias_shape(),
+         bias.data(), p.ofm_shape(), output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
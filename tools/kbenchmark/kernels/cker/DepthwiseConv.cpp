@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file DepthwiseConv2D benchmark of cker kernels for float and uint8
+ *
+ * cker caps threads of the float kernel to 2.
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/DepthwiseConv.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 32);
+NONIUS_PARAM(IFM_H, 112);
+NONIUS_PARAM(IFM_W, 112);
+
+NONIUS_PARAM(OFM_C, 32);
+NONIUS_PARAM(OFM_H, 112);
+NONIUS_PARAM(OFM_W, 112);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+NONIUS_PARAM(DILATION_H, 1);
+NONIUS_PARAM(DILATION_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(MULTIPLIER, 1);
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int batch;
+  int ifm_C, ifm_H, ifm_W;
+  int ofm_C, ofm_H, ofm_W;
+  int ker_H, ker_W;
+
+  nnfw::cker::DepthwiseConvParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    ifm_C = meter.param<IFM_C>();
+    ifm_H = meter.param<IFM_H>();
+    ifm_W = meter.param<IFM_W>();
+    ofm_C = meter.param<OFM_C>();
+    ofm_H = meter.param<OFM_H>();
+    ofm_W = meter.param<OFM_W>();
+    ker_H = meter.param<KER_H>();
+    ker_W = meter.param<KER_W>();
+
+    const int stride_H = meter.param<STRIDE_H>();
+    const int stride_W = meter.param<STRIDE_W>();
+    const int dilation_H = meter.param<DILATION_H>();
+    const int dilation_W = meter.param<DILATION_W>();
+    const std::string padding = meter.param<PADDING>();
+
+    params.padding_type = padding_type(padding);
+    params.padding_values = calculatePadding(padding, ifm_H, ifm_W, ofm_H, ofm_W, stride_H,
+                                             stride_W, ker_H, ker_W, dilation_H, dilation_W);
+    params.stride_height = stride_H;
+    params.stride_width = stride_W;
+    params.dilation_height_factor = dilation_H;
+    params.dilation_width_factor = dilation_W;
+    params.depth_multiplier = meter.param<MULTIPLIER>();
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    // Quantization params of which values do not change the amount of work
+    params.input_offset = -128;
+    params.weights_offset = -128;
+    params.output_offset = 128;
+    params.output_multiplier = 1 << 30;
+    params.output_shift = -8;
+    params.quantized_activation_min = 0;
+    params.quantized_activation_max = 255;
+  }
+
+  nnfw::cker::Shape ifm_shape(void) const { return {batch, ifm_H, ifm_W, ifm_C}; }
+  nnfw::cker::Shape ofm_shape(void) const { return {batch, ofm_H, ofm_W, ofm_C}; }
+  nnfw::cker::Shape ker_shape(void) const { return {1, ker_H, ker_W, ofm_C}; }
+  nnfw::cker::Shape bias_shape(void) const { return {ofm_C}; }
+
+  Work work(int element_size) const
+  {
+    const double macs = 1.0 * batch * ofm_H * ofm_W * ofm_C * ker_H * ker_W;
+    const double elements = ifm_shape().FlatSize() + ofm_shape().FlatSize() +
+                            ker_shape().FlatSize();
+    return Work{2 * macs, elements * element_size};
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::DepthwiseConv(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> input(p.ifm_shape().FlatSize(), 0.5f);
+  std::vector<float> kernel(p.ker_shape().FlatSize(), 0.01f);
+  std::vector<float> bias(p.ofm_C, 0.f);
+  std::vector<float> output(p.ofm_shape().FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  Throughput::get().measure("cker::DepthwiseConv(float)", meter, p.work(sizeof(float)), [&](int) {
+    // Run!
+    nnfw::cker::DepthwiseConv<float, float>(p.params, p.ifm_shape(), input.data(), p.ker_shape(),
+                                            kernel.data(), p.bias_shape(), bias.data(),
+                                            p.ofm_shape(), output.data(), &ruy_context);
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::DepthwiseConv(uint8)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<uint8_t> input(p.ifm_shape().FlatSize(), 130);
+  std::vector<uint8_t> kernel(p.ker_shape().FlatSize(), 129);
+  std::vector<int32_t> bias(p.ofm_C, 0);
+  std::vector<uint8_t> output(p.ofm_shape().FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  Throughput::get().measure("cker::DepthwiseConv(uint8)", meter, p.work(sizeof(uint8_t)),
+                            [&](int) {
+                              // Run!
+                              nnfw::cker::DepthwiseConv<uint8_t, int32_t>(
+                                p.params, p.ifm_shape(), input.data(), p.ker_shape(),
+                                kernel.data(), p.bias_shape(), bias.data(), p.ofm_shape(),
+                                output.data(), &ruy_context);
+                            });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
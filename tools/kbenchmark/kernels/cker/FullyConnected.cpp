@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark of cker kernels for dense, hybrid and block sparse weights
+ *
+ * Block sparse weights are made with SPARSITY percent of zero blocks of BLOCK_ROWS x BLOCK_COLS,
+ * and GFLOP/s counts non-zero blocks only. Block sizes are reduced to the largest divisors of the
+ * weights shape, so that blocks tile the weights of any configuration.
+ */
+
+#include "Utils.h"
+
+#include <cker/Utils.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedSparseBlock.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(IFM_C, 1024);
+NONIUS_PARAM(OFM_C, 1024);
+
+NONIUS_PARAM(BLOCK_ROWS, 16);
+NONIUS_PARAM(BLOCK_COLS, 1);
+// Percentage of zero blocks
+NONIUS_PARAM(SPARSITY, 80);
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int batch;
+  int ifm_C;
+  int ofm_C;
+
+  nnfw::cker::FullyConnectedParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    ifm_C = meter.param<IFM_C>();
+    ofm_C = meter.param<OFM_C>();
+
+    params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+    // Quantization params of which values do not change the amount of work
+    params.input_offset = -128;
+    params.weights_offset = -128;
+    params.weights_scale = 0.01f;
+    params.output_offset = 128;
+    params.output_multiplier = 1 << 30;
+    params.output_shift = -8;
+    params.quantized_activation_min = 0;
+    params.quantized_activation_max = 255;
+  }
+
+  nnfw::cker::Shape ifm_shape(void) const { return {batch, ifm_C}; }
+  nnfw::cker::Shape ofm_shape(void) const { return {batch, ofm_C}; }
+  nnfw::cker::Shape weights_shape(void) const { return {ofm_C, ifm_C}; }
+  nnfw::cker::Shape bias_shape(void) const { return {ofm_C}; }
+
+  Work work(int element_size, int weights_element_size, double density = 1.0) const
+  {
+    const double macs = density * batch * ofm_C * ifm_C;
+    const double bytes = 1.0 * (batch * ifm_C + batch * ofm_C) * element_size +
+                         density * ofm_C * ifm_C * weights_element_size;
+    return Work{2 * macs, bytes};
+  }
+};
+
+// Largest divisor of size which is not greater than block
+int tile(int size, int block)
+{
+  int tile_size = std::max(std::min(size, block), 1);
+  while (size % tile_size != 0)
+    --tile_size;
+  return tile_size;
+}
+
+template <typename T> struct BlockSparseWeights
+{
+  std::vector<T> values;
+  std::vector<uint16_t> segments;
+  std::vector<uint16_t> indices;
+};
+
+template <typename T>
+BlockSparseWeights<T> make_weights(int rows, int cols, int block_rows, int block_cols,
+                                   int sparsity, T value)
+{
+  std::mt19937 gen(0);
+  std::bernoulli_distribution keep_dist(1.0 - sparsity / 100.0);
+
+  BlockSparseWeights<T> weights;
+  weights.segments.push_back(0);
+  for (int i = 0; i < rows / block_rows; ++i)
+  {
+    for (int j = 0; j < cols / block_cols; ++j)
+    {
+      if (!keep_dist(gen))
+        continue;
+      weights.indices.push_back(j);
+      weights.values.insert(weights.values.end(), block_rows * block_cols, value);
+    }
+    weights.segments.push_back(weights.indices.size());
+  }
+  return weights;
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnected(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> input(p.ifm_shape().FlatSize(), 0.5f);
+  std::vector<float> weights(p.weights_shape().FlatSize(), 0.01f);
+  std::vector<float> bias(p.ofm_C, 0.f);
+  std::vector<float> output(p.ofm_shape().FlatSize());
+
+  Throughput::get().measure("cker::FullyConnected(float)", meter,
+                            p.work(sizeof(float), sizeof(float)), [&](int) {
+                              // Run!
+                              nnfw::cker::FullyConnected(
+                                p.params, p.ifm_shape(), input.data(), p.weights_shape(),
+                                weights.data(), p.bias_shape(), bias.data(), p.ofm_shape(),
+                                output.data());
+                            });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnected(uint8)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<uint8_t> input(p.ifm_shape().FlatSize(), 130);
+  std::vector<uint8_t> weights(p.weights_shape().FlatSize(), 129);
+  std::vector<int32_t> bias(p.ofm_C, 0);
+  std::vector<uint8_t> output(p.ofm_shape().FlatSize());
+
+  Throughput::get().measure("cker::FullyConnected(uint8)", meter,
+                            p.work(sizeof(uint8_t), sizeof(uint8_t)), [&](int) {
+                              // Run!
+                              nnfw::cker::FullyConnected(
+                                p.params, p.ifm_shape(), input.data(), p.weights_shape(),
+                                weights.data(), p.bias_shape(), bias.data(), p.ofm_shape(),
+                                output.data());
+                            });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnectedHybrid", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> input(p.ifm_shape().FlatSize(), 0.5f);
+  std::vector<int8_t> weights(p.weights_shape().FlatSize(), 1);
+  std::vector<float> bias(p.ofm_C, 0.f);
+  std::vector<float> output(p.ofm_shape().FlatSize());
+
+  nnfw::cker::FCTempArena temp_arena;
+  temp_arena.prepare(p.ifm_shape(), p.weights_shape());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  Throughput::get().measure("cker::FullyConnectedHybrid", meter,
+                            p.work(sizeof(float), sizeof(int8_t)), [&](int) {
+                              // Run!
+                              nnfw::cker::FullyConnectedHybrid(
+                                p.params, p.ifm_shape(), input.data(), p.weights_shape(),
+                                weights.data(), p.bias_shape(), bias.data(), p.ofm_shape(),
+                                output.data(), temp_arena, &ruy_context);
+                            });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnectedSparseBlock(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  const int block_rows = tile(p.ofm_C, meter.param<BLOCK_ROWS>());
+  const int block_cols = tile(p.ifm_C, meter.param<BLOCK_COLS>());
+
+  auto weights = make_weights(p.ofm_C, p.ifm_C, block_rows, block_cols, meter.param<SPARSITY>(),
+                              0.01f);
+  std::vector<float> input(p.ifm_shape().FlatSize(), 0.5f);
+  std::vector<float> bias(p.ofm_C, 0.f);
+  std::vector<float> output(p.ofm_shape().FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  const double density = static_cast<double>(weights.values.size()) / (p.ofm_C * p.ifm_C);
+  Throughput::get().measure(
+    "cker::FullyConnectedSparseBlock(float)", meter,
+    p.work(sizeof(float), sizeof(float), density), [&](int) {
+      // Run!
+      nnfw::cker::FullyConnectedSparseWeightBlock(
+        p.params, p.ifm_shape(), input.data(), p.weights_shape(), weights.values.data(),
+        p.bias_shape(), bias.data(), p.ofm_shape(), output.data(), weights.segments.data(),
+        weights.indices.data(), block_rows, block_cols, &ruy_context);
+    });
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::FullyConnectedSparseBlock(int8)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  const int block_rows = tile(p.ofm_C, meter.param<BLOCK_ROWS>());
+  const int block_cols = tile(p.ifm_C, meter.param<BLOCK_COLS>());
+
+  // Weights of int8 are symmetric, and zero points of input and output do not change the work
+  p.params.input_offset = 0;
+  p.params.output_offset = 0;
+  p.params.quantized_activation_min = -128;
+  p.params.quantized_activation_max = 127;
+  int32_t output_multiplier;
+  int output_shift;
+  nnfw::cker::QuantizeMultiplier(0.01, &output_multiplier, &output_shift);
+
+  auto weights = make_weights<int8_t>(p.ofm_C, p.ifm_C, block_rows, block_cols,
+                                      meter.param<SPARSITY>(), 1);
+  std::vector<int8_t> input(p.ifm_shape().FlatSize(), 2);
+  std::vector<int32_t> bias(p.ofm_C, 0);
+  std::vector<int8_t> output(p.ofm_shape().FlatSize());
+  std::vector<int32_t> scratch(p.ofm_shape().FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  const double density = static_cast<double>(weights.values.size()) / (p.ofm_C * p.ifm_C);
+  Throughput::get().measure(
+    "cker::FullyConnectedSparseBlock(int8)", meter,
+    p.work(sizeof(int8_t), sizeof(int8_t), density), [&](int) {
+      // Run!
+      nnfw::cker::FullyConnectedSparseWeightBlock(
+        p.params, &output_multiplier, &output_shift, false, p.ifm_shape(), input.data(),
+        p.weights_shape(), weights.values.data(), p.bias_shape(), bias.data(), p.ofm_shape(),
+        output.data(), scratch.data(), weights.segments.data(), weights.indices.data(),
+        block_rows, block_cols, &ruy_context);
+    });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Reduce benchmark of cker kernels for Sum, Max and Mean along AXES
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(IFM_SHAPE, std::string{"1,56,56,256"})
+NONIUS_PARAM(AXES, std::string{"1,2"})
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  std::vector<int> ifm;
+  std::vector<int> ofm;
+  std::vector<int> axes;
+
+  Configuration(nonius::chronometer meter)
+  {
+    ifm = dims(meter.param<IFM_SHAPE>());
+    axes = dims(meter.param<AXES>());
+
+    // Reduced dims are kept as 1, which does not change the layout of output
+    const int rank = ifm.size();
+    ofm = ifm;
+    for (auto axis : axes)
+      ofm[(axis < 0) ? axis + rank : axis] = 1;
+  }
+
+  // A reduction of an element counts as an operation
+  Work work(void) const
+  {
+    return Work{1.0 * flat_size(ifm), 1.0 * (flat_size(ifm) + flat_size(ofm)) * sizeof(float)};
+  }
+};
+
+template <typename Reducer>
+void reduce_benchmark(const std::string &name, nonius::chronometer meter, const Reducer &reducer)
+{
+  Configuration p{meter};
+
+  std::vector<float> input(flat_size(p.ifm), 0.5f);
+  std::vector<float> output(flat_size(p.ofm));
+  const auto ifm_shape = make_shape(p.ifm);
+  const auto ofm_shape = make_shape(p.ofm);
+
+  nnfw::cker::Reduce reduce_kernel;
+  reduce_kernel.prepare(p.ifm.size(), p.axes.size());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  Throughput::get().measure(name, meter, p.work(), [&](int) {
+    // Run!
+    reduce_kernel.ReduceGeneric<float>(ifm_shape, input.data(), ofm_shape, output.data(), p.axes,
+                                       true, reducer, &ruy_context);
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::ReduceSum(float)", [](nonius::chronometer meter) {
+  reduce_benchmark("cker::ReduceSum(float)", meter, nnfw::cker::reduce::SumReducer<float>());
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::ReduceMax(float)", [](nonius::chronometer meter) {
+  reduce_benchmark("cker::ReduceMax(float)", meter, nnfw::cker::reduce::MaxReducer<float>());
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::Mean(float)", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  std::vector<float> input(flat_size(p.ifm), 0.5f);
+  std::vector<float> output(flat_size(p.ofm));
+  const auto ifm_shape = make_shape(p.ifm);
+  const auto ofm_shape = make_shape(p.ofm);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  Throughput::get().measure("cker::Mean(float)", meter, p.work(), [&](int) {
+    // Run!
+    nnfw::cker::Mean(ifm_shape, input.data(), ofm_shape, output.data(), p.axes, &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Softmax benchmark of cker kernel along the last axis
+ *
+ * Softmax is bound by memory and exp, so only bandwidth is reported. The kernel runs on a single
+ * thread, so THREADS does not apply to it.
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/SoftMax.h>
+
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(IFM_SHAPE, std::string{"1,1001"})
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::Softmax(float)", [](nonius::chronometer meter) {
+  const auto ifm = dims(meter.param<IFM_SHAPE>());
+  const auto shape = make_shape(ifm);
+
+  std::vector<float> input(flat_size(ifm));
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 0.01f * (i % 100);
+  std::vector<float> output(input.size());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0;
+  params.axis = -1;
+
+  const Work work{0, 2.0 * input.size() * sizeof(float)};
+  Throughput::get().measure("cker::Softmax(float)", meter, work, [&](int) {
+    // Run!
+    nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
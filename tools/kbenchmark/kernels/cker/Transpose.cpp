@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark of cker kernel with PERM of up to 4 dims
+ *
+ * Transpose moves data only, so only bandwidth is reported. The kernel runs on a single thread,
+ * so THREADS does not apply to it.
+ */
+
+#include "Utils.h"
+
+#include <cker/operation/Transpose.h>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+using namespace kbenchmark::kernels::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(IFM_SHAPE, std::string{"1,56,56,256"})
+NONIUS_PARAM(PERM, std::string{"0,3,1,2"})
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  std::vector<int> ifm;
+  std::vector<int> ofm;
+
+  nnfw::cker::TransposeParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    ifm = dims(meter.param<IFM_SHAPE>());
+    const auto perm = dims(meter.param<PERM>());
+    assert(perm.size() == ifm.size() && perm.size() <= 4);
+
+    params.perm_count = perm.size();
+    for (size_t i = 0; i < perm.size(); ++i)
+    {
+      params.perm[i] = perm[i];
+      ofm.push_back(ifm[perm[i]]);
+    }
+  }
+};
+
+template <typename T> void transpose_benchmark(const std::string &name, nonius::chronometer meter)
+{
+  Configuration p{meter};
+
+  std::vector<T> input(flat_size(p.ifm));
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>(i % 100);
+  std::vector<T> output(input.size());
+  const auto ifm_shape = make_shape(p.ifm);
+  const auto ofm_shape = make_shape(p.ofm);
+
+  const Work work{0, 2.0 * input.size() * sizeof(T)};
+  Throughput::get().measure(name, meter, work, [&](int) {
+    // Run!
+    nnfw::cker::Transpose<T>(p.params, ifm_shape, input.data(), ofm_shape, output.data());
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("cker::Transpose(float)", [](nonius::chronometer meter) {
+  transpose_benchmark<float>("cker::Transpose(float)", meter);
+})
+
+NONIUS_LOCAL_BENCHMARK("cker::Transpose(uint8)", [](nonius::chronometer meter) {
+  transpose_benchmark<uint8_t>("cker::Transpose(uint8)", meter);
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" void benchmark_throughput(std::ostream &os) { Throughput::get().report(os); }
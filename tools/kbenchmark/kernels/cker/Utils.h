@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_KERNELS_CKER_UTILS_H__
+#define __KBENCHMARK_KERNELS_CKER_UTILS_H__
+
+#include <nonius/nonius.h++>
+
+#include <cker/Shape.h>
+#include <cker/Types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+namespace kernels
+{
+namespace cker
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+/**
+ * @brief Work done by a run of a kernel
+ */
+struct Work
+{
+  // Arithmetic operations, where a multiply-add counts as 2
+  double flops;
+  // Bytes of inputs, weights and outputs
+  double bytes;
+};
+
+/**
+ * @brief Recorder of the time of benchmarks to report GFLOP/s and bandwidth
+ *
+ * nonius reports time only, so each benchmark runs through measure() which times the samples
+ * of nonius again. Records are reported and cleared by benchmark_throughput() after each run of
+ * the driver.
+ */
+class Throughput
+{
+public:
+  static Throughput &get(void)
+  {
+    static Throughput instance;
+    return instance;
+  }
+
+  template <typename Fun>
+  void measure(const std::string &name, nonius::chronometer &meter, const Work &work, Fun &&fun)
+  {
+    const auto begin = std::chrono::steady_clock::now();
+    meter.measure(std::forward<Fun>(fun));
+    const auto end = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+    auto &record = _records[name];
+    record.work = work;
+    record.runs += meter.runs();
+    record.seconds += seconds;
+    record.best = std::min(record.best, seconds / meter.runs());
+  }
+
+  void report(std::ostream &os)
+  {
+    if (_records.empty())
+      return;
+
+    // clang-format off
+    os << std::left << std::setw(48) << "benchmark"
+       << std::right << std::setw(12) << "best(ms)" << std::setw(12) << "mean(ms)"
+       << std::setw(12) << "GFLOP/s" << std::setw(12) << "GB/s" << std::endl;
+    // clang-format on
+    for (const auto &entry : _records)
+    {
+      const auto &record = entry.second;
+      const double mean = record.seconds / record.runs;
+      os << std::left << std::setw(48) << entry.first << std::right << std::fixed
+         << std::setprecision(3) << std::setw(12) << record.best * 1e3 << std::setw(12)
+         << mean * 1e3;
+      if (record.work.flops > 0)
+        os << std::setw(12) << record.work.flops / record.best * 1e-9;
+      else
+        os << std::setw(12) << "-";
+      os << std::setw(12) << record.work.bytes / record.best * 1e-9 << std::endl;
+    }
+    os.unsetf(std::ios::floatfield);
+    _records.clear();
+  }
+
+private:
+  struct Record
+  {
+    Work work{0, 0};
+    int64_t runs = 0;
+    double seconds = 0;
+    double best = std::numeric_limits<double>::max();
+  };
+
+  std::map<std::string, Record> _records;
+};
+
+/**
+ * @brief Parse dims of "1,299,299,3", of which shapes in config files are
+ */
+inline std::vector<int> dims(const std::string &src)
+{
+  std::vector<int> dim;
+
+  std::stringstream ss(src);
+  int i;
+  while (ss >> i)
+  {
+    dim.push_back(i);
+    if (ss.peek() == ',')
+      ss.ignore();
+  }
+  return dim;
+}
+
+inline nnfw::cker::Shape make_shape(const std::vector<int> &dims)
+{
+  return nnfw::cker::Shape(static_cast<int>(dims.size()), dims.data());
+}
+
+inline int64_t flat_size(const std::vector<int> &dims)
+{
+  int64_t size = 1;
+  for (auto dim : dims)
+    size *= dim;
+  return size;
+}
+
+inline nnfw::cker::PaddingType padding_type(const std::string &padding_name)
+{
+  return (padding_name == "VALID") ? nnfw::cker::PaddingType::kValid
+                                   : nnfw::cker::PaddingType::kSame;
+}
+
+inline nnfw::cker::PaddingValues calculatePadding(const std::string &padding_name, int ifm_H,
+                                                  int ifm_W, int ofm_H, int ofm_W,
+                                                  int vertical_stride, int horizontal_stride,
+                                                  int ker_H, int ker_W, int dilation_H = 1,
+                                                  int dilation_W = 1)
+{
+  nnfw::cker::PaddingValues padding{0, 0};
+  if (padding_name == "SAME")
+  {
+    const int vertical_needed_input = (ofm_H - 1) * vertical_stride + (ker_H - 1) * dilation_H + 1;
+    const int horizontal_needed_input =
+      (ofm_W - 1) * horizontal_stride + (ker_W - 1) * dilation_W + 1;
+
+    padding.height = std::max(0, vertical_needed_input - ifm_H) / 2;
+    padding.width = std::max(0, horizontal_needed_input - ifm_W) / 2;
+  }
+  return padding;
+}
+
+} // namespace cker
+} // namespace kernels
+} // namespace kbenchmark
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                       \
+  namespace                                                                                     \
+  {                                                                                             \
+  static ::nonius::benchmark_registrar NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(          \
+    ::kbenchmark::kernels::cker::local_benchmark_registry(), name, __VA_ARGS__);                \
+  }
+
+#endif // __KBENCHMARK_KERNELS_CKER_UTILS_H__
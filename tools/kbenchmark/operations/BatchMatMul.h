@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+#define __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class BatchMatMul final : public Operation
+{
+public:
+  BatchMatMul() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    params.insert({"LHS_SHAPE", nonius::param{get_key_string({"input0"}, info)}});
+    params.insert({"RHS_SHAPE", nonius::param{get_key_string({"input1"}, info)}});
+
+    // Config files do not have adj_x and adj_y, so they are from the dims which match
+    auto _lhs = get_key_dims({"input0"}, info);
+    auto _rhs = get_key_dims({"input1"}, info);
+    const auto lhs_rank = _lhs.size();
+    const auto rhs_rank = _rhs.size();
+    int adj_x = 0;
+    int adj_y = 0;
+    if (_lhs[lhs_rank - 1] != _rhs[rhs_rank - 2])
+    {
+      if (_lhs[lhs_rank - 1] == _rhs[rhs_rank - 1])
+        adj_y = 1;
+      else if (_lhs[lhs_rank - 2] == _rhs[rhs_rank - 2])
+        adj_x = 1;
+      else
+        adj_x = adj_y = 1;
+    }
+    params.insert({"ADJ_X", nonius::param{adj_x}});
+    params.insert({"ADJ_Y", nonius::param{adj_y}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_BATCH_MATMUL_H__
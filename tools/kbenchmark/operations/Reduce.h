@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_REDUCE_H__
+#define __KBENCHMARK_OPERATIONS_REDUCE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Reduce final : public Operation
+{
+public:
+  Reduce() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    params.insert({"IFM_SHAPE", nonius::param{get_key_string({"input0"}, info)}});
+
+    // Config files have the shape of axes only, so axes are the dims which output does not have.
+    // Output keeps reduced dims as 1 or drops them.
+    auto _input = get_key_dims({"input0"}, info);
+    auto _output = get_key_dims({"output0"}, info);
+    const bool keep_dims = (_input.size() == _output.size());
+    std::string axes;
+    size_t o = 0;
+    for (size_t i = 0; i < _input.size(); ++i)
+    {
+      const bool kept = keep_dims ? (_input[i] == _output[i] && _input[i] != 1)
+                                  : (o < _output.size() && _input[i] == _output[o]);
+      if (kept)
+      {
+        ++o;
+        continue;
+      }
+      if (keep_dims && _input[i] == 1)
+        continue;
+      axes += (axes.empty() ? "" : ",") + std::to_string(i);
+    }
+    params.insert({"AXES", nonius::param{axes}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_REDUCE_H__
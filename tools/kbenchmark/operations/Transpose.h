@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+#define __KBENCHMARK_OPERATIONS_TRANSPOSE_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class Transpose final : public Operation
+{
+public:
+  Transpose() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    params.insert({"IFM_SHAPE", nonius::param{get_key_string({"input0"}, info)}});
+
+    // Config files have the shape of perm only, so perm maps each output dim to the first unused
+    // input dim of the same size
+    auto _input = get_key_dims({"input0"}, info);
+    auto _output = get_key_dims({"output0"}, info);
+    std::vector<bool> used(_input.size(), false);
+    std::string perm;
+    for (auto dim : _output)
+    {
+      size_t i = 0;
+      while (i < _input.size() && (used[i] || _input[i] != dim))
+        ++i;
+      assert(i < _input.size());
+      used[i] = true;
+      perm += (perm.empty() ? "" : ",") + std::to_string(i);
+    }
+    params.insert({"PERM", nonius::param{perm}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_TRANSPOSE_H__